@@ -38,6 +38,7 @@
 #include "wrench/services/compute/serverless/schedulers/RandomServerlessScheduler.h"
 #include "wrench/services/compute/serverless/schedulers/FCFSServerlessScheduler.h"
 #include "wrench/services/compute/serverless/schedulers/WorkloadBalancingServerlessScheduler.h"
+#include "wrench/services/compute/serverless/schedulers/DeadlineAwareServerlessScheduler.h"
 
 namespace sg4 = simgrid::s4u;
 
@@ -169,6 +170,12 @@ int main(int argc, char **argv) {
         sched = std::make_shared<wrench::FCFSServerlessScheduler>();
     } else if (scheduler_type == "balance") {
         sched = std::make_shared<wrench::WorkloadBalancingServerlessScheduler>();
+    } else if (scheduler_type == "edf") {
+        sched = std::make_shared<wrench::DeadlineAwareServerlessScheduler>(
+            wrench::DeadlineAwareServerlessScheduler::EARLIEST_DEADLINE_FIRST);
+    } else if (scheduler_type == "lsf") {
+        sched = std::make_shared<wrench::DeadlineAwareServerlessScheduler>(
+            wrench::DeadlineAwareServerlessScheduler::LEAST_SLACK_FIRST);
     } else {
         std::cerr << "Unknown scheduler: " << scheduler_type << "\n";
         return 1;
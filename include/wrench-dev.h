@@ -53,6 +53,9 @@
 #include "wrench/managers/job_manager/JobManager.h"
 #include "wrench/managers/data_movement_manager/DataMovementManager.h"
 
+// Scheduling helpers
+#include "wrench/execution_controller/ListScheduler.h"
+
 // Logging
 #include "wrench/logging/TerminalOutput.h"
 
@@ -27,6 +27,7 @@
 #include "wrench/services/compute/cloud/CloudComputeService.h"
 #include "wrench/services/compute/cloud/CloudComputeServiceProperty.h"
 #include "wrench/services/compute/serverless/ServerlessComputeService.h"
+#include "wrench/services/compute/serverless/ServerlessFrontEnd.h"
 #include "wrench/services/compute/batch/BatchComputeService.h"
 #include "wrench/services/compute/batch/BatchComputeServiceProperty.h"
 #include "wrench/services/compute/htcondor/HTCondorComputeService.h"
@@ -38,10 +39,12 @@
 // Simulation Output Analysis
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/SimulationTimestampStream.h"
 
 // Workflow
 #include "wrench/workflow/Workflow.h"
 #include "wrench/workflow/WorkflowTask.h"
+#include "wrench/workflow/WorkflowSnapshot.h"
 
 // Tools
 #include "wrench/tools/wfcommons/WfCommonsWorkflowParser.h"
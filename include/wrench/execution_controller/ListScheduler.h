@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_LISTSCHEDULER_H
+#define WRENCH_LISTSCHEDULER_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace wrench {
+
+    class Workflow;
+    class WorkflowTask;
+    class DataFile;
+    class JobManager;
+    class StandardJob;
+    class BareMetalComputeService;
+    class StorageService;
+
+    /**
+     * @brief A list scheduler (in the spirit of HEFT) for workflows executed on bare-metal compute
+     *        services, with all files read from and written to a single storage service.
+     *
+     *        Tasks are prioritized by their upward rank, i.e., the length of the longest path from the task to
+     *        an exit task, in which task execution times and data transfer times are averaged over the compute
+     *        hosts (based on core speeds, and on the bandwidth of the route between the storage service's host
+     *        and each compute host). The ready task with the highest rank is submitted, via a job manager, to the
+     *        compute host on which it would complete the earliest among those with enough idle cores and RAM,
+     *        and so on until the highest-rank ready task cannot run on any host.
+     *
+     *        The scheduler is meant to be used by an execution controller: create it in main(), once the
+     *        services are up, call scheduleReadyTasks() whenever tasks may have become ready or resources
+     *        may have become available, and pass it the standard jobs that complete or fail.
+     */
+    class ListScheduler {
+
+    public:
+        ListScheduler(std::shared_ptr<Workflow> workflow,
+                      std::shared_ptr<JobManager> job_manager,
+                      const std::vector<std::shared_ptr<BareMetalComputeService>> &compute_services,
+                      std::shared_ptr<StorageService> storage_service);
+
+        unsigned long scheduleReadyTasks();
+
+        void processJobCompletion(const std::shared_ptr<StandardJob> &job);
+        void processJobFailure(const std::shared_ptr<StandardJob> &job);
+
+        double getUpwardRank(const std::shared_ptr<WorkflowTask> &task) const;
+        unsigned long getNumQueuedTasks() const;
+
+    private:
+        /* A compute host of one of the compute services */
+        struct Host {
+            std::shared_ptr<BareMetalComputeService> compute_service;
+            std::string name;
+            double core_flop_rate;
+            double bandwidth;// bottleneck bandwidth of the route to the storage service's host
+            unsigned long num_idle_cores;
+            double available_ram;
+        };
+
+        /* The order of the ready queue: by decreasing upward rank, and then by task ID */
+        struct ReadyQueueOrder {
+            bool operator()(const std::pair<double, std::shared_ptr<WorkflowTask>> &lhs,
+                            const std::pair<double, std::shared_ptr<WorkflowTask>> &rhs) const;
+        };
+
+        /* The resources allocated to a running job */
+        struct Allocation {
+            size_t host_index;
+            unsigned long num_cores;
+            double ram;
+        };
+
+        std::shared_ptr<Workflow> workflow;
+        std::shared_ptr<JobManager> job_manager;
+        std::shared_ptr<StorageService> storage_service;
+
+        std::vector<Host> hosts;
+        std::unordered_map<WorkflowTask *, double> upward_ranks;
+
+        std::set<std::pair<double, std::shared_ptr<WorkflowTask>>, ReadyQueueOrder> ready_queue;
+        std::unordered_set<WorkflowTask *> queued_tasks;
+        bool ready_queue_is_seeded = false;
+
+        std::map<std::shared_ptr<StandardJob>, Allocation> running_jobs;
+
+        void computeUpwardRanks();
+        void enqueue(const std::shared_ptr<WorkflowTask> &task);
+        void release(const std::shared_ptr<StandardJob> &job);
+        static double estimateExecutionTime(WorkflowTask *task, const Host &host, unsigned long num_cores);
+        static double estimateTransferTime(double num_bytes, const Host &host);
+        static double getTotalSize(const std::vector<std::shared_ptr<DataFile>> &files);
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_LISTSCHEDULER_H
@@ -33,12 +33,15 @@ namespace wrench {
 
         Function(const std::string &name,
                  const std::function<std::shared_ptr<FunctionOutput>(const std::shared_ptr<FunctionInput> &, const std::shared_ptr<StorageService> &)> &lambda,
-                 const std::shared_ptr<FileLocation> &image);
+                 const std::shared_ptr<FileLocation> &image,
+                 sg_size_t snapshot_size_in_bytes = 0);
 
         [[nodiscard]] std::string getName() const;
 
         [[nodiscard]] std::shared_ptr<FileLocation> getImage() const;
 
+        [[nodiscard]] sg_size_t getSnapshotSize() const;
+
         [[nodiscard]] std::shared_ptr<FunctionOutput> execute(const std::shared_ptr<FunctionInput> &input, const std::shared_ptr<StorageService> &storage_service) const;
 
     private:
@@ -48,6 +51,7 @@ namespace wrench {
         std::string _name; // the name of the function
         std::function<std::shared_ptr<FunctionOutput>(const std::shared_ptr<FunctionInput> &, const std::shared_ptr<StorageService> &)> _lambda; // the function logic
         std::shared_ptr<FileLocation> _image; // the file location of the function's container image
+        sg_size_t _snapshot_size; // the size of the function's initialized memory snapshot (0 if none)
     };
     
     /***********************/
@@ -17,6 +17,7 @@
 #include <wrench/services/compute/serverless/Invocation.h>
 
 #include "wrench/services/Service.h"
+#include "wrench/simulation/SimulationMessageHandlerTable.h"
 #include "wrench/services/storage/storage_helpers/FileLocation.h"
 #include "wrench/managers/function_manager/FunctionInput.h"
 
@@ -28,6 +29,8 @@ namespace wrench {
 
     class ServerlessComputeService;
 
+    class ServerlessFrontEnd;
+
     class StorageService;
 
     class FailureCause;
@@ -48,7 +51,8 @@ namespace wrench {
         static std::shared_ptr<Function> createFunction(const std::string& name,
                                                         const std::function<std::shared_ptr<FunctionOutput>(const std::shared_ptr<FunctionInput>&,
                                                         const std::shared_ptr<StorageService>&)>& lambda,
-                                                        const std::shared_ptr<FileLocation>& image);
+                                                        const std::shared_ptr<FileLocation>& image,
+                                                        sg_size_t snapshot_size_in_bytes = 0);
 
         std::shared_ptr<RegisteredFunction> registerFunction(const std::shared_ptr<Function>& function,
                               const std::shared_ptr<ServerlessComputeService>& compute_service,
@@ -58,9 +62,23 @@ namespace wrench {
                               sg_size_t ingress_in_bytes,
                               sg_size_t egress_in_bytes);
 
+        std::shared_ptr<RegisteredFunction> registerFunction(const std::shared_ptr<Function>& function,
+                              const std::shared_ptr<ServerlessFrontEnd>& front_end,
+                              double time_limit_in_seconds,
+                              sg_size_t disk_space_limit_in_bytes,
+                              sg_size_t RAM_limit_in_bytes,
+                              sg_size_t ingress_in_bytes,
+                              sg_size_t egress_in_bytes);
+
         std::shared_ptr<Invocation> invokeFunction(const std::shared_ptr<RegisteredFunction> &registered_function,
                                                     const std::shared_ptr<ServerlessComputeService>& sl_compute_service,
-                                                    const std::shared_ptr<FunctionInput>& function_input);
+                                                    const std::shared_ptr<FunctionInput>& function_input,
+                                                    double deadline_in_seconds = -1.0);
+
+        std::shared_ptr<Invocation> invokeFunction(const std::shared_ptr<RegisteredFunction> &registered_function,
+                                                    const std::shared_ptr<ServerlessFrontEnd>& front_end,
+                                                    const std::shared_ptr<FunctionInput>& function_input,
+                                                    double deadline_in_seconds = -1.0);
 
         bool isDone(const std::shared_ptr<Invocation>& invocation);
         void wait_one(const std::shared_ptr<Invocation>& invocation);
@@ -86,6 +104,8 @@ namespace wrench {
 
         bool processNextMessage();
 
+        void initMessageHandlers();
+
         void processFunctionInvocationComplete(const std::shared_ptr<Invocation>& invocation, bool success, const std::shared_ptr<FailureCause>& failure_cause);
 
         void processWaitOne(const std::shared_ptr<Invocation>& invocation, S4U_CommPort* answer_commport);
@@ -96,6 +116,8 @@ namespace wrench {
 
         S4U_CommPort *creator_commport;
 
+        SimulationMessageHandlerTable<> message_handlers;
+
         // FunctionManager internal data structures
         std::set<std::shared_ptr<RegisteredFunction>> _registered_functions; // do we store these here or in the Serverless Compute Service?
         std::queue<std::shared_ptr<RegisteredFunction>> _functions_to_invoke;
@@ -15,6 +15,7 @@
 #include <set>
 
 #include "wrench/services/Service.h"
+#include "wrench/simulation/SimulationMessageHandlerTable.h"
 #include "wrench/services/storage/storage_helpers/FileLocation.h"
 
 
@@ -136,6 +137,12 @@ namespace wrench {
 
         bool processNextMessage();
 
+        void initMessageHandlers();
+
+        void processCompoundJobDoneMessage(const std::shared_ptr<CompoundJob> &job, const std::shared_ptr<ComputeService> &compute_service);
+
+        void processCompoundJobFailedMessage(const std::shared_ptr<CompoundJob> &job, const std::shared_ptr<ComputeService> &compute_service);
+
         void
         processStandardJobCompletion(const std::shared_ptr<StandardJob> &job, std::shared_ptr<ComputeService> compute_service);
 
@@ -157,6 +164,8 @@ namespace wrench {
         // CommPort of the creator of this job manager
         S4U_CommPort *creator_commport;
 
+        SimulationMessageHandlerTable<> message_handlers;
+
         std::vector<std::shared_ptr<CompoundJob>> jobs_to_dispatch;
         std::set<std::shared_ptr<CompoundJob>> jobs_dispatched;
 
@@ -15,6 +15,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "wrench/simgrid_S4U_util/S4U_Daemon.h"
 #include "wrench/services/ServiceProperty.h"
@@ -140,10 +141,52 @@ namespace wrench {
         bool shutting_down = false;
 
     private:
+        /**
+         * @brief A property value, parsed once when the property is set so that
+         *        typed property lookups do not parse strings
+         */
+        struct ParsedPropertyValue {
+            /** @brief Whether the property is set **/
+            bool is_set = false;
+            /** @brief Whether the value is a valid double **/
+            bool is_double = false;
+            /** @brief The value as a double **/
+            double as_double = 0.0;
+            /** @brief Whether the value is a valid unsigned long **/
+            bool is_unsigned_long = false;
+            /** @brief The value as an unsigned long **/
+            unsigned long as_unsigned_long = 0;
+            /** @brief Whether the value is a valid boolean **/
+            bool is_boolean = false;
+            /** @brief The value as a boolean **/
+            bool as_boolean = false;
+            /** @brief Whether the value has been parsed as a time **/
+            bool is_time = false;
+            /** @brief The value as a time in seconds **/
+            double as_time = 0.0;
+            /** @brief Whether the value has been parsed as a size **/
+            bool is_size = false;
+            /** @brief The value as a size in bytes **/
+            sg_size_t as_size = 0;
+            /** @brief Whether the value has been parsed as a bandwidth **/
+            bool is_bandwidth = false;
+            /** @brief The value as a bandwidth in bytes per second **/
+            double as_bandwidth = 0.0;
+        };
+
+        ParsedPropertyValue &getParsedPropertyValue(WRENCH_PROPERTY_TYPE property, const std::string &caller);
+
         double getPropertyValueWithUnitsAsValue(
                 WRENCH_PROPERTY_TYPE property,
                 const std::function<double(std::string &s)> &unit_parsing_function);
 
+        /** @brief The service's parsed property values, indexed by property **/
+        std::vector<ParsedPropertyValue> parsed_property_values;
+        /** @brief The service's message payload values, indexed by message payload **/
+        std::vector<sg_size_t> messagepayload_values;
+        /** @brief Whether each message payload is set, indexed by message payload **/
+        std::vector<bool> messagepayload_is_set;
+
         static std::set<std::shared_ptr<Service>> servicesSetToAutoRestart;
 
         /***********************/
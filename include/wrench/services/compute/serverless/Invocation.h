@@ -11,6 +11,7 @@
 #ifndef INVOCATION_H
 #define INVOCATION_H
 
+#include <list>
 #include <memory>
 #include <wrench/managers/function_manager/Function.h>
 #include <wrench/managers/function_manager/RegisteredFunction.h>
@@ -44,10 +45,14 @@ namespace wrench {
         [[nodiscard]] double getSubmitDate() const;
         [[nodiscard]] double getStartDate() const;
         [[nodiscard]] double getEndDate() const;
+        [[nodiscard]] double getDeadline() const;
+        [[nodiscard]] bool hasDeadline() const;
+        [[nodiscard]] bool hasMissedDeadline() const;
 
     private:
         friend class FunctionManager;
         friend class ServerlessComputeService;
+        friend class ServerlessStateOfTheSystem;
 
         const std::shared_ptr<RegisteredFunction> _registered_function; // the registered function to be invoked
         std::shared_ptr<FunctionInput> _function_input; // the input for the function
@@ -64,14 +69,21 @@ namespace wrench {
         std::shared_ptr<FileLocation> _tmp_ram_file_location;
         std::shared_ptr<simgrid::fsmod::File> _opened_tmp_ram_file;
 
+        std::shared_ptr<FileLocation> _snapshot_location; // the function's snapshot at the target host (if any)
+        std::shared_ptr<simgrid::fsmod::File> _opened_snapshot_file; // opened if the snapshot is being restored
+        sg_size_t _snapshot_bytes_to_restore = 0; // number of snapshot bytes read before running the function
+        bool _writes_snapshot = false; // whether the invocation writes the function's snapshot at the target host
+
         double _submit_date = -1.0;
         double _start_date = -1.0;
         double _end_date = -1.0;
+        double _deadline = -1.0; // absolute date by which the invocation should complete (-1.0 if none)
 
         std::string _target_host;
 
-
-
+        // position of the invocation in the head node's schedulable queue (valid only if _is_schedulable is true)
+        std::list<std::shared_ptr<Invocation>>::iterator _schedulable_queue_position;
+        bool _is_schedulable = false;
     };
 }
 
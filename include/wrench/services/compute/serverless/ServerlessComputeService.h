@@ -21,6 +21,7 @@
 #include "wrench/services/compute/serverless/ServerlessComputeServiceProperty.h"
 #include "wrench/services/compute/serverless/ServerlessScheduler.h"
 #include "wrench/services/compute/serverless/ServerlessStateOfTheSystem.h"
+#include "wrench/simulation/SimulationMessageHandlerTable.h"
 
 namespace wrench {
     /**
@@ -31,6 +32,9 @@ namespace wrench {
     private:
         WRENCH_PROPERTY_COLLECTION_TYPE default_property_values = {
             {ServerlessComputeServiceProperty::CONTAINER_STARTUP_OVERHEAD, "0"},
+            {ServerlessComputeServiceProperty::COLD_START_MODEL, "container"},
+            {ServerlessComputeServiceProperty::SNAPSHOT_LAZY_RESTORE, "false"},
+            {ServerlessComputeServiceProperty::SNAPSHOT_WORKING_SET_FRACTION, "1.0"},
             {ServerlessComputeServiceProperty::SCRATCH_SPACE_BUFFER_SIZE, "0"}
         };
 
@@ -69,12 +73,21 @@ namespace wrench {
         bool supportsCompoundJobs() override;
         bool supportsPilotJobs() override;
 
+        unsigned long getNumOutstandingInvocationsZeroTime() const;
+        double getLoadZeroTime() const;
+        unsigned long getNumCompletedInvocationsWithDeadlineZeroTime() const;
+        unsigned long getNumSLOViolationsZeroTime() const;
+        unsigned long getNumHeadStorageImageEvictionsZeroTime() const;
+        unsigned long getNumSnapshotRestoresZeroTime() const;
+
     protected:
         friend class FunctionManager;
+        friend class ServerlessFrontEnd;
 
         std::shared_ptr<Invocation> invokeFunction(const std::shared_ptr<RegisteredFunction>& registered_function,
                                                    const std::shared_ptr<FunctionInput>& input,
-                                                   S4U_CommPort* notify_commport);
+                                                   S4U_CommPort* notify_commport,
+                                                   double deadline_in_seconds = -1.0);
 
         std::shared_ptr<RegisteredFunction> registerFunction(const std::shared_ptr<Function>& function,
                                                              double time_limit_in_seconds,
@@ -112,7 +125,8 @@ namespace wrench {
         void processFunctionInvocationRequest(S4U_CommPort* answer_commport,
                                               const std::shared_ptr<RegisteredFunction>& registered_function,
                                               const std::shared_ptr<FunctionInput>& input,
-                                              S4U_CommPort* notify_commport);
+                                              S4U_CommPort* notify_commport,
+                                              double deadline_in_seconds);
 
         void processImageDownloadCompletion(const std::shared_ptr<Action>& action,
                                             const std::shared_ptr<DataFile>& image_file);
@@ -120,6 +134,10 @@ namespace wrench {
         void processInvocationCompletion(const std::shared_ptr<Invocation> &invocation, const std::shared_ptr<Action>& action);
 
         void admitInvocations();
+
+        bool evictHeadStorageImages(sg_size_t space_needed);
+
+        double prepareColdStart(const std::shared_ptr<Invocation>& invocation, const std::string& target_host);
         std::shared_ptr<SchedulingDecisions> invokeScheduler() const;
         void dispatchInvocations(const std::shared_ptr<SchedulingDecisions>& decisions);
         void initiateImageLoads(const std::shared_ptr<SchedulingDecisions>& decisions);
@@ -127,6 +145,16 @@ namespace wrench {
 
         bool processNextMessage(bool& do_scheduling);
 
+        void initMessageHandlers();
+
+        bool processImageCopyCompletion(const std::shared_ptr<Action>& action,
+                                        const std::shared_ptr<DataFile>& image_file,
+                                        const std::string& compute_host);
+
+        bool processImageLoadCompletion(const std::shared_ptr<Action>& action,
+                                        const std::shared_ptr<DataFile>& image_file,
+                                        const std::string& compute_host);
+
         std::map<std::string, double> constructResourceInformation(const std::string& key) override;
 
 
@@ -149,6 +177,10 @@ namespace wrench {
         sg_size_t ram_of_compute_host;
         sg_size_t disk_space_of_compute_host;
 
+        bool use_snapshots; // whether the "snapshot" cold start model is used
+
+        // message handlers (the additional argument is set to whether scheduling should happen after the message)
+        SimulationMessageHandlerTable<bool&> message_handlers;
     };
 };
 
@@ -73,7 +73,7 @@ namespace wrench {
      */
     class ServerlessComputeServiceFunctionInvocationRequestMessage : public ServerlessComputeServiceMessage {
     public:
-        ServerlessComputeServiceFunctionInvocationRequestMessage(S4U_CommPort *answer_commport, const std::shared_ptr<RegisteredFunction>& registered_function, const std::shared_ptr<FunctionInput>& function_input, S4U_CommPort *notify_commport, sg_size_t payload);
+        ServerlessComputeServiceFunctionInvocationRequestMessage(S4U_CommPort *answer_commport, const std::shared_ptr<RegisteredFunction>& registered_function, const std::shared_ptr<FunctionInput>& function_input, S4U_CommPort *notify_commport, double deadline_in_seconds, sg_size_t payload);
 
         /** @brief The commport_name to answer to */
         S4U_CommPort *answer_commport;
@@ -83,6 +83,8 @@ namespace wrench {
         std::shared_ptr<FunctionInput> function_input;
         /** @brief The commport_name to send notifications to */
         S4U_CommPort *notify_commport;
+        /** @brief The invocation's deadline, relative to the invocation date (-1.0 if none) */
+        double deadline_in_seconds;
     };
 
     /**
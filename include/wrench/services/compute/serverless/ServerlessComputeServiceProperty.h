@@ -27,6 +27,25 @@ namespace wrench {
          *         Examples: "5", "5s", "5000ms", etc.
          **/
         DECLARE_PROPERTY_NAME(CONTAINER_STARTUP_OVERHEAD);
+
+        /** @brief The cold start model (default value: "container"):
+         *         - "container": every invocation pays the CONTAINER_STARTUP_OVERHEAD
+         *         - "snapshot": for functions that have a snapshot (see FunctionManager::createFunction()), the first
+         *           invocation at a compute node pays the CONTAINER_STARTUP_OVERHEAD and then writes the function's
+         *           snapshot to the node's disk. Later invocations at that node (while the snapshot has not been
+         *           evicted from disk) instead restore the snapshot, i.e., read it from disk.
+         **/
+        DECLARE_PROPERTY_NAME(COLD_START_MODEL);
+
+        /** @brief Whether snapshots are restored lazily, i.e., only the pages that the function touches are
+         *         read from disk, rather than the whole snapshot (default value: "false")
+         **/
+        DECLARE_PROPERTY_NAME(SNAPSHOT_LAZY_RESTORE);
+
+        /** @brief The fraction of a snapshot that a function touches, and that is thus read from disk when the
+         *         snapshot is restored lazily (default value: "1.0")
+         **/
+        DECLARE_PROPERTY_NAME(SNAPSHOT_WORKING_SET_FRACTION);
     };
 
 }// namespace wrench
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SERVERLESSFRONTEND_H
+#define WRENCH_SERVERLESSFRONTEND_H
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <wrench/managers/function_manager/Function.h>
+#include <wrench/managers/function_manager/RegisteredFunction.h>
+#include <wrench/services/compute/serverless/Invocation.h>
+
+namespace wrench {
+
+    class ServerlessComputeService;
+
+    /**
+     * @brief A front-end that shards function registrations and invocations across several
+     *        serverless compute services (e.g., one per region). The front-end does not run
+     *        its own daemon: shard selection happens in the invoking actor, so that the
+     *        head-node actors of the shards are the only serialization points.
+     */
+    class ServerlessFrontEnd {
+    public:
+        /**
+         * @brief The policy used to pick the shard to which an invocation is sent
+         */
+        enum ShardingPolicy {
+            /** @brief Invocations of a function always go to the same shard (hash of the function name on a ring) */
+            CONSISTENT_HASHING,
+            /** @brief Invocations go to the shard with the lowest load */
+            LEAST_LOADED,
+            /** @brief Invocations go to the least loaded of two randomly picked shards */
+            POWER_OF_TWO_CHOICES
+        };
+
+        ServerlessFrontEnd(const std::vector<std::shared_ptr<ServerlessComputeService>>& shards,
+                           ShardingPolicy policy = CONSISTENT_HASHING,
+                           double spillover_load_threshold = 1.0,
+                           unsigned long seed = 42);
+
+        [[nodiscard]] const std::vector<std::shared_ptr<ServerlessComputeService>>& getShards() const;
+        [[nodiscard]] ShardingPolicy getShardingPolicy() const;
+        [[nodiscard]] unsigned long getNumSpillovers() const;
+        [[nodiscard]] std::map<std::shared_ptr<ServerlessComputeService>, unsigned long> getNumInvocationsPerShard() const;
+
+        std::shared_ptr<ServerlessComputeService> getHomeShard(const std::shared_ptr<Function>& function) const;
+
+    protected:
+        friend class FunctionManager;
+
+        std::shared_ptr<RegisteredFunction> registerFunction(const std::shared_ptr<Function>& function,
+                                                             double time_limit_in_seconds,
+                                                             sg_size_t disk_space_limit_in_bytes,
+                                                             sg_size_t RAM_limit_in_bytes,
+                                                             sg_size_t ingress_in_bytes,
+                                                             sg_size_t egress_in_bytes);
+
+        std::shared_ptr<Invocation> invokeFunction(const std::shared_ptr<RegisteredFunction>& registered_function,
+                                                   const std::shared_ptr<FunctionInput>& input,
+                                                   S4U_CommPort* notify_commport,
+                                                   double deadline_in_seconds = -1.0);
+
+    private:
+        /** @brief Number of points each shard has on the consistent hashing ring */
+        static constexpr unsigned long NUM_VIRTUAL_NODES_PER_SHARD = 64;
+
+        unsigned long getHomeShardIndex(const std::shared_ptr<Function>& function) const;
+        unsigned long pickShardIndex(const std::shared_ptr<Function>& function);
+        unsigned long spillOver(unsigned long shard_index, const std::shared_ptr<Function>& function);
+        double getShardLoad(unsigned long shard_index) const;
+
+        std::vector<std::shared_ptr<ServerlessComputeService>> _shards;
+        ShardingPolicy _policy;
+        double _spillover_load_threshold;
+        std::mt19937 _rng;
+
+        // hash ring: hash value -> shard index
+        std::map<size_t, unsigned long> _ring;
+        // function -> registered functions (one per shard, indexed by shard index)
+        std::unordered_map<std::shared_ptr<Function>, std::vector<std::shared_ptr<RegisteredFunction>>> _registrations;
+
+        unsigned long _num_spillovers = 0;
+        std::vector<unsigned long> _num_invocations_per_shard;
+    };
+
+} // namespace wrench
+
+#endif // WRENCH_SERVERLESSFRONTEND_H
@@ -12,6 +12,7 @@
 
 #include <wrench/services/compute/serverless/Invocation.h>
 #include <wrench/services/compute/serverless/ServerlessStateOfTheSystem.h>
+#include <list>
 #include <vector>
 #include <string>
 
@@ -47,7 +48,7 @@ namespace wrench {
          * @return A SchedulingDecisions object
          */
         virtual std::shared_ptr<SchedulingDecisions> schedule(
-            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
             const std::shared_ptr<ServerlessStateOfTheSystem>& state
         ) = 0;
 
@@ -10,10 +10,12 @@
 #ifndef WRENCH_SERVERLESSSTATEOFTHESYSTEM_H
 #define WRENCH_SERVERLESSSTATEOFTHESYSTEM_H
 
+#include <list>
 #include <vector>
 #include <map>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <memory>
 #include <string>
 #include <wrench/services/compute/serverless/Invocation.h>
@@ -43,6 +45,21 @@ namespace wrench
         bool isImageInRAMAtNode(const std::string &node, const std::shared_ptr<DataFile> &image);
         bool isImageBeingLoadedAtNode(const std::string &node, const std::shared_ptr<DataFile> &image);
 
+        unsigned long getNumOutstandingInvocations() const;
+        unsigned long getTotalNumCores() const;
+
+        double getEstimatedRuntime(const std::shared_ptr<RegisteredFunction>& registered_function) const;
+        unsigned long getNumCompletedInvocationsWithDeadline() const;
+        unsigned long getNumSLOViolations() const;
+
+        std::shared_ptr<DataFile> getSnapshotFile(const std::shared_ptr<Function>& function) const;
+        bool isSnapshotOnNode(const std::string& node, const std::shared_ptr<Function>& function);
+        unsigned long getNumSnapshotRestores() const;
+
+        sg_size_t getFreeSpaceOnHeadStorage() const;
+        bool isImageOnHeadStoragePinned(const std::shared_ptr<DataFile>& image) const;
+        unsigned long getNumHeadStorageImageEvictions() const;
+
         ~ServerlessStateOfTheSystem() = default;
 
     private:
@@ -50,6 +67,20 @@ namespace wrench
 
         explicit ServerlessStateOfTheSystem(const std::vector<std::string>& compute_hosts);
 
+        void updateEstimatedRuntime(const std::shared_ptr<RegisteredFunction>& registered_function, double runtime);
+
+        void addSchedulableInvocation(const std::shared_ptr<Invocation>& invocation, bool at_front);
+        void removeSchedulableInvocation(const std::shared_ptr<Invocation>& invocation);
+
+        void touchHeadStorageImage(const std::shared_ptr<DataFile>& image);
+        void pinHeadStorageImage(const std::shared_ptr<DataFile>& image);
+        void unpinHeadStorageImage(const std::shared_ptr<DataFile>& image);
+        std::vector<std::shared_ptr<DataFile>> pickHeadStorageImagesToEvict(sg_size_t space_needed) const;
+        void forgetHeadStorageImage(const std::shared_ptr<DataFile>& image);
+
+        /** @brief Weight of the most recent observation in runtime estimates (exponential moving average) */
+        static constexpr double RUNTIME_ESTIMATE_SMOOTHING_FACTOR = 0.3;
+
         // set of Registered functions
         std::set<std::shared_ptr<RegisteredFunction>> _registered_functions;
         // vector of compute host names
@@ -64,12 +95,23 @@ namespace wrench
         std::queue<std::shared_ptr<Invocation>> _new_invocations;
         // queues of function invocations whose images are being downloaded
         std::map<std::shared_ptr<DataFile>, std::queue<std::shared_ptr<Invocation>>> _admitted_invocations;
-        // queue of function invocations whose images have been downloaded
-        std::vector<std::shared_ptr<Invocation>> _schedulable_invocations;
+        // queue of function invocations whose images have been downloaded (each invocation
+        // keeps its position in the list, so that it can be removed in constant time once dispatched)
+        std::list<std::shared_ptr<Invocation>> _schedulable_invocations;
         // queue of function invocations currently running
         std::queue<std::shared_ptr<Invocation>> _running_invocations;
         // queue of function invocations that have finished executing
         std::queue<std::shared_ptr<Invocation>> _finished_invocations;
+        // number of accepted function invocations that have not completed yet
+        unsigned long _num_outstanding_invocations;
+        // total number of cores over all compute hosts
+        unsigned long _total_num_cores;
+        // estimated runtime of each registered function, learned from completed invocations
+        std::unordered_map<std::shared_ptr<RegisteredFunction>, double> _estimated_runtimes;
+        // number of completed function invocations that had a deadline
+        unsigned long _num_completed_invocations_with_deadline;
+        // number of completed function invocations that have missed their deadline
+        unsigned long _num_slo_violations;
 
         std::string _head_storage_service_mount_point;
         // std::vector<std::shared_ptr<BareMetalComputeService>> _compute_services;
@@ -78,9 +120,21 @@ namespace wrench
         std::shared_ptr<StorageService> _head_storage_service;
         std::set<std::shared_ptr<DataFile>> _being_downloaded_image_files;
         sg_size_t _free_space_on_head_storage; // We keep track of it ourselves to avoid concurrency shenanigans
+        // images stored on the head node, from least to most recently used, and their positions in that list
+        std::list<std::shared_ptr<DataFile>> _head_storage_lru_images;
+        std::unordered_map<std::shared_ptr<DataFile>, std::list<std::shared_ptr<DataFile>>::iterator> _head_storage_lru_positions;
+        // number of schedulable invocations and in-flight copies that need each image on the head node
+        std::unordered_map<std::shared_ptr<DataFile>, unsigned long> _head_storage_pin_counts;
+        // number of images evicted from the head node so far
+        unsigned long _num_head_storage_image_evictions;
 
         std::unordered_map<std::string, std::set<std::shared_ptr<DataFile>>> _being_copied_images;
         std::unordered_map<std::string, std::set<std::shared_ptr<DataFile>>> _being_loaded_images;
+
+        // snapshot file of each function that has one (only used with the "snapshot" cold start model)
+        std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<DataFile>> _snapshot_files;
+        std::unordered_map<std::string, std::set<std::shared_ptr<DataFile>>> _being_written_snapshots;
+        unsigned long _num_snapshot_restores;
     };
 
     /***********************/
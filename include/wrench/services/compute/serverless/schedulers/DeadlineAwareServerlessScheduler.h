@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_DEADLINE_AWARE_SERVERLESS_SCHEDULER_H
+#define WRENCH_DEADLINE_AWARE_SERVERLESS_SCHEDULER_H
+
+#include <wrench/services/compute/serverless/schedulers/FCFSServerlessScheduler.h>
+
+namespace wrench {
+    /**
+     * @brief A class that implements a deadline-aware scheduler to use in a serverless compute
+     *        service. Schedulable invocations are ordered by deadline (EDF) or by slack, i.e., time
+     *        to deadline minus the function's estimated runtime (least slack first), and then placed
+     *        in that order as done by the FCFS scheduler. Invocations without a deadline come last.
+     */
+    class DeadlineAwareServerlessScheduler : public FCFSServerlessScheduler {
+    public:
+        /**
+         * @brief The order in which schedulable invocations are considered
+         */
+        enum Ordering {
+            /** @brief Earliest deadline first */
+            EARLIEST_DEADLINE_FIRST,
+            /** @brief Least slack (deadline - now - estimated runtime) first */
+            LEAST_SLACK_FIRST
+        };
+
+        explicit DeadlineAwareServerlessScheduler(Ordering ordering = EARLIEST_DEADLINE_FIRST);
+
+        ~DeadlineAwareServerlessScheduler() override = default;
+
+        std::shared_ptr<SchedulingDecisions> schedule(
+            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
+            const std::shared_ptr<ServerlessStateOfTheSystem>& state) override;
+
+    private:
+        Ordering _ordering;
+    };
+} // namespace wrench
+
+#endif // WRENCH_DEADLINE_AWARE_SERVERLESS_SCHEDULER_H
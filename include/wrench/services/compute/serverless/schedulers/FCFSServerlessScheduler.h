@@ -19,16 +19,16 @@ namespace wrench {
         ~FCFSServerlessScheduler() override = default;
 
         std::shared_ptr<SchedulingDecisions> schedule(
-            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
             const std::shared_ptr<ServerlessStateOfTheSystem>& state) override;
 
     private:
         void makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                 const std::shared_ptr<ServerlessStateOfTheSystem>& state);
 
         void makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                     const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                     const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                      const std::shared_ptr<ServerlessStateOfTheSystem>& state);
     };
 } // namespace wrench
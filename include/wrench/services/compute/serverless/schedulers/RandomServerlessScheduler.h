@@ -19,7 +19,7 @@ namespace wrench {
         ~RandomServerlessScheduler() override = default;
 
         std::shared_ptr<SchedulingDecisions> schedule(
-            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
             const std::shared_ptr<ServerlessStateOfTheSystem>& state
         ) override;
 
@@ -27,11 +27,11 @@ namespace wrench {
         std::mt19937 rng;
 
         void makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                 const std::shared_ptr<ServerlessStateOfTheSystem>& state);
 
         void makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                     const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                     const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                      const std::shared_ptr<ServerlessStateOfTheSystem>& state);
     };
 }
@@ -22,17 +22,17 @@ namespace wrench {
         ~WorkloadBalancingServerlessScheduler() override = default;
 
         std::shared_ptr<SchedulingDecisions> schedule(
-            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
             const std::shared_ptr<ServerlessStateOfTheSystem>& state
         ) override;
 
     private:
         void makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                 const std::shared_ptr<ServerlessStateOfTheSystem>& state);
 
         void makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                     const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                     const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                      const std::shared_ptr<ServerlessStateOfTheSystem>& state);
 
 
@@ -46,7 +46,7 @@ namespace wrench {
         std::unordered_map<std::string, std::unordered_map<std::string, unsigned>> allocation_plan;
 
         // Helper to calculate workloads for each function type
-        void calculateFunctionWorkloads(const std::vector<std::shared_ptr<Invocation>>& invocations);
+        void calculateFunctionWorkloads(const std::list<std::shared_ptr<Invocation>>& invocations);
 
         // Helper to create allocation plan
         void createAllocationPlan(const std::shared_ptr<ServerlessStateOfTheSystem>& state);
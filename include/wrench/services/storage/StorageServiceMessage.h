@@ -283,7 +283,9 @@ namespace wrench {
 	 *
 	 * @param location: the file location
 	 **/
-        explicit StorageServiceAckMessage(std::shared_ptr<FileLocation> location) : StorageServiceMessage(S4U_CommPort::default_control_message_size), location(std::move(location)) {}
+        explicit StorageServiceAckMessage(std::shared_ptr<FileLocation> location) : StorageServiceMessage(S4U_CommPort::default_control_message_size), location(std::move(location)) {
+            this->kind = SimulationMessage::getKindOf<StorageServiceAckMessage>();
+        }
 
         /** @brief The location */
         std::shared_ptr<FileLocation> location;
@@ -77,7 +77,9 @@ namespace wrench {
                                                                                                            answer_commport_if_write(answer_commport_if_write),
                                                                                                            answer_commport_if_copy(answer_commport_if_copy),
                                                                                                            success(success),
-                                                                                                           failure_cause(failure_cause) {}
+                                                                                                           failure_cause(failure_cause) {
+            this->kind = SimulationMessage::getKindOf<FileTransferThreadNotificationMessage>();
+        }
 
         /** @brief File transfer thread that sent this message */
         std::shared_ptr<FileTransferThread> file_transfer_thread;
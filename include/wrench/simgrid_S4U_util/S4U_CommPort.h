@@ -141,11 +141,21 @@ namespace wrench {
         static void retireTemporaryCommPort(S4U_CommPort *commport);
         static void createCommPortPool();
 
+        static unsigned long getCommPortPoolSize();
+        static unsigned long getNumUsedCommPorts();
+        static unsigned long getMaxNumUsedCommPorts();
+        static unsigned long getNumCommPortPoolGrowths();
+
         /**
-         * @brief The commport_name pool size
+         * @brief The initial commport pool size
          */
         static unsigned long commport_pool_size;
 
+        /**
+         * @brief The number of commports added to the pool whenever it runs out of free commports
+         */
+        static unsigned long commport_pool_chunk_size;
+
         /**
          * @brief The default control message size
          */
@@ -187,9 +197,12 @@ namespace wrench {
         simgrid::s4u::CommPtr mb_comm;
         bool mq_comm_posted = false;
         simgrid::s4u::MessPtr mq_comm;
+        simgrid::s4u::ActivitySet pending_receives;
 
         std::unique_ptr<SimulationMessage> getMessage(bool log);
         std::unique_ptr<SimulationMessage> getMessage(double timeout, bool log);
+        SimulationMessage *getAvailableMessage();
+        SimulationMessage *waitForMessage(double timeout);
 
 
         void templateWaitingLog(const std::string &type, unsigned long long id);
@@ -201,8 +214,13 @@ namespace wrench {
         static std::deque<S4U_CommPort *> free_commports;
         static std::set<S4U_CommPort *> used_commports;
         static std::deque<S4U_CommPort *> commports_to_drain;
+        static unsigned long max_num_used_commports;
+        static unsigned long num_commport_pool_growths;
         static unsigned long long messageCounter;
 
+        static void growCommPortPool(unsigned long num_commports);
+        static bool reclaimDrainedCommPorts();
+
 
         std::string name;
     };
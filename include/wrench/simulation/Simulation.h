@@ -12,6 +12,7 @@
 #define WRENCH_SIMULATION_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include <wrench/services/compute/bare_metal/BareMetalComputeServiceOneShot.h>
@@ -88,6 +89,8 @@ namespace wrench {
         static std::shared_ptr<DataFile> getFileByIDOrNull(const std::string &id);
         static std::shared_ptr<DataFile> addFile(const std::string &id, sg_size_t size);
         static std::shared_ptr<DataFile> addFile(const std::string &id, const std::string &size);
+        static std::shared_ptr<DataFile> addScratchFile(sg_size_t size);
+        static unsigned long getNumFiles();
 
 
         void launch();
@@ -267,8 +270,14 @@ namespace wrench {
 
         static bool surf_precision_set_by_user;
 
-        /* Map of files */
-        static std::map<std::string, std::shared_ptr<DataFile>> data_files;
+        /* Registered files, indexed by file ID */
+        static std::unordered_map<std::string, std::shared_ptr<DataFile>> data_files;
+        /* Ordered view of the registered files, rebuilt lazily by getFileMap() */
+        static std::map<std::string, std::shared_ptr<DataFile>> data_file_map;
+        /* Whether data_file_map reflects the registered files */
+        static bool data_file_map_is_up_to_date;
+        /* Number of scratch files created so far */
+        static unsigned long num_scratch_files;
     };
 
 
@@ -11,6 +11,7 @@
 #ifndef WRENCH_SIMGRIDMESSAGES_H
 #define WRENCH_SIMGRIDMESSAGES_H
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <iostream>
@@ -32,12 +33,47 @@ namespace wrench {
         explicit SimulationMessage(sg_size_t payload);
         virtual ~SimulationMessage();
 
+        static void *operator new(std::size_t size);
+        static void operator delete(void *ptr, std::size_t size);
+
         virtual std::string getName();
 
+        /**
+         * @brief Retrieve the message kind, i.e., a small integer that uniquely identifies the message's
+         *        (dynamic) type, and that can be used to index handler tables. The kind is set by the
+         *        constructor of each message type (so a type derived from a message type that sets a kind
+         *        must set its own kind), and is UNKNOWN_KIND for a message type that doesn't set it.
+         * @return the kind
+         */
+        unsigned long getKind() const {
+            return this->kind;
+        }
+
+        /**
+         * @brief Get the kind of a message type (assigned the first time this method is called for that type)
+         * @tparam T a message type
+         * @return a message kind
+         */
+        template<class T>
+        static unsigned long getKindOf() {
+            static const unsigned long kind = allocateKind();
+            return kind;
+        }
+
+        /** @brief The kind of messages whose type doesn't set a kind in its constructor */
+        static constexpr unsigned long UNKNOWN_KIND = ~0UL;
+
         /** @brief The message name */
         //std::string name;//we dont need this anymore :)
         /** @brief The message size in bytes */
         sg_size_t payload;
+
+    protected:
+        /** @brief The message kind (set by the constructor of the message's type) */
+        unsigned long kind = UNKNOWN_KIND;
+
+    private:
+        static unsigned long allocateKind();
     };
 
 
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONMESSAGEHANDLERTABLE_H
+#define WRENCH_SIMULATIONMESSAGEHANDLERTABLE_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <wrench/simulation/SimulationMessage.h>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A table of message handlers, used by a service's main loop to dispatch a received
+     *        message to its handler with a single indexed lookup (on the message's kind) instead of
+     *        a chain of dynamic casts. Handlers are considered in the order in which they were added,
+     *        and a message is dispatched to the first handler whose message type it derives from (i.e.,
+     *        exactly like a chain of dynamic casts). That resolution is done once per message kind
+     *        and then cached, except for messages whose type doesn't set a kind (e.g., message types
+     *        defined outside WRENCH), for which it is done on each dispatch.
+     *
+     * @tparam Args types of additional arguments passed to handlers
+     */
+    template<typename... Args>
+    class SimulationMessageHandlerTable {
+    public:
+        /**
+         * @brief Add a handler for a message type
+         * @tparam T the message type
+         * @param handler the handler, which returns the value to be returned by dispatch()
+         */
+        template<class T>
+        void add(std::function<bool(const std::shared_ptr<T> &, Args...)> handler) {
+            this->handlers.push_back(
+                    {[](SimulationMessage *message) { return dynamic_cast<T *>(message) != nullptr; },
+                     [handler](const std::shared_ptr<SimulationMessage> &message, Args... args) {
+                         return handler(std::static_pointer_cast<T>(message), args...);
+                     }});
+            this->resolved_handlers.clear();
+        }
+
+        /**
+         * @brief Dispatch a message to its handler
+         * @param message the message
+         * @param handled set to true if a handler was found, false otherwise
+         * @param args additional arguments passed to the handler
+         * @return the value returned by the handler (false if no handler was found)
+         */
+        bool dispatch(const std::shared_ptr<SimulationMessage> &message, bool &handled, Args... args) {
+            auto kind = message->getKind();
+            if (kind == SimulationMessage::UNKNOWN_KIND) {
+                for (auto const &entry: this->handlers) {
+                    if (entry.matches(message.get())) {
+                        handled = true;
+                        return entry.handle(message, args...);
+                    }
+                }
+                handled = false;
+                return false;
+            }
+            if (kind >= this->resolved_handlers.size()) {
+                this->resolved_handlers.resize(kind + 1, UNRESOLVED);
+            }
+            if (this->resolved_handlers[kind] == UNRESOLVED) {
+                this->resolved_handlers[kind] = NO_HANDLER;
+                for (unsigned long i = 0; i < this->handlers.size(); i++) {
+                    if (this->handlers[i].matches(message.get())) {
+                        this->resolved_handlers[kind] = (long) i;
+                        break;
+                    }
+                }
+            }
+            if (this->resolved_handlers[kind] == NO_HANDLER) {
+                handled = false;
+                return false;
+            }
+            handled = true;
+            return this->handlers[this->resolved_handlers[kind]].handle(message, args...);
+        }
+
+    private:
+        static constexpr long UNRESOLVED = -2;
+        static constexpr long NO_HANDLER = -1;
+
+        struct Entry {
+            std::function<bool(SimulationMessage *)> matches;
+            std::function<bool(const std::shared_ptr<SimulationMessage> &, Args...)> handle;
+        };
+
+        // handlers, in the order in which they were added
+        std::vector<Entry> handlers;
+        // index of the handler for each message kind (or UNRESOLVED/NO_HANDLER)
+        std::vector<long> resolved_handlers;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}// namespace wrench
+
+#endif//WRENCH_SIMULATIONMESSAGEHANDLERTABLE_H
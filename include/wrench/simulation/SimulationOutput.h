@@ -13,13 +13,21 @@
 #include <typeinfo>
 #include <typeindex>
 #include <iostream>
+#include <functional>
+#include <memory>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <boost/core/demangle.hpp>
 
 #include "wrench/simulation/SimulationTimestamp.h"
+#include "wrench/simulation/SimulationTimestampStream.h"
 #include "wrench/simulation/SimulationTrace.h"
 
 
 namespace wrench {
     class Simulation;
+    class JSONFileWriter;
 
     /**
      * @brief A class that contains post-mortem simulation-generated data
@@ -43,12 +51,25 @@ namespace wrench {
                 return {};
             }
 
-            std::vector<SimulationTimestamp<T> *> non_generic_vector;
-            auto trace = (SimulationTrace<T> *) (this->traces[type_index]);
-            for (auto ts: trace->getTrace()) {
-                non_generic_vector.push_back((SimulationTimestamp<T> *) ts);
+            return ((SimulationTrace<T> *) (this->traces[type_index]))->getTrace();
+        }
+
+        /**
+         * @brief Retrieve the dates of all timestamps in a simulation output trace, as a
+         *        contiguous column (in trace order) that can be scanned without dereferencing
+         *        individual timestamps
+         *
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return a vector of dates
+         */
+        template<class T>
+        const std::vector<double> &getTraceDates() {
+            static const std::vector<double> empty_dates;
+            auto it = this->traces.find(std::type_index(typeid(T)));
+            if (it == this->traces.end()) {
+                return empty_dates;
             }
-            return non_generic_vector;
+            return ((SimulationTrace<T> *) (it->second))->getDates();
         }
 
         void dumpWorkflowExecutionJSON(const std::shared_ptr<Workflow> &workflow, const std::string &file_path,
@@ -83,6 +104,11 @@ namespace wrench {
 
         void enableBandwidthTimestamps(bool enabled);
 
+        void enableTimestampStreaming(const std::string &file_path,
+                                      SimulationTimestampStream::Format format = SimulationTimestampStream::JSON_LINES);
+
+        void disableTimestampStreaming();
+
         /***********************/
         /** \cond INTERNAL     */
         /***********************/
@@ -95,23 +121,23 @@ namespace wrench {
 
         void addTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task);
 
-        void addTimestampFileReadStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                       std::shared_ptr<WorkflowTask> task = nullptr);
+        int addTimestampFileReadStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
+                                      std::shared_ptr<WorkflowTask> task = nullptr);
 
         void addTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                         std::shared_ptr<WorkflowTask> task = nullptr);
+                                         std::shared_ptr<WorkflowTask> task = nullptr, int unique_sequence_number = -1);
 
         void addTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                            std::shared_ptr<WorkflowTask> task = nullptr);
+                                            std::shared_ptr<WorkflowTask> task = nullptr, int unique_sequence_number = -1);
 
-        void addTimestampFileWriteStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                        std::shared_ptr<WorkflowTask> task = nullptr);
+        int addTimestampFileWriteStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
+                                       std::shared_ptr<WorkflowTask> task = nullptr);
 
         void addTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                          std::shared_ptr<WorkflowTask> task = nullptr);
+                                          std::shared_ptr<WorkflowTask> task = nullptr, int unique_sequence_number = -1);
 
         void addTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                             std::shared_ptr<WorkflowTask> task = nullptr);
+                                             std::shared_ptr<WorkflowTask> task = nullptr, int unique_sequence_number = -1);
 
         void addTimestampFileCopyStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src,
                                        const std::shared_ptr<FileLocation> &dst);
@@ -154,11 +180,13 @@ namespace wrench {
         */
         template<class T>
         void addTimestamp(T *timestamp) {
-            std::type_index type_index = std::type_index(typeid(T));
-            if (this->traces.find(type_index) == this->traces.end()) {
-                this->traces[type_index] = new SimulationTrace<T>();
+            if constexpr (std::is_base_of_v<SimulationTimestampPair, T>) {
+                if (this->timestamp_stream) {
+                    this->streamTimestamp<T>(timestamp);
+                    return;
+                }
             }
-            ((SimulationTrace<T> *) (this->traces[type_index]))->addTimestamp(new SimulationTimestamp<T>(timestamp));
+            this->getOrCreateTrace<T>()->addTimestamp(timestamp);
         }
 
         /***********************/
@@ -179,17 +207,109 @@ namespace wrench {
 
     private:
         std::map<std::type_index, GenericSimulationTrace *> traces;
-        nlohmann::json platform_json_part;
-        nlohmann::json workflow_exec_json_part;
-        nlohmann::json workflow_graph_json_part;
-        nlohmann::json energy_json_part;
-        nlohmann::json disk_json_part;
-        nlohmann::json bandwidth_json_part;
+
+        void forEachWorkflowExecutionTaskJSON(const std::shared_ptr<Workflow> &workflow, bool generate_host_utilization_layout,
+                                              const std::function<void(nlohmann::json)> &function);
+        void writeWorkflowExecutionJSON(JSONFileWriter &writer, const std::shared_ptr<Workflow> &workflow, bool generate_host_utilization_layout);
+        nlohmann::json buildWorkflowGraphJSON(const std::shared_ptr<Workflow> &workflow);
+        nlohmann::json buildHostEnergyConsumptionJSON();
+        nlohmann::json buildPlatformGraphJSON();
+        nlohmann::json buildDiskOperationsJSON();
+        nlohmann::json buildLinkUsageJSON();
+        static void writeJSONObject(const std::string &file_path, const std::map<std::string, std::function<void(JSONFileWriter &)>> &members);
 
         static int unique_disk_sequence_number;
+        static int unique_file_sequence_number;
 
         std::map<std::type_index, bool> enabledStatus;
 
+        std::unique_ptr<SimulationTimestampStream> timestamp_stream;
+        /* A streamed start timestamp that has not been matched by an end timestamp yet */
+        struct StreamedPendingTimestamp {
+            std::unique_ptr<SimulationTimestampPair> timestamp;
+            unsigned long sequence_number;                              // order in which the timestamp was streamed
+            void (*add_to_trace)(SimulationOutput *, SimulationTimestampPair *);// moves the timestamp to its trace
+        };
+        std::unordered_map<SimulationTimestampPair *, StreamedPendingTimestamp> streamed_pending_timestamps;
+        unsigned long streamed_timestamp_sequence_number = 0;
+
+        static nlohmann::json getTimestampFields(SimulationTimestampTask *timestamp);
+        static nlohmann::json getTimestampFields(SimulationTimestampFileRead *timestamp);
+        static nlohmann::json getTimestampFields(SimulationTimestampFileWrite *timestamp);
+        static nlohmann::json getTimestampFields(SimulationTimestampFileCopy *timestamp);
+        static nlohmann::json getTimestampFields(SimulationTimestampDiskRead *timestamp);
+        static nlohmann::json getTimestampFields(SimulationTimestampDiskWrite *timestamp);
+
+        /**
+         * @brief Retrieve a simulation output trace, creating it if it does not exist yet
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return a pointer to the trace
+         */
+        template<class T>
+        SimulationTrace<T> *getOrCreateTrace() {
+            auto &trace = this->traces[std::type_index(typeid(T))];
+            if (trace == nullptr) {
+                trace = new SimulationTrace<T>();
+            }
+            return (SimulationTrace<T> *) trace;
+        }
+
+        /**
+         * @brief Write a start/end timestamp to the timestamp stream. Start timestamps are kept in memory
+         *        until they are matched by an end timestamp, at which point both are freed. An end timestamp
+         *        whose start timestamp was not streamed (i.e., streaming was enabled in between) goes to the
+         *        in-memory trace instead, since its start timestamp still points to it.
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param timestamp: a pointer to a SimulationTimestampXXXX object
+         */
+        template<class T>
+        void streamTimestamp(T *timestamp) {
+            static const std::string type_name = [] {
+                auto name = boost::core::demangle(typeid(T).name());
+                return name.substr(name.rfind(':') + 1);
+            }();
+
+            constexpr bool is_start = std::is_same_v<T, SimulationTimestampTaskStart> or
+                                      std::is_same_v<T, SimulationTimestampFileReadStart> or
+                                      std::is_same_v<T, SimulationTimestampFileWriteStart> or
+                                      std::is_same_v<T, SimulationTimestampFileCopyStart> or
+                                      std::is_same_v<T, SimulationTimestampDiskReadStart> or
+                                      std::is_same_v<T, SimulationTimestampDiskWriteStart>;
+            if (is_start) {
+                this->timestamp_stream->write(type_name, timestamp->getDate(), SimulationOutput::getTimestampFields(timestamp));
+                this->streamed_pending_timestamps[timestamp] = {std::unique_ptr<SimulationTimestampPair>(timestamp),
+                                                                this->streamed_timestamp_sequence_number++,
+                                                                &SimulationOutput::addStreamedTimestampToTrace<T>};
+                return;
+            }
+
+            auto start = this->streamed_pending_timestamps.end();
+            if (timestamp->getEndpoint()) {
+                start = this->streamed_pending_timestamps.find(timestamp->getEndpoint());
+                if (start == this->streamed_pending_timestamps.end()) {
+                    // The start timestamp is in the in-memory trace
+                    this->getOrCreateTrace<T>()->addTimestamp(timestamp);
+                    return;
+                }
+            }
+            this->timestamp_stream->write(type_name, timestamp->getDate(), SimulationOutput::getTimestampFields(timestamp));
+            if (start != this->streamed_pending_timestamps.end()) {
+                this->streamed_pending_timestamps.erase(start);
+            }
+            delete timestamp;
+        }
+
+        /**
+         * @brief Helper method to move a streamed (pending) start timestamp to its in-memory trace
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param output: the simulation output
+         * @param timestamp: a pointer to a SimulationTimestampXXXX object
+         */
+        template<class T>
+        static void addStreamedTimestampToTrace(SimulationOutput *output, SimulationTimestampPair *timestamp) {
+            output->getOrCreateTrace<T>()->addTimestamp(static_cast<T *>(timestamp));
+        }
+
         /**
          * @brief  Determines whether a time stamp time is enabled
          * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
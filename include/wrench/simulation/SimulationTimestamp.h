@@ -18,6 +18,9 @@
 
 namespace wrench {
 
+    template<class T>
+    class SimulationTrace;
+
     /**
      * @brief A time-stamped simulation event stored in SimulationOutput
      *
@@ -69,6 +72,8 @@ namespace wrench {
         /***********************/
 
     private:
+        friend class SimulationTrace<T>;
+
         std::unique_ptr<T> content;
     };
 
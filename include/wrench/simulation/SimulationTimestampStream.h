@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTIMESTAMPSTREAM_H
+#define WRENCH_SIMULATIONTIMESTAMPSTREAM_H
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace wrench {
+
+    /**
+     * @brief A sink to which simulation timestamps are written incrementally (one record
+     *        per timestamp), so that they do not have to be kept in memory. Each record is
+     *        a JSON object with a "type" (e.g., "SimulationTimestampTaskStart") and a "date" field,
+     *        plus type-specific fields.
+     */
+    class SimulationTimestampStream {
+
+    public:
+        /**
+         * @brief The on-disk format of the stream
+         */
+        enum Format {
+            /** @brief One JSON object per line */
+            JSON_LINES,
+            /** @brief A compact binary format (length-prefixed CBOR records) */
+            BINARY
+        };
+
+        SimulationTimestampStream(const std::string &file_path, Format format);
+        ~SimulationTimestampStream();
+
+        void write(const std::string &type, double date, nlohmann::json fields);
+        void flush();
+
+        [[nodiscard]] Format getFormat() const;
+        [[nodiscard]] const std::string &getFilePath() const;
+        [[nodiscard]] unsigned long getNumRecords() const;
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /** @brief The magic string at the beginning of a binary stream */
+        static constexpr const char *BINARY_MAGIC = "WRENCHTS1";
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+        std::string file_path;
+        Format format;
+        std::ofstream stream;
+        unsigned long num_records = 0;
+    };
+
+    /**
+     * @brief A reader that iterates over the records of a file written by a
+     *        SimulationTimestampStream (the format is detected automatically)
+     */
+    class SimulationTimestampStreamReader {
+
+    public:
+        explicit SimulationTimestampStreamReader(const std::string &file_path);
+
+        bool next(nlohmann::json &record);
+
+        /**
+         * @brief An input iterator over the records of a stream
+         */
+        class Iterator {
+        public:
+            /** @brief Iterator category */
+            using iterator_category = std::input_iterator_tag;
+            /** @brief Value type */
+            using value_type = nlohmann::json;
+            /** @brief Difference type */
+            using difference_type = std::ptrdiff_t;
+            /** @brief Pointer type */
+            using pointer = const nlohmann::json *;
+            /** @brief Reference type */
+            using reference = const nlohmann::json &;
+
+            /**
+             * @brief Constructor
+             * @param reader: the reader (nullptr for the end iterator)
+             */
+            explicit Iterator(SimulationTimestampStreamReader *reader) : reader(reader) {
+                ++(*this);
+            }
+
+            /**
+             * @brief Dereference operator
+             * @return the current record
+             */
+            reference operator*() const { return this->record; }
+
+            /**
+             * @brief Member access operator
+             * @return a pointer to the current record
+             */
+            pointer operator->() const { return &this->record; }
+
+            /**
+             * @brief Move to the next record
+             * @return the iterator
+             */
+            Iterator &operator++() {
+                if (this->reader and (not this->reader->next(this->record))) {
+                    this->reader = nullptr;
+                }
+                return *this;
+            }
+
+            /**
+             * @brief Equality operator
+             * @param other: another iterator
+             * @return true if both iterators are at the end, or are on the same reader
+             */
+            bool operator==(const Iterator &other) const { return this->reader == other.reader; }
+
+            /**
+             * @brief Inequality operator
+             * @param other: another iterator
+             * @return true if the iterators differ
+             */
+            bool operator!=(const Iterator &other) const { return this->reader != other.reader; }
+
+        private:
+            SimulationTimestampStreamReader *reader;
+            nlohmann::json record;
+        };
+
+        /**
+         * @brief Get an iterator to the first (not yet read) record
+         * @return an iterator
+         */
+        Iterator begin() { return Iterator(this); }
+
+        /**
+         * @brief Get the end iterator
+         * @return an iterator
+         */
+        Iterator end() { return Iterator(nullptr); }
+
+        [[nodiscard]] SimulationTimestampStream::Format getFormat() const;
+
+    private:
+        std::ifstream stream;
+        SimulationTimestampStream::Format format;
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_SIMULATIONTIMESTAMPSTREAM_H
@@ -20,7 +20,6 @@ using namespace std;
 /** \cond              */
 /***********************/
 
-typedef std::tuple<std::shared_ptr<wrench::DataFile>, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::StorageService>> FileReadWrite;
 typedef std::tuple<std::shared_ptr<wrench::DataFile>, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::FileLocation>> FileCopy;
 
 //struct FileCopy {
@@ -29,8 +28,6 @@ typedef std::tuple<std::shared_ptr<wrench::DataFile>, std::shared_ptr<wrench::Fi
 //    std::shared_ptr<wrench::FileLocation> dst;
 //};
 
-typedef std::tuple<std::string, std::string, int> DiskAccess;
-
 namespace std {
     template<>
     struct hash<FileCopy> {
@@ -40,23 +37,6 @@ namespace std {
             //            return std::hash<void *>()(file.file.get()) ^ std::hash<void *>()(file.src.get()) ^ std::hash<void *>()(file.dst.get());
         }
     };
-
-    template<>
-    struct hash<FileReadWrite> {
-    public:
-        size_t operator()(const FileReadWrite &file) const {
-            return std::hash<void *>()(std::get<0>(file).get()) ^ std::hash<void *>()(std::get<1>(file).get()) ^ std::hash<void *>()(std::get<2>(file).get());
-        }
-    };
-
-
-    template<>
-    struct hash<DiskAccess> {
-    public:
-        size_t operator()(const DiskAccess &diskAccess) const {
-            return std::hash<std::string>()(std::get<0>(diskAccess)) ^ std::hash<std::string>()(std::get<1>(diskAccess)) ^ std::hash<int>()(std::get<2>(diskAccess));
-        }
-    };
 };// namespace std
 
 /***********************/
@@ -97,6 +77,8 @@ namespace wrench {
 
     private:
         friend class SimulationOutput;
+        template<class T>
+        friend class SimulationTrace;
         void setDate(double d);
     };
 
@@ -131,7 +113,7 @@ namespace wrench {
         SimulationTimestampTask *getEndpoint() override;
 
     protected:
-        static std::map<std::string, SimulationTimestampTask *> pending_task_timestamps;
+        static std::unordered_map<WorkflowTask *, SimulationTimestampTask *> pending_task_timestamps;
         void setEndpoints();
         SimulationTimestampTask(double date, const std::shared_ptr<WorkflowTask> &task);
 
@@ -215,14 +197,18 @@ namespace wrench {
         std::shared_ptr<WorkflowTask> task;
 
         /**
-         * @brief the data structure that holds the ongoing file reads.
+         * @brief Correlation handle shared by a start timestamp and its matching end timestamp (-1 if none)
+         */
+        int counter;
+
+        /**
+         * @brief the data structure that holds the ongoing file reads, indexed by correlation handle
          */
-        ///static std::unordered_multimap<File, std::pair<SimulationTimestampFileRead *, double>, decltype(&file_hash)> pending_file_reads;
-        static std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileRead *, std::shared_ptr<WorkflowTask>>> pending_file_reads;
+        static std::unordered_map<int, SimulationTimestampFileRead *> pending_file_reads;
 
         void setEndpoints();
         friend class SimulationOutput;
-        SimulationTimestampFileRead(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileRead(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     class SimulationTimestampFileReadFailure;
@@ -234,7 +220,7 @@ namespace wrench {
     class SimulationTimestampFileReadStart : public SimulationTimestampFileRead {
     public:
         friend class SimulationOutput;
-        SimulationTimestampFileReadStart(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileReadStart(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task, int counter);
 
         friend class SimulationTimestampFileReadFailure;
         friend class SimulationTimestampFileReadCompletion;
@@ -246,7 +232,7 @@ namespace wrench {
     class SimulationTimestampFileReadFailure : public SimulationTimestampFileRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     /**
@@ -255,7 +241,7 @@ namespace wrench {
     class SimulationTimestampFileReadCompletion : public SimulationTimestampFileRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     class SimulationTimestampFileWriteStart;
@@ -297,15 +283,19 @@ namespace wrench {
         std::shared_ptr<WorkflowTask> task;
 
         /**
-         * @brief the data structure that holds the ongoing file writes.
+         * @brief Correlation handle shared by a start timestamp and its matching end timestamp (-1 if none)
+         */
+        int counter;
+
+        /**
+         * @brief the data structure that holds the ongoing file writes, indexed by correlation handle
          */
-        ///static std::unordered_multimap<File, std::pair<SimulationTimestampFileWrite *, double>, decltype(&file_hash)> pending_file_writes;
-        static std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileWrite *, std::shared_ptr<WorkflowTask>>> pending_file_writes;
+        static std::unordered_map<int, SimulationTimestampFileWrite *> pending_file_writes;
 
         void setEndpoints();
 
         friend class SimulationOutput;
-        SimulationTimestampFileWrite(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> dst_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWrite(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> dst_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     class SimulationTimestampFileWriteFailure;
@@ -319,7 +309,7 @@ namespace wrench {
         friend class SimulationOutput;
         friend class SimulationTimestampFileWriteFailure;
         friend class SimulationTimestampFileWriteCompletion;
-        SimulationTimestampFileWriteStart(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> dst, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteStart(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> dst, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task, int counter);
     };
 
     /**
@@ -328,7 +318,7 @@ namespace wrench {
     class SimulationTimestampFileWriteFailure : public SimulationTimestampFileWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     /**
@@ -337,7 +327,7 @@ namespace wrench {
     class SimulationTimestampFileWriteCompletion : public SimulationTimestampFileWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr, int counter = -1);
     };
 
     class SimulationTimestampFileCopyStart;
@@ -454,9 +444,9 @@ namespace wrench {
 
 
         /**
-         * @brief the data structure that holds the ongoing disk reads.
+         * @brief the data structure that holds the ongoing disk reads, indexed by counter
          */
-        static std::unordered_multimap<DiskAccess, SimulationTimestampDiskRead *> pending_disk_reads;
+        static std::unordered_map<int, SimulationTimestampDiskRead *> pending_disk_reads;
 
         void setEndpoints();
         friend class SimulationOutput;
@@ -535,9 +525,9 @@ namespace wrench {
         int counter;
 
         /**
-         * @brief the data structure that holds the ongoing disk writes.
+         * @brief the data structure that holds the ongoing disk writes, indexed by counter
          */
-        static std::unordered_multimap<DiskAccess, SimulationTimestampDiskWrite *> pending_disk_writes;
+        static std::unordered_map<int, SimulationTimestampDiskWrite *> pending_disk_writes;
 
         void setEndpoints();
         friend class SimulationOutput;
@@ -10,6 +10,7 @@
 #ifndef WRENCH_SIMULATIONTRACE_H
 #define WRENCH_SIMULATIONTRACE_H
 
+#include <deque>
 #include <vector>
 #include <map>
 #include <cmath>
@@ -41,7 +42,12 @@ namespace wrench {
     /***********************/
 
     /**
-     * @brief A template class to represent a trace of timestamps
+     * @brief A template class to represent a trace of timestamps. The SimulationTimestamp<T> wrappers
+     *        are stored by value (in chunks, so that pointers to them remain valid as the trace grows),
+     *        but each timestamp's content is still an individually allocated object, since start/end
+     *        timestamps refer to each other by address. Timestamp dates are also copied into a separate
+     *        contiguous column, which costs one double per timestamp, so that analytics can scan them
+     *        without dereferencing the contents.
      *
      * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
      */
@@ -52,36 +58,59 @@ namespace wrench {
         /**
          * @brief Append a timestamp to the trace
          *
-         * @param timestamp: a pointer to a SimulationTimestamp<T> object
-         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param content: a pointer to a SimulationTimestampXXXX object (which the trace now owns)
+         * @return the index of the timestamp in the trace
          */
-        void addTimestamp(SimulationTimestamp<T> *timestamp) {
-            this->trace.push_back(timestamp);
+        unsigned long addTimestamp(T *content) {
+            this->trace.emplace_back(content);
+            this->dates.push_back(content->getDate());
+            return this->trace.size() - 1;
         }
 
-
         /**
          * @brief Retrieve the trace as a vector of timestamps
          *
-         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          * @return a vector of pointers to SimulationTimestamp<T> objects
          */
         std::vector<SimulationTimestamp<T> *> getTrace() {
-            return this->trace;
+            std::vector<SimulationTimestamp<T> *> to_return;
+            to_return.reserve(this->trace.size());
+            for (auto &timestamp: this->trace) {
+                to_return.push_back(&timestamp);
+            }
+            return to_return;
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve a timestamp in the trace
+         * @param index: the timestamp's index
+         * @return a pointer to a SimulationTimestamp<T> object
          */
-        ~SimulationTrace<T>() {
-            for (auto &timestamp: this->trace) {
-                delete timestamp;
-            }
+        SimulationTimestamp<T> *getTimestamp(unsigned long index) {
+            return &(this->trace.at(index));
         }
 
+        /**
+         * @brief Retrieve the dates of all timestamps in the trace
+         * @return a vector of dates, in trace order
+         */
+        const std::vector<double> &getDates() const {
+            return this->dates;
+        }
+
+        /**
+         * @brief Change the date of a timestamp in the trace
+         * @param index: the timestamp's index
+         * @param date: the new date
+         */
+        void setDate(unsigned long index, double date) {
+            this->trace.at(index).getContent()->setDate(date);
+            this->dates.at(index) = date;
+        }
 
     private:
-        std::vector<SimulationTimestamp<T> *> trace;
+        std::deque<SimulationTimestamp<T>> trace;
+        std::vector<double> dates;
     };
 
 
@@ -93,39 +122,41 @@ namespace wrench {
     public:
         /**
          * @brief Append a SimulationTimestampPstateSet timestamp to the trace
-         * @param new_timestamp: pointer to the timestamp
+         * @param new_timestamp: pointer to the timestamp (which the trace now owns)
+         * @return the index of the timestamp in the trace
          */
-        void addTimestamp(SimulationTimestamp<SimulationTimestampPstateSet> *new_timestamp) {
-            auto hostname = new_timestamp->getContent()->getHostname();
+        unsigned long addTimestamp(SimulationTimestampPstateSet *new_timestamp) {
+            auto hostname = new_timestamp->getHostname();
 
             auto hostname_search = latest_timestamps_by_host.find(hostname);
             if (hostname_search == latest_timestamps_by_host.end()) {
                 // no pstate timestamps associated to this hostname have been added yet
-                this->trace.push_back(new_timestamp);
+                this->trace.emplace_back(new_timestamp);
+                this->dates.push_back(new_timestamp->getDate());
+                this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
+                return this->trace.size() - 1;
+            }
+
+            // a pstate timestamp associated to this host already exists
+            auto latest_index = hostname_search->second;
+            auto &latest_timestamp = this->trace[latest_index];
+
+            // if the new_timestamp has the same date as the latest_timestamp, then the new_timestamp replaces
+            // the latest_timestamp in the trace, else the new time_stamp is added to the trace and the map of latest
+            // timestamps is updated to reflect this change
+            if (std::fabs(new_timestamp->getDate() - latest_timestamp.getDate()) < DBL_EPSILON) {
+                latest_timestamp.content.reset(new_timestamp);
+                this->dates[latest_index] = new_timestamp->getDate();
+                return latest_index;
+            } else if (new_timestamp->getDate() > latest_timestamp.getDate()) {
+                this->trace.emplace_back(new_timestamp);
+                this->dates.push_back(new_timestamp->getDate());
                 this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
+                return this->trace.size() - 1;
             } else {
-                // a pstate timestamp associated to this host already exists
-                SimulationTimestamp<SimulationTimestampPstateSet> *&latest_timestamp = this->trace[this->latest_timestamps_by_host[hostname]];
-
-                // if the new_timestamp has the same date as the latest_timestamp, then the new_timestamp replaces
-                // the latest_timestamp in the trace, else the new time_stamp is added to the trace and the map of latest
-                // timestamps is updated to reflect this change
-                if (std::fabs(new_timestamp->getDate() - latest_timestamp->getDate()) < DBL_EPSILON) {
-                    std::swap(new_timestamp, latest_timestamp);
-
-                    // now, latest_timestamp points to the contents of new_timestamp
-                    // and new_timestamp points to the contents of latest_timestamp so
-                    // we need to delete new_timestamp
-                    delete new_timestamp;
-                } else {
-                    if (new_timestamp->getDate() > latest_timestamp->getDate()) {
-                        this->trace.push_back(new_timestamp);
-                        this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
-                    } else {
-                        throw std::runtime_error(
-                                "SimulationTrace<SimulationTimestampPstateSet>::addTimestamp() timestamps out of order");
-                    }
-                }
+                delete new_timestamp;
+                throw std::runtime_error(
+                        "SimulationTrace<SimulationTimestampPstateSet>::addTimestamp() timestamps out of order");
             }
         }
 
@@ -134,21 +165,26 @@ namespace wrench {
          * @return a vector of pointers to SimulationTimestamp<SimulationTimestampPstateSet> objects
          */
         std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> getTrace() {
-            return this->trace;
+            std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> to_return;
+            to_return.reserve(this->trace.size());
+            for (auto &timestamp: this->trace) {
+                to_return.push_back(&timestamp);
+            }
+            return to_return;
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve the dates of all timestamps in the trace
+         * @return a vector of dates, in trace order
          */
-        ~SimulationTrace<SimulationTimestampPstateSet>() {
-            for (auto &timestamp: this->trace) {
-                delete timestamp;
-            }
+        const std::vector<double> &getDates() const {
+            return this->dates;
         }
 
     private:
         std::map<std::string, size_t> latest_timestamps_by_host;
-        std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> trace;
+        std::deque<SimulationTimestamp<SimulationTimestampPstateSet>> trace;
+        std::vector<double> dates;
     };
 
     /***********************/
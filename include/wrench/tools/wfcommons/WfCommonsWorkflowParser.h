@@ -27,7 +27,9 @@ namespace wrench {
         /**
          * @brief Create an abstract workflow based on a JSON file in the WfFormat (version 1.5) from WfCommons. This method
          *        makes executive decisions when information in the JSON file is incomplete and/or contradictory. Pass true
-         *        as the last argument to see all warnings on stderr.
+         *        as the last argument to see all warnings on stderr. Files are added to the simulation as they are
+         *        read: if an exception is thrown (e.g., because a required key is missing), the files that were
+         *        added are removed from the simulation.
          *
          *
          * @param filename: the path to the JSON file
@@ -129,6 +131,38 @@ namespace wrench {
                                                                       bool ignore_avg_cpu = false,
                                                                       bool show_warnings = false);
 
+        /**
+         * @brief Create an abstract workflow based on a JSON file in the WfFormat (version 1.5) from WfCommons, like
+         *        createWorkflowFromJSON() does, but using a binary snapshot of the workflow as a cache. If the snapshot
+         *        file exists and was created from the same JSON file content with the same arguments, the workflow is
+         *        loaded from it (which is much faster than parsing the JSON file). Otherwise, the JSON file is parsed
+         *        and the snapshot file is (re-)created.
+         *
+         * @param filename: the path to the JSON file
+         * @param snapshot_filename: the path to the snapshot file
+         * @param reference_flop_rate: see createWorkflowFromJSON()
+         * @param ignore_machine_specs: see createWorkflowFromJSON()
+         * @param redundant_dependencies: see createWorkflowFromJSON()
+         * @param ignore_cycle_creating_dependencies: see createWorkflowFromJSON()
+         * @param min_cores_per_task: see createWorkflowFromJSON()
+         * @param max_cores_per_task: see createWorkflowFromJSON()
+         * @param enforce_num_cores: see createWorkflowFromJSON()
+         * @param ignore_avg_cpu: see createWorkflowFromJSON()
+         * @param show_warnings: see createWorkflowFromJSON()
+         * @return a workflow
+         */
+        static std::shared_ptr<Workflow> createWorkflowFromJSONWithSnapshot(const std::string &filename,
+                                                                            const std::string &snapshot_filename,
+                                                                            const std::string &reference_flop_rate,
+                                                                            bool ignore_machine_specs = false,
+                                                                            bool redundant_dependencies = false,
+                                                                            bool ignore_cycle_creating_dependencies = false,
+                                                                            unsigned long min_cores_per_task = 1,
+                                                                            unsigned long max_cores_per_task = 1,
+                                                                            bool enforce_num_cores = false,
+                                                                            bool ignore_avg_cpu = false,
+                                                                            bool show_warnings = false);
+
         /**
          * @brief Method to create a JSON string in the WfFormat (version 1.5) from WfCommons, from a workflow object.
          *
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SPAN_H
+#define WRENCH_SPAN_H
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace wrench {
+
+    /**
+     * @brief A non-owning view of a contiguous sequence of objects (a minimal
+     *        stand-in for C++20's std::span). A span is invalidated by any
+     *        modification of the container it views.
+     *
+     * @tparam T: the type of the objects
+     */
+    template<class T>
+    class Span {
+
+    public:
+        /** @brief Iterator type */
+        using iterator = T *;
+
+        /**
+         * @brief Constructor (empty span)
+         */
+        Span() = default;
+
+        /**
+         * @brief Constructor
+         * @param data: a pointer to the first object
+         * @param size: the number of objects
+         */
+        Span(T *data, size_t size) : _data(data), _size(size) {}
+
+        /**
+         * @brief Get an iterator to the first object
+         * @return an iterator
+         */
+        iterator begin() const { return this->_data; }
+
+        /**
+         * @brief Get an iterator past the last object
+         * @return an iterator
+         */
+        iterator end() const { return this->_data + this->_size; }
+
+        /**
+         * @brief Get the number of objects
+         * @return a number of objects
+         */
+        [[nodiscard]] size_t size() const { return this->_size; }
+
+        /**
+         * @brief Determine whether the span is empty
+         * @return true or false
+         */
+        [[nodiscard]] bool empty() const { return this->_size == 0; }
+
+        /**
+         * @brief Access an object (unchecked)
+         * @param index: the object's index
+         * @return the object
+         */
+        T &operator[](size_t index) const { return this->_data[index]; }
+
+        /**
+         * @brief Access an object
+         * @param index: the object's index
+         * @return the object
+         *
+         * @throw std::out_of_range if the index is out of range
+         */
+        T &at(size_t index) const {
+            if (index >= this->_size) {
+                throw std::out_of_range("Span::at(): index out of range");
+            }
+            return this->_data[index];
+        }
+
+    private:
+        T *_data = nullptr;
+        size_t _size = 0;
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_SPAN_H
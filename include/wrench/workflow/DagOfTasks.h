@@ -11,9 +11,9 @@
 #define WRENCH_DAGOFTASKS_H
 
 #include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/breadth_first_search.hpp>
 #include <iostream>
 
+#include "wrench/util/Span.h"
 #include "wrench/workflow/WorkflowTask.h"
 
 namespace wrench {
@@ -69,30 +69,100 @@ namespace wrench {
 
         std::vector<WorkflowTask *> getParents(const WorkflowTask *task);
 
-    private:
+        Span<const std::shared_ptr<WorkflowTask>> getChildrenSpan(const WorkflowTask *task);
+        Span<const std::shared_ptr<WorkflowTask>> getParentsSpan(const WorkflowTask *task);
+
         /**
-         * @brief Nested class that's used for the BFS algorithm in the BGL
+         * @brief Apply a function to each child of a task vertex, without copying the children
+         *        and without freezing the DAG
+         * @param task: the task
+         * @param function: a function that takes a WorkflowTask pointer
          */
-        class custom_bfs_visitor : public boost::default_bfs_visitor {
-        public:
-            const WorkflowTask *target_task;
-
-            explicit custom_bfs_visitor(const WorkflowTask *target_task) : boost::default_bfs_visitor() {
-                this->target_task = target_task;
+        template<class Function>
+        void forEachChild(const WorkflowTask *task, Function function) {
+            auto it = this->task_map.find(task);
+            if (it == this->task_map.end() or it->second >= this->task_list.size()) {
+                throw std::invalid_argument("wrench::DagOfTasks::forEachChild(): Non-existing vertex");
+            }
+            auto vertex = it->second;
+            if (this->frozen) {
+                for (auto i = this->child_offsets[vertex]; i < this->child_offsets[vertex + 1]; i++) {
+                    function(this->child_tasks[i].get());
+                }
+                return;
+            }
+            boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
+            for (boost::tie(eo, edge_end) = boost::out_edges(vertex, this->dag); eo != edge_end; ++eo) {
+                // Discard the const qualifier
+                function(const_cast<WorkflowTask *>(this->dag[boost::target(*eo, this->dag)].task));
             }
+        }
 
-            template<typename Vertex, typename Graph>
-            void discover_vertex(Vertex u, Graph &g) {
-                if (g[u].task == target_task) {
-                    throw std::runtime_error("path found");
+        /**
+         * @brief Apply a function to each parent of a task vertex, without copying the parents
+         *        and without freezing the DAG
+         * @param task: the task
+         * @param function: a function that takes a WorkflowTask pointer
+         */
+        template<class Function>
+        void forEachParent(const WorkflowTask *task, Function function) {
+            auto it = this->task_map.find(task);
+            if (it == this->task_map.end() or it->second >= this->task_list.size()) {
+                throw std::invalid_argument("wrench::DagOfTasks::forEachParent(): Non-existing vertex");
+            }
+            auto vertex = it->second;
+            if (this->frozen) {
+                for (auto i = this->parent_offsets[vertex]; i < this->parent_offsets[vertex + 1]; i++) {
+                    function(this->parent_tasks[i].get());
                 }
+                return;
+            }
+            boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
+            for (boost::tie(ei, edge_end) = boost::in_edges(vertex, this->dag); ei != edge_end; ++ei) {
+                // Discard the const qualifier
+                function(const_cast<WorkflowTask *>(this->dag[boost::source(*ei, this->dag)].task));
             }
-        };
+        }
+
+        std::vector<WorkflowTask *> getTasksInTopologicalOrder();
+
+        void freeze();
+        void unfreeze();
+        bool isFrozen() const;
+
+        void invalidateTopologicalOrder();
+        bool computeTopologicalOrder();
+        bool isTopologicalOrderValid() const;
+
+    private:
+        bool search(vertex_t from, vertex_t target, bool forward, unsigned long bound, std::vector<vertex_t> *visited);
+        void reorder(vertex_t src_vertex, vertex_t dst_vertex);
+        bool sortTopologically(std::vector<vertex_t> &sorted);
 
         std::vector<const WorkflowTask *> task_list;
         std::unordered_map<const WorkflowTask *, unsigned long> task_map;
 
         DAG dag;
+
+        /* Position of each vertex (indexed by vertex) in a topological order of the DAG, maintained
+         * incrementally as edges are added (Pearce-Kelly). Positions are unique but not necessarily contiguous. */
+        std::vector<unsigned long> topological_order;
+        unsigned long next_topological_position = 0;
+        bool topological_order_is_valid = true;
+
+        /* Visit marks (indexed by vertex) used by searches, so that they do not allocate */
+        std::vector<unsigned long> visit_marks;
+        unsigned long visit_epoch = 0;
+        std::vector<vertex_t> search_stack;
+
+        /* Frozen, compressed-sparse-row, representation of the DAG: the children (resp. parents) of
+         * vertex v are at indices [child_offsets[v], child_offsets[v+1]) of child_tasks (resp. parent_tasks).
+         * It is built on demand, and dropped whenever the DAG is modified. */
+        bool frozen = false;
+        std::vector<unsigned long> child_offsets;
+        std::vector<std::shared_ptr<WorkflowTask>> child_tasks;
+        std::vector<unsigned long> parent_offsets;
+        std::vector<std::shared_ptr<WorkflowTask>> parent_tasks;
     };
 
     /***********************/
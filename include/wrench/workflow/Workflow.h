@@ -12,6 +12,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include "wrench/execution_events/ExecutionEvent.h"
 #include "wrench/data_file/DataFile.h"
@@ -80,6 +81,8 @@ namespace wrench {
 
         std::vector<std::shared_ptr<WorkflowTask>> getTasks() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getTaskMap();
+        const std::unordered_map<std::string, std::shared_ptr<WorkflowTask>> &getTaskIndex() const;
+        const std::vector<std::shared_ptr<WorkflowTask>> &getTasksSortedByID() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getEntryTaskMap() const;
         std::vector<std::shared_ptr<WorkflowTask>> getEntryTasks() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getExitTaskMap() const;
@@ -89,6 +92,8 @@ namespace wrench {
         long getTaskNumberOfParents(const std::shared_ptr<WorkflowTask> &task);
         std::vector<std::shared_ptr<WorkflowTask>> getTaskChildren(const std::shared_ptr<WorkflowTask> &task);
         long getTaskNumberOfChildren(const std::shared_ptr<WorkflowTask> &task);
+        Span<const std::shared_ptr<WorkflowTask>> getTaskParentsSpan(const std::shared_ptr<WorkflowTask> &task);
+        Span<const std::shared_ptr<WorkflowTask>> getTaskChildrenSpan(const std::shared_ptr<WorkflowTask> &task);
 
         bool pathExists(const std::shared_ptr<WorkflowTask> &src, const std::shared_ptr<WorkflowTask> &dst);
 
@@ -99,6 +104,8 @@ namespace wrench {
         bool isDone() const;
 
         void enableTopBottomLevelDynamicUpdates(bool enabled);
+        void enableTopBottomLevelLazyUpdates(bool enabled);
+        void enableBulkDependencyAddition(bool enabled);
         void updateAllTopBottomLevels();
 
         /***********************/
@@ -109,8 +116,10 @@ namespace wrench {
         std::vector<std::shared_ptr<WorkflowTask>> getTasksInBottomLevelRange(int min, int max) const;
 
         std::vector<std::shared_ptr<WorkflowTask>> getReadyTasks();
+        const std::set<std::shared_ptr<WorkflowTask>> &getReadyTaskSet() const;
 
         std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> getReadyClusters() const;
+        const std::map<std::string, std::map<std::string, std::shared_ptr<WorkflowTask>>> &getReadyTasksByCluster() const;
 
         /***********************/
         /** \endcond           */
@@ -123,6 +132,21 @@ namespace wrench {
 
         std::string name;
         bool update_top_bottom_levels_dynamically;
+        bool bulk_dependency_addition = false;
+        bool update_top_bottom_levels_lazily = false;
+        bool top_bottom_levels_are_stale = false;
+
+        void topBottomLevelsNeedUpdate(WorkflowTask *src, WorkflowTask *dst);
+        void refreshStaleTopBottomLevels() const;
+        void setTaskTopLevel(WorkflowTask *task, int level);
+        void setTaskBottomLevel(WorkflowTask *task, int level);
+        void rebuildLevelBuckets();
+        void updateEntryExitStatus(WorkflowTask *task);
+        void addReadyTask(const std::shared_ptr<WorkflowTask> &task);
+        void removeReadyTask(const std::shared_ptr<WorkflowTask> &task);
+        void setTaskClusterID(WorkflowTask *task, const std::string &cluster_id);
+        static std::vector<std::shared_ptr<WorkflowTask>> getTasksInLevelBuckets(const std::vector<std::map<std::string, std::shared_ptr<WorkflowTask>>> &buckets,
+                                                                                 int min, int max);
 
         Workflow();
 
@@ -135,17 +159,35 @@ namespace wrench {
         DagOfTasks dag;
 
         /* Map to find tasks by name */
-        std::map<std::string, std::shared_ptr<WorkflowTask>> tasks;
+        std::unordered_map<std::string, std::shared_ptr<WorkflowTask>> tasks;
+
+        /* All tasks, sorted by name (rebuilt on demand once tasks have been added or removed) */
+        mutable std::vector<std::shared_ptr<WorkflowTask>> tasks_sorted_by_id;
+        mutable bool tasks_sorted_by_id_are_stale = false;
 
         /* Set of ready tasks */
         std::set<std::shared_ptr<WorkflowTask>> ready_tasks;
 
+        /* Ready tasks by name, grouped by cluster ID (a task not in a cluster is keyed by its own name) */
+        std::map<std::string, std::map<std::string, std::shared_ptr<WorkflowTask>>> ready_tasks_by_cluster;
+
+        /* Tasks by name, grouped by (non-empty) cluster ID */
+        std::map<std::string, std::map<std::string, std::shared_ptr<WorkflowTask>>> cluster_members;
+
+        /* Entry (i.e., parent-less) and exit (i.e., child-less) tasks, by name */
+        std::map<std::string, std::shared_ptr<WorkflowTask>> entry_tasks;
+        std::map<std::string, std::shared_ptr<WorkflowTask>> exit_tasks;
+
+        /* Tasks by name, bucketed by top level and by bottom level (the last bucket is never empty) */
+        std::vector<std::map<std::string, std::shared_ptr<WorkflowTask>>> top_level_buckets;
+        std::vector<std::map<std::string, std::shared_ptr<WorkflowTask>>> bottom_level_buckets;
+
         /* Map of output files */
-        std::map<std::shared_ptr<DataFile>, std::shared_ptr<WorkflowTask>> task_output_files;
-        std::map<std::shared_ptr<DataFile>, std::set<std::shared_ptr<WorkflowTask>>> task_input_files;
+        std::unordered_map<std::shared_ptr<DataFile>, std::shared_ptr<WorkflowTask>> task_output_files;
+        std::unordered_map<std::shared_ptr<DataFile>, std::set<std::shared_ptr<WorkflowTask>>> task_input_files;
 
         /* files used in this workflow */
-        std::map<std::string, std::shared_ptr<DataFile>> data_files;
+        std::unordered_map<std::string, std::shared_ptr<DataFile>> data_files;
     };
 }// namespace wrench
 
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_WORKFLOWSNAPSHOT_H
+#define WRENCH_WORKFLOWSNAPSHOT_H
+
+#include <memory>
+#include <string>
+
+namespace wrench {
+
+    class Workflow;
+
+    /**
+     * @brief A compact binary snapshot of the structure of a workflow (files, tasks, and
+     *        task dependencies, but not the workflow's execution state), which can be loaded
+     *        much faster than the workflow can be re-created from its original description
+     *        (e.g., a WfCommons JSON file). A snapshot is tagged with a key, typically computed
+     *        from the original description with computeSourceKey(), so that a stale snapshot
+     *        is detected (and ignored) when the description changes.
+     */
+    class WorkflowSnapshot {
+
+    public:
+        static void save(const std::shared_ptr<Workflow> &workflow, const std::string &snapshot_path, const std::string &key);
+        static std::shared_ptr<Workflow> load(const std::string &snapshot_path, const std::string &key);
+        static std::string computeSourceKey(const std::string &source_path, const std::string &salt = "");
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /** @brief The magic string at the beginning of a snapshot */
+        static constexpr const char *MAGIC = "WRENCHWS";
+        /** @brief The version of the snapshot format */
+        static constexpr unsigned int FORMAT_VERSION = 1;
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_WORKFLOWSNAPSHOT_H
@@ -14,9 +14,11 @@
 #include <stack>
 #include <set>
 #include <memory>
+#include <functional>
 
 
 #include "wrench/job/Job.h"
+#include "wrench/util/Span.h"
 #include "wrench/data_file/DataFile.h"
 #include "wrench/workflow/parallel_model/ParallelModel.h"
 #include "wrench/workflow/parallel_model/AmdahlParallelModel.h"
@@ -62,6 +64,14 @@ namespace wrench {
 
         std::vector<std::shared_ptr<WorkflowTask>> getParents();
 
+        Span<const std::shared_ptr<WorkflowTask>> getChildrenSpan();
+
+        Span<const std::shared_ptr<WorkflowTask>> getParentsSpan();
+
+        void forEachChild(const std::function<void(WorkflowTask *)> &function);
+
+        unsigned long getNumberOfIncompleteParents() const;
+
         void addInputFile(const std::shared_ptr<DataFile> &file);
 
         void addOutputFile(const std::shared_ptr<DataFile> &file);
@@ -189,9 +199,6 @@ namespace wrench {
         unsigned long updateTopLevel();
         unsigned long updateBottomLevel();
 
-        void computeBottomLevel();
-        void computeTopLevel();
-
     public:
         void setInternalState(WorkflowTask::InternalState);
         void setState(WorkflowTask::State);
@@ -289,6 +296,7 @@ namespace wrench {
         unsigned long priority = 0;    // Task priority
         int toplevel;                  // 0 if entry task
         int bottomlevel;               // 0 if exit task
+        unsigned long num_incomplete_parents = 0;// Number of parents whose visible state is not COMPLETED
         unsigned int failure_count = 0;// Number of times the tasks has failed
         std::string execution_host;    // Host on which the task executed ("" if not executed successfully - yet)
         State visible_state;           // To be exposed to developer level
@@ -26,7 +26,9 @@ namespace wrench {
      * @param payload: message size in bytes
      *
      */
-    ExecutionControllerAlarmTimerMessage::ExecutionControllerAlarmTimerMessage(std::string message, sg_size_t payload) : ExecutionControllerMessage(payload), message(std::move(message)) {}
+    ExecutionControllerAlarmTimerMessage::ExecutionControllerAlarmTimerMessage(std::string message, sg_size_t payload) : ExecutionControllerMessage(payload), message(std::move(message)) {
+        this->kind = SimulationMessage::getKindOf<ExecutionControllerAlarmTimerMessage>();
+    }
 
 
 }// namespace wrench
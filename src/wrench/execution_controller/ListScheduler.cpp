@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <limits>
+
+#include <wrench/execution_controller/ListScheduler.h>
+#include <wrench/logging/TerminalOutput.h>
+#include <wrench/managers/job_manager/JobManager.h>
+#include <wrench/job/StandardJob.h>
+#include <wrench/services/compute/bare_metal/BareMetalComputeService.h>
+#include <wrench/services/storage/StorageService.h>
+#include <wrench/services/storage/storage_helpers/FileLocation.h>
+#include <wrench/simgrid_S4U_util/S4U_Simulation.h>
+#include <wrench/workflow/Workflow.h>
+#include <wrench/workflow/WorkflowTask.h>
+
+WRENCH_LOG_CATEGORY(wrench_core_list_scheduler, "Log category for ListScheduler");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param workflow: the workflow to execute
+     * @param job_manager: the job manager with which jobs are created and submitted
+     * @param compute_services: the compute services on which tasks can run
+     * @param storage_service: the storage service from which all files are read, and to which they are all written
+     *
+     * @throw std::invalid_argument if an argument is invalid, or if a task cannot run on any compute host
+     */
+    ListScheduler::ListScheduler(std::shared_ptr<Workflow> workflow,
+                                 std::shared_ptr<JobManager> job_manager,
+                                 const std::vector<std::shared_ptr<BareMetalComputeService>> &compute_services,
+                                 std::shared_ptr<StorageService> storage_service) : workflow(std::move(workflow)),
+                                                                                    job_manager(std::move(job_manager)),
+                                                                                    storage_service(std::move(storage_service)) {
+        if ((this->workflow == nullptr) or (this->job_manager == nullptr) or (this->storage_service == nullptr) or
+            compute_services.empty()) {
+            throw std::invalid_argument("ListScheduler::ListScheduler(): Invalid arguments");
+        }
+
+        // Gather the compute hosts
+        auto storage_hostname = this->storage_service->getHostname();
+        for (auto const &cs: compute_services) {
+            if (cs == nullptr) {
+                throw std::invalid_argument("ListScheduler::ListScheduler(): Invalid nullptr compute service");
+            }
+            auto flop_rates = cs->getCoreFlopRate();
+            auto ram_capacities = cs->getPerHostAvailableMemoryCapacity();
+            for (auto const &num_cores: cs->getPerHostNumCores()) {
+                Host host;
+                host.compute_service = cs;
+                host.name = num_cores.first;
+                host.core_flop_rate = flop_rates.at(host.name);
+                host.num_idle_cores = num_cores.second;
+                host.available_ram = ram_capacities.at(host.name);
+                host.bandwidth = std::numeric_limits<double>::infinity();
+                for (auto const &link: S4U_Simulation::getRoute(storage_hostname, host.name)) {
+                    host.bandwidth = std::min<double>(host.bandwidth, S4U_Simulation::getLinkBandwidth(link));
+                }
+                this->hosts.push_back(host);
+            }
+        }
+
+        this->computeUpwardRanks();
+    }
+
+    /**
+     * @brief Compare two ready-queue entries
+     * @param lhs: an entry
+     * @param rhs: another entry
+     * @return true if lhs should be scheduled before rhs
+     */
+    bool ListScheduler::ReadyQueueOrder::operator()(const std::pair<double, std::shared_ptr<WorkflowTask>> &lhs,
+                                                    const std::pair<double, std::shared_ptr<WorkflowTask>> &rhs) const {
+        if (lhs.first != rhs.first) {
+            return lhs.first > rhs.first;
+        }
+        return lhs.second->getID() < rhs.second->getID();
+    }
+
+    /**
+     * @brief Get the upward rank of a task
+     * @param task: a task of the workflow
+     * @return an upward rank (in seconds)
+     */
+    double ListScheduler::getUpwardRank(const std::shared_ptr<WorkflowTask> &task) const {
+        auto it = this->upward_ranks.find(task.get());
+        if (it == this->upward_ranks.end()) {
+            throw std::invalid_argument("ListScheduler::getUpwardRank(): Unknown task");
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Get the number of ready tasks that are waiting to be submitted
+     * @return a number of tasks
+     */
+    unsigned long ListScheduler::getNumQueuedTasks() const {
+        return this->ready_queue.size();
+    }
+
+    /**
+     * @brief Submit ready tasks, by decreasing upward rank, until the highest-rank ready task cannot run on
+     *        any compute host (for lack of idle cores or of RAM)
+     * @return the number of tasks that were submitted
+     *
+     * @throw ExecutionException if a job submission fails
+     */
+    unsigned long ListScheduler::scheduleReadyTasks() {
+        // Afterward, tasks become ready only when their parents complete
+        if (not this->ready_queue_is_seeded) {
+            for (auto const &task: this->workflow->getReadyTaskSet()) {
+                this->enqueue(task);
+            }
+            this->ready_queue_is_seeded = true;
+        }
+
+        unsigned long num_scheduled = 0;
+        while (not this->ready_queue.empty()) {
+            auto task = this->ready_queue.begin()->second;
+            auto memory_requirement = (double) task->getMemoryRequirement();
+            double transfer_size = ListScheduler::getTotalSize(task->getInputFiles()) +
+                                   ListScheduler::getTotalSize(task->getOutputFiles());
+
+            // Find the host on which the task would complete the earliest
+            size_t best_host_index = 0;
+            unsigned long best_num_cores = 0;
+            double best_completion_time = std::numeric_limits<double>::infinity();
+            for (size_t i = 0; i < this->hosts.size(); i++) {
+                auto const &host = this->hosts[i];
+                if ((host.num_idle_cores < task->getMinNumCores()) or (host.available_ram < memory_requirement)) {
+                    continue;
+                }
+                auto num_cores = std::min<unsigned long>(host.num_idle_cores, task->getMaxNumCores());
+                double completion_time = ListScheduler::estimateTransferTime(transfer_size, host) +
+                                         ListScheduler::estimateExecutionTime(task.get(), host, num_cores);
+                if ((best_num_cores == 0) or (completion_time < best_completion_time)) {
+                    best_host_index = i;
+                    best_num_cores = num_cores;
+                    best_completion_time = completion_time;
+                }
+            }
+            if (best_num_cores == 0) {
+                break;
+            }
+
+            // Submit the task, with all its files on the storage service
+            auto &host = this->hosts[best_host_index];
+            std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> file_locations;
+            for (auto const &f: task->getInputFiles()) {
+                file_locations[f] = FileLocation::LOCATION(this->storage_service, f);
+            }
+            for (auto const &f: task->getOutputFiles()) {
+                file_locations[f] = FileLocation::LOCATION(this->storage_service, f);
+            }
+            auto job = this->job_manager->createStandardJob(task, file_locations);
+            WRENCH_INFO("Submitting task %s (upward rank %.2lf) to host %s (%lu cores)",
+                        task->getID().c_str(), this->ready_queue.begin()->first, host.name.c_str(), best_num_cores);
+            this->job_manager->submitJob(job, host.compute_service,
+                                         {{task->getID(), host.name + ":" + std::to_string(best_num_cores)}});
+
+            host.num_idle_cores -= best_num_cores;
+            host.available_ram -= memory_requirement;
+            this->running_jobs[job] = {best_host_index, best_num_cores, memory_requirement};
+            this->ready_queue.erase(this->ready_queue.begin());
+            this->queued_tasks.erase(task.get());
+            num_scheduled++;
+        }
+        return num_scheduled;
+    }
+
+    /**
+     * @brief Process the completion of a job submitted by the scheduler: its resources are released and
+     *        the children of its tasks that have become ready are queued
+     * @param job: the job
+     */
+    void ListScheduler::processJobCompletion(const std::shared_ptr<StandardJob> &job) {
+        this->release(job);
+        for (auto const &task: job->getTasks()) {
+            task->forEachChild([this](WorkflowTask *child) {
+                if (child->getState() == WorkflowTask::State::READY) {
+                    this->enqueue(child->getSharedPtr());
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Process the failure of a job submitted by the scheduler: its resources are released and
+     *        its tasks, which are ready again, are queued again
+     * @param job: the job
+     */
+    void ListScheduler::processJobFailure(const std::shared_ptr<StandardJob> &job) {
+        this->release(job);
+        for (auto const &task: job->getTasks()) {
+            if (task->getState() == WorkflowTask::State::READY) {
+                this->enqueue(task);
+            }
+        }
+    }
+
+    /**
+     * @brief Helper method to release the resources allocated to a job (if it was submitted by the scheduler)
+     * @param job: the job
+     */
+    void ListScheduler::release(const std::shared_ptr<StandardJob> &job) {
+        auto it = this->running_jobs.find(job);
+        if (it == this->running_jobs.end()) {
+            return;
+        }
+        auto &host = this->hosts[it->second.host_index];
+        host.num_idle_cores += it->second.num_cores;
+        host.available_ram += it->second.ram;
+        this->running_jobs.erase(it);
+    }
+
+    /**
+     * @brief Helper method to add a ready task to the ready queue (if it is not already in it)
+     * @param task: the task
+     */
+    void ListScheduler::enqueue(const std::shared_ptr<WorkflowTask> &task) {
+        if (this->queued_tasks.insert(task.get()).second) {
+            this->ready_queue.insert(std::make_pair(this->getUpwardRank(task), task));
+        }
+    }
+
+    /**
+     * @brief Helper method to compute the upward ranks of all tasks, from the exit tasks up (i.e., by
+     *        increasing bottom level, so that the ranks of a task's children are known when its rank is computed).
+     *        Top/bottom levels are first brought up to date, since they may be stale if their dynamic
+     *        updates were disabled or if dependencies were added in bulk.
+     */
+    void ListScheduler::computeUpwardRanks() {
+        // Average time to transfer one byte to/from the storage service
+        double average_transfer_time_per_byte = 0.0;
+        for (auto const &host: this->hosts) {
+            average_transfer_time_per_byte += ListScheduler::estimateTransferTime(1.0, host);
+        }
+        average_transfer_time_per_byte /= (double) this->hosts.size();
+
+        this->workflow->updateAllTopBottomLevels();
+        auto tasks = this->workflow->getTasks();
+        std::stable_sort(tasks.begin(), tasks.end(),
+                         [](const std::shared_ptr<WorkflowTask> &t1, const std::shared_ptr<WorkflowTask> &t2) {
+                             return t1->getBottomLevel() < t2->getBottomLevel();
+                         });
+        for (auto const &task: tasks) {
+            // Average execution time over the hosts on which the task can run
+            double average_execution_time = 0.0;
+            unsigned long num_hosts = 0;
+            for (auto const &host: this->hosts) {
+                if ((host.num_idle_cores >= task->getMinNumCores()) and
+                    (host.available_ram >= (double) task->getMemoryRequirement())) {
+                    average_execution_time += ListScheduler::estimateExecutionTime(task.get(), host, task->getMinNumCores());
+                    num_hosts++;
+                }
+            }
+            if (num_hosts == 0) {
+                throw std::invalid_argument("ListScheduler::computeUpwardRanks(): Task " + task->getID() +
+                                            " cannot run on any compute host (not enough cores or RAM)");
+            }
+            average_execution_time /= (double) num_hosts;
+
+            // Longest path through a child, counting the data written by the task and then read by the child
+            double longest_path = 0.0;
+            auto output_files = task->getOutputFiles();
+            std::set<std::shared_ptr<DataFile>> outputs(output_files.begin(), output_files.end());
+            for (auto const &child: task->getChildrenSpan()) {
+                double num_bytes = 0.0;
+                for (auto const &f: child->getInputFiles()) {
+                    if (outputs.find(f) != outputs.end()) {
+                        num_bytes += (double) f->getSize();
+                    }
+                }
+                longest_path = std::max<double>(longest_path,
+                                                2 * num_bytes * average_transfer_time_per_byte + this->upward_ranks.at(child.get()));
+            }
+            this->upward_ranks[task.get()] = average_execution_time + longest_path;
+        }
+    }
+
+    /**
+     * @brief Helper method to estimate the execution time of a task on a host
+     * @param task: the task
+     * @param host: the host
+     * @param num_cores: the number of cores used
+     * @return a time (in seconds)
+     */
+    double ListScheduler::estimateExecutionTime(WorkflowTask *task, const Host &host, unsigned long num_cores) {
+        auto model = task->getParallelModel();
+        double work = model->getPurelySequentialWork(task->getFlops(), num_cores) +
+                      model->getParallelPerThreadWork(task->getFlops(), num_cores);
+        return work / host.core_flop_rate;
+    }
+
+    /**
+     * @brief Helper method to estimate the time to transfer data between the storage service and a host
+     * @param num_bytes: the number of bytes
+     * @param host: the host
+     * @return a time (in seconds)
+     */
+    double ListScheduler::estimateTransferTime(double num_bytes, const Host &host) {
+        if (host.bandwidth == std::numeric_limits<double>::infinity()) {
+            return 0.0;
+        }
+        return num_bytes / host.bandwidth;
+    }
+
+    /**
+     * @brief Helper method to compute the total size of files
+     * @param files: the files
+     * @return a number of bytes
+     */
+    double ListScheduler::getTotalSize(const std::vector<std::shared_ptr<DataFile>> &files) {
+        double total = 0.0;
+        for (auto const &f: files) {
+            total += (double) f->getSize();
+        }
+        return total;
+    }
+
+}// namespace wrench
@@ -332,9 +332,10 @@ namespace wrench {
 
         // Add all inter-task dependencies
         for (auto const &parent_task: this->tasks) {
-            for (auto const &child_task: parent_task->getChildren()) {
+            parent_task->forEachChild([&](WorkflowTask *child) {
+                auto child_task = child->getSharedPtr();
                 if (task_compute_actions.find(child_task) == task_compute_actions.end()) {
-                    continue;
+                    return;
                 }
                 std::vector<std::shared_ptr<Action>> parent_actions;
                 if (not task_file_write_actions[parent_task].empty()) {
@@ -353,7 +354,7 @@ namespace wrench {
                         cjob->addActionDependency(parent_action, child_action);
                     }
                 }
-            }
+            });
         }
 
         // Create dummy tasks
@@ -595,15 +596,17 @@ namespace wrench {
                     case Action::STARTED:
                         simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
                         break;
-                    case Action::COMPLETED:
-                        simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileReadCompletion(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                    case Action::COMPLETED: {
+                        auto handle = simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileReadCompletion(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t, handle);
                         break;
+                    }
                     case Action::KILLED:
-                    case Action::FAILED:
-                        simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileReadFailure(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                    case Action::FAILED: {
+                        auto handle = simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileReadFailure(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t, handle);
                         break;
+                    }
                 }
             }
 
@@ -687,15 +690,17 @@ namespace wrench {
                     case Action::STARTED:
                         simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
                         break;
-                    case Action::COMPLETED:
-                        simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileWriteCompletion(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                    case Action::COMPLETED: {
+                        auto handle = simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileWriteCompletion(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t, handle);
                         break;
+                    }
                     case Action::KILLED:
-                    case Action::FAILED:
-                        simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileWriteFailure(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                    case Action::FAILED: {
+                        auto handle = simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileWriteFailure(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t, handle);
                         break;
+                    }
                 }
             }
 
@@ -801,9 +806,9 @@ namespace wrench {
             std::shared_ptr<WorkflowTask> task = state_update.first;
             task->updateReadiness();
             if (task->getState() == WorkflowTask::State::COMPLETED) {
-                for (auto const &child: task->getChildren()) {
+                task->forEachChild([](WorkflowTask *child) {
                     child->updateReadiness();
-                }
+                });
             }
         }
 
@@ -32,6 +32,7 @@ namespace wrench {
                                                                        std::shared_ptr<FailureCause> failure_cause) : DataMovementManagerMessage(),
                                                                                                                       src_location(std::move(src_location)),
                                                                                                                       dst_location(std::move(dst_location)), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<DataManagerFileCopyAnswerMessage>();
     }
 
     /**
@@ -46,6 +47,7 @@ namespace wrench {
                                                                        bool success,
                                                                        std::shared_ptr<FailureCause> failure_cause) : DataMovementManagerMessage(),
                                                                                                                       location(std::move(location)), num_bytes(num_bytes), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<DataManagerFileReadAnswerMessage>();
     }
 
     /**
@@ -58,6 +60,7 @@ namespace wrench {
                                                                          bool success,
                                                                          std::shared_ptr<FailureCause> failure_cause) : DataMovementManagerMessage(),
                                                                                                                         location(std::move(location)), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<DataManagerFileWriteAnswerMessage>();
     }
 
 
@@ -73,6 +76,7 @@ namespace wrench {
                                                                                            bool success,
                                                                                            std::shared_ptr<FailureCause> failure_cause)
         : DataMovementManagerMessage(), location(std::move(location)), num_bytes(num_bytes), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<DataMovementManagerFileReaderThreadMessage>();
     }
 
     /**
@@ -85,6 +89,7 @@ namespace wrench {
                                                                                            bool success,
                                                                                            std::shared_ptr<FailureCause> failure_cause)
         : DataMovementManagerMessage(), location(std::move(location)), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<DataMovementManagerFileWriterThreadMessage>();
     }
 
 
@@ -16,11 +16,13 @@ namespace wrench {
      * @param name The name of the function.
      * @param lambda The function logic implemented as a lambda.
      * @param image The file location of the function's container image.
+     * @param snapshot_size_in_bytes The size of the function's initialized memory snapshot (0 if none).
      */
     Function::Function(const std::string &name,
                        const std::function<std::shared_ptr<FunctionOutput>(const std::shared_ptr<FunctionInput> &, const std::shared_ptr<StorageService> &)> &lambda,
-                       const std::shared_ptr<FileLocation> &image)
-        : _name(name), _lambda(lambda), _image(image) {}
+                       const std::shared_ptr<FileLocation> &image,
+                       sg_size_t snapshot_size_in_bytes)
+        : _name(name), _lambda(lambda), _image(image), _snapshot_size(snapshot_size_in_bytes) {}
 
     /**
      * @brief Gets the name of the function.
@@ -30,6 +32,13 @@ namespace wrench {
 
     std::shared_ptr<FileLocation> Function::getImage() const { return _image; }
 
+    /**
+     * @brief Gets the size of the function's initialized memory snapshot, which is used
+     *        by serverless compute services that use the "snapshot" cold start model.
+     * @return A number of bytes (0 if the function has no snapshot).
+     */
+    sg_size_t Function::getSnapshotSize() const { return _snapshot_size; }
+
     /**
      * @brief Executes the function with the provided input and storage service.
      * @param input The input string for the function.
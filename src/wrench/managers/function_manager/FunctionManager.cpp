@@ -17,6 +17,7 @@
 #include "wrench/managers/function_manager/FunctionManager.h"
 
 #include <wrench/services/compute/serverless/ServerlessComputeServiceMessage.h>
+#include <wrench/services/compute/serverless/ServerlessFrontEnd.h>
 
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/ServiceMessage.h"
@@ -39,6 +40,42 @@ namespace wrench {
     FunctionManager::FunctionManager(const std::string& hostname, S4U_CommPort* creator_commport) : Service(
         hostname, "function_manager") {
         this->creator_commport = creator_commport;
+        this->initMessageHandlers();
+    }
+
+    /**
+     * @brief Set up the table of message handlers used by processNextMessage()
+     */
+    void FunctionManager::initMessageHandlers() {
+        this->message_handlers.add<FunctionManagerWakeupMessage>(
+            [](const std::shared_ptr<FunctionManagerWakeupMessage>& msg) {
+                // wake up!!
+                return true;
+            });
+        this->message_handlers.add<ServiceStopDaemonMessage>(
+            [](const std::shared_ptr<ServiceStopDaemonMessage>& msg) {
+                return false;
+            });
+        this->message_handlers.add<ServerlessComputeServiceFunctionInvocationCompleteMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceFunctionInvocationCompleteMessage>& msg) {
+                processFunctionInvocationComplete(msg->invocation, msg->success, msg->failure_cause);
+                return true;
+            });
+        this->message_handlers.add<FunctionManagerFunctionCompletedMessage>(
+            [](const std::shared_ptr<FunctionManagerFunctionCompletedMessage>& msg) {
+                // Do nothing for now
+                return true;
+            });
+        this->message_handlers.add<FunctionManagerWaitOneMessage>(
+            [this](const std::shared_ptr<FunctionManagerWaitOneMessage>& msg) {
+                processWaitOne(msg->invocation, msg->answer_commport);
+                return true;
+            });
+        this->message_handlers.add<FunctionManagerWaitAllMessage>(
+            [this](const std::shared_ptr<FunctionManagerWaitAllMessage>& msg) {
+                processWaitAll(msg->invocations, msg->answer_commport);
+                return true;
+            });
     }
 
     void FunctionManager::stop() {
@@ -71,15 +108,17 @@ namespace wrench {
      * @param name the name of the function
      * @param lambda the code of the function
      * @param image the location of image to execute the function on
+     * @param snapshot_size_in_bytes the size of the function's initialized memory snapshot (0 if none)
      * @return std::shared_ptr<Function> a shared pointer to the Function object created
      */
     std::shared_ptr<Function> FunctionManager::createFunction(const std::string& name,
                                                               const std::function<std::shared_ptr<FunctionOutput>(
                                                               const std::shared_ptr<FunctionInput>&,
                                                               const std::shared_ptr<StorageService>&)>& lambda,
-                                                              const std::shared_ptr<FileLocation>& image) {
+                                                              const std::shared_ptr<FileLocation>& image,
+                                                              sg_size_t snapshot_size_in_bytes) {
         // Create the notion of a function
-        return std::make_shared<Function>(name, lambda, image);
+        return std::make_shared<Function>(name, lambda, image, snapshot_size_in_bytes);
     }
 
     /**
@@ -111,22 +150,71 @@ namespace wrench {
                                                     RAM_limit_in_bytes, ingress_in_bytes, egress_in_bytes);
     }
 
+    /**
+     * @brief Registers a function with all the ServerlessComputeServices behind a front-end
+     *
+     * @param function the function to register
+     * @param front_end the front-end
+     * @param time_limit_in_seconds the time limit for the function execution
+     * @param disk_space_limit_in_bytes the disk space limit for the function
+     * @param RAM_limit_in_bytes the RAM limit for the function
+     * @param ingress_in_bytes the ingress data limit (this is currently completely IGNORED)
+     * @param egress_in_bytes the egress data limit (this is currently completely IGNORED)
+     * @return the function as registered with its home shard
+     * @throw ExecutionException if the function registration fails
+     */
+    std::shared_ptr<RegisteredFunction> FunctionManager::registerFunction(const std::shared_ptr<Function>& function,
+                                                                          const std::shared_ptr<ServerlessFrontEnd>&
+                                                                          front_end,
+                                                                          double time_limit_in_seconds,
+                                                                          sg_size_t disk_space_limit_in_bytes,
+                                                                          sg_size_t RAM_limit_in_bytes,
+                                                                          sg_size_t ingress_in_bytes,
+                                                                          sg_size_t egress_in_bytes) {
+        WRENCH_INFO("Function [%s] registered with a front-end to %zu compute services", function->getName().c_str(),
+                    front_end->getShards().size());
+        return front_end->registerFunction(function, time_limit_in_seconds, disk_space_limit_in_bytes,
+                                           RAM_limit_in_bytes, ingress_in_bytes, egress_in_bytes);
+    }
+
     /**
      * @brief Invokes a function on a ServerlessComputeService
      *
      * @param registered_function the (registered) function to invoke
      * @param sl_compute_service the ServerlessComputeService to invoke the function on
      * @param function_input the input (object) to the function
+     * @param deadline_in_seconds an optional deadline, relative to the invocation date, by which the
+     *        invocation should complete (used by deadline-aware schedulers and for SLO accounting)
      * @return std::shared_ptr<Invocation> an Invocation object created by the ServerlessComputeService
      */
     std::shared_ptr<Invocation> FunctionManager::invokeFunction(
         const std::shared_ptr<RegisteredFunction>& registered_function,
         const std::shared_ptr<ServerlessComputeService>& sl_compute_service,
-        const std::shared_ptr<FunctionInput>& function_input) {
+        const std::shared_ptr<FunctionInput>& function_input,
+        double deadline_in_seconds) {
         // WRENCH_INFO("Function [%s] invoked with compute service [%s]", registered_function->getFunction()->getName().c_str(), sl_compute_service->getName().c_str());
         // Pass in the function manager's commport as the commport to notify
 
-        return sl_compute_service->invokeFunction(registered_function, function_input, this->commport);
+        return sl_compute_service->invokeFunction(registered_function, function_input, this->commport,
+                                                  deadline_in_seconds);
+    }
+
+    /**
+     * @brief Invokes a function on one of the ServerlessComputeServices behind a front-end
+     *
+     * @param registered_function the function, as registered via the front-end
+     * @param front_end the front-end
+     * @param function_input the input (object) to the function
+     * @param deadline_in_seconds an optional deadline, relative to the invocation date, by which the
+     *        invocation should complete
+     * @return std::shared_ptr<Invocation> an Invocation object created by the selected ServerlessComputeService
+     */
+    std::shared_ptr<Invocation> FunctionManager::invokeFunction(
+        const std::shared_ptr<RegisteredFunction>& registered_function,
+        const std::shared_ptr<ServerlessFrontEnd>& front_end,
+        const std::shared_ptr<FunctionInput>& function_input,
+        double deadline_in_seconds) {
+        return front_end->invokeFunction(registered_function, function_input, this->commport, deadline_in_seconds);
     }
 
     /**
@@ -231,33 +319,12 @@ namespace wrench {
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
         //        WRENCH_INFO("Got a [%s] message", message->getName().c_str());
 
-        if (std::dynamic_pointer_cast<FunctionManagerWakeupMessage>(message)) {
-            // wake up!!
-            return true;
-        }
-        else if (std::dynamic_pointer_cast<ServiceStopDaemonMessage>(message)) {
-            return false;
-        }
-        else if (auto scsfic_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceFunctionInvocationCompleteMessage>(message)) {
-            processFunctionInvocationComplete(scsfic_msg->invocation, scsfic_msg->success, scsfic_msg->failure_cause);
-            return true;
-        }
-        else if (auto fmfc_msg = std::dynamic_pointer_cast<FunctionManagerFunctionCompletedMessage>(message)) {
-            // Do nothing for now
-            return true;
-        }
-        else if (auto wait_one_msg = std::dynamic_pointer_cast<FunctionManagerWaitOneMessage>(message)) {
-            processWaitOne(wait_one_msg->invocation, wait_one_msg->answer_commport);
-            return true;
-        }
-        else if (auto wait_many_msg = std::dynamic_pointer_cast<FunctionManagerWaitAllMessage>(message)) {
-            processWaitAll(wait_many_msg->invocations, wait_many_msg->answer_commport);
-            return true;
-        }
-        else {
+        bool handled;
+        bool keep_going = this->message_handlers.dispatch(message, handled);
+        if (not handled) {
             throw std::runtime_error("Unexpected [" + message->getName() + "] message");
         }
+        return keep_going;
     }
 
     /**
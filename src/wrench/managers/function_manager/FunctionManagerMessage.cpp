@@ -23,6 +23,7 @@ namespace wrench {
      * @brief Message sent to the job manager to wake it up
      */
     FunctionManagerWakeupMessage::FunctionManagerWakeupMessage() : FunctionManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<FunctionManagerWakeupMessage>();
     }
 
     /**
@@ -33,6 +34,7 @@ namespace wrench {
     FunctionManagerFunctionCompletedMessage::FunctionManagerFunctionCompletedMessage(std::shared_ptr<Function> function,
                                                                                      std::shared_ptr<ServerlessComputeService> sl_compute_service)
                                                                                      : FunctionManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<FunctionManagerFunctionCompletedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((function == nullptr) || (sl_compute_service == nullptr)) {
             throw std::invalid_argument("FunctionManagerFunctionCompletedMessage::FunctionManagerFunctionCompletedMessage(): Invalid arguments");
@@ -51,6 +53,7 @@ namespace wrench {
     FunctionManagerWaitOneMessage::FunctionManagerWaitOneMessage(S4U_CommPort *answer_commport,
                                                                  std::shared_ptr<Invocation> invocation) 
                                                                  : FunctionManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<FunctionManagerWaitOneMessage>();
         this->answer_commport = answer_commport;
         this->invocation = std::move(invocation);
     }
@@ -58,6 +61,7 @@ namespace wrench {
     FunctionManagerWaitAllMessage::FunctionManagerWaitAllMessage(S4U_CommPort *answer_commport,
                                                                  std::vector<std::shared_ptr<Invocation>> invocations) 
                                                                  : FunctionManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<FunctionManagerWaitAllMessage>();
         this->answer_commport = answer_commport;
         this->invocations = std::move(invocations);
     }
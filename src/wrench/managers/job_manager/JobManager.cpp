@@ -39,6 +39,43 @@ namespace wrench {
      */
     JobManager::JobManager(const std::string& hostname, S4U_CommPort *creator_commport) : Service(hostname, "job_manager") {
         this->creator_commport = creator_commport;
+        this->initMessageHandlers();
+    }
+
+    /**
+     * @brief Set up the table of message handlers used by processNextMessage()
+     */
+    void JobManager::initMessageHandlers() {
+        this->message_handlers.add<JobManagerWakeupMessage>(
+                [](const std::shared_ptr<JobManagerWakeupMessage> &msg) {
+                    // Just wakeup
+                    return true;
+                });
+        this->message_handlers.add<ServiceStopDaemonMessage>(
+                [](const std::shared_ptr<ServiceStopDaemonMessage> &msg) {
+                    // There shouldn't be any need to clean up any state
+                    return false;
+                });
+        this->message_handlers.add<ComputeServiceCompoundJobDoneMessage>(
+                [this](const std::shared_ptr<ComputeServiceCompoundJobDoneMessage> &msg) {
+                    processCompoundJobDoneMessage(msg->job, msg->compute_service);
+                    return true;
+                });
+        this->message_handlers.add<ComputeServiceCompoundJobFailedMessage>(
+                [this](const std::shared_ptr<ComputeServiceCompoundJobFailedMessage> &msg) {
+                    processCompoundJobFailedMessage(msg->job, msg->compute_service);
+                    return true;
+                });
+        this->message_handlers.add<ComputeServicePilotJobStartedMessage>(
+                [this](const std::shared_ptr<ComputeServicePilotJobStartedMessage> &msg) {
+                    processPilotJobStart(msg->job, msg->compute_service);
+                    return true;
+                });
+        this->message_handlers.add<ComputeServicePilotJobExpiredMessage>(
+                [this](const std::shared_ptr<ComputeServicePilotJobExpiredMessage> &msg) {
+                    processPilotJobExpiration(msg->job, msg->compute_service);
+                    return true;
+                });
     }
 
     /**
@@ -866,48 +903,53 @@ namespace wrench {
         WRENCH_DEBUG("Job Manager got a %s message", message->getName().c_str());
         WRENCH_INFO("Job Manager got a %s message", message->getName().c_str());
 
-        if (std::dynamic_pointer_cast<JobManagerWakeupMessage>(message)) {
-            // Just wakeup
-            return true;
-        } else if (std::dynamic_pointer_cast<ServiceStopDaemonMessage>(message)) {
-            // There shouldn't be any need to clean up any state
-            return false;
-        } else if (auto msg = std::dynamic_pointer_cast<ComputeServiceCompoundJobDoneMessage>(message)) {
-            // Is this in fact a standard job???
-            if (this->cjob_to_sjob_map.find(msg->job) != this->cjob_to_sjob_map.end()) {
-                auto sjob = this->cjob_to_sjob_map[msg->job];
-                this->cjob_to_sjob_map.erase(msg->job);
-                processStandardJobCompletion(sjob, msg->compute_service);
-            } else {
-                processCompoundJobCompletion(msg->job, msg->compute_service);
-            }
-            return true;
-        } else if (auto msg = std::dynamic_pointer_cast<ComputeServiceCompoundJobFailedMessage>(message)) {
-            if (this->cjob_to_sjob_map.find(msg->job) != this->cjob_to_sjob_map.end()) {
-                auto sjob = this->cjob_to_sjob_map[msg->job];
-                this->cjob_to_sjob_map.erase(msg->job);
-                processStandardJobFailure(sjob, msg->compute_service);
-            } else if (this->cjob_to_pjob_map.find(msg->job) != this->cjob_to_pjob_map.end()) {
-                auto pjob = this->cjob_to_pjob_map[msg->job];
-                auto pjob_action = *(msg->job->getActions().begin());
-                if (std::dynamic_pointer_cast<JobTimeout>(pjob_action->getFailureCause())) {
-                    processPilotJobExpiration(pjob, msg->compute_service);
-                } else {
-                    throw std::runtime_error("JobManager::processNextMessage(): Received unexpected pilot job failure cause " + pjob_action->getFailureCause()->toString());
-                    //                    processPilotJobFailure(pjob, msg->compute_service, pjob_action->getFailureCause());
-                }
+        bool handled;
+        bool keep_going = this->message_handlers.dispatch(message, handled);
+        if (not handled) {
+            throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+        }
+        return keep_going;
+    }
+
+    /**
+     * @brief Process a "compound job done" message, which may in fact pertain to a standard job
+     * @param job the compound job
+     * @param compute_service the compute service on which the job ran
+     */
+    void JobManager::processCompoundJobDoneMessage(const std::shared_ptr<CompoundJob> &job,
+                                                   const std::shared_ptr<ComputeService> &compute_service) {
+        // Is this in fact a standard job???
+        if (this->cjob_to_sjob_map.find(job) != this->cjob_to_sjob_map.end()) {
+            auto sjob = this->cjob_to_sjob_map[job];
+            this->cjob_to_sjob_map.erase(job);
+            processStandardJobCompletion(sjob, compute_service);
+        } else {
+            processCompoundJobCompletion(job, compute_service);
+        }
+    }
+
+    /**
+     * @brief Process a "compound job failed" message, which may in fact pertain to a standard job or a pilot job
+     * @param job the compound job
+     * @param compute_service the compute service on which the job ran
+     */
+    void JobManager::processCompoundJobFailedMessage(const std::shared_ptr<CompoundJob> &job,
+                                                     const std::shared_ptr<ComputeService> &compute_service) {
+        if (this->cjob_to_sjob_map.find(job) != this->cjob_to_sjob_map.end()) {
+            auto sjob = this->cjob_to_sjob_map[job];
+            this->cjob_to_sjob_map.erase(job);
+            processStandardJobFailure(sjob, compute_service);
+        } else if (this->cjob_to_pjob_map.find(job) != this->cjob_to_pjob_map.end()) {
+            auto pjob = this->cjob_to_pjob_map[job];
+            auto pjob_action = *(job->getActions().begin());
+            if (std::dynamic_pointer_cast<JobTimeout>(pjob_action->getFailureCause())) {
+                processPilotJobExpiration(pjob, compute_service);
             } else {
-                processCompoundJobFailure(msg->job, msg->compute_service);
+                throw std::runtime_error("JobManager::processNextMessage(): Received unexpected pilot job failure cause " + pjob_action->getFailureCause()->toString());
+                //                    processPilotJobFailure(pjob, compute_service, pjob_action->getFailureCause());
             }
-            return true;
-        } else if (auto msg = std::dynamic_pointer_cast<ComputeServicePilotJobStartedMessage>(message)) {
-            processPilotJobStart(msg->job, msg->compute_service);
-            return true;
-        } else if (auto msg = std::dynamic_pointer_cast<ComputeServicePilotJobExpiredMessage>(message)) {
-            processPilotJobExpiration(msg->job, msg->compute_service);
-            return true;
         } else {
-            throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+            processCompoundJobFailure(job, compute_service);
         }
     }
 
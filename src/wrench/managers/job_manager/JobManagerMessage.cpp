@@ -30,6 +30,7 @@ namespace wrench {
                                                                                  std::shared_ptr<ComputeService> compute_service,
                                                                                  std::map<std::shared_ptr<WorkflowTask>, WorkflowTask::State> necessary_state_changes)
         : JobManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<JobManagerStandardJobCompletedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr)) {
             throw std::invalid_argument("JobManagerStandardJobCompletedMessage::JobManagerStandardJobCompletedMessage(): Invalid arguments");
@@ -53,6 +54,7 @@ namespace wrench {
                                                                            std::map<std::shared_ptr<WorkflowTask>, WorkflowTask::State> necessary_state_changes,
                                                                            std::set<std::shared_ptr<WorkflowTask>> necessary_failure_count_increments,
                                                                            std::shared_ptr<FailureCause> cause) : JobManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<JobManagerStandardJobFailedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr) || (cause == nullptr)) {
             throw std::invalid_argument("JobManagerStandardJobFailedMessage::JobManagerStandardJobFailedMessage(): Invalid arguments");
@@ -92,6 +94,7 @@ namespace wrench {
      */
     JobManagerCompoundJobCompletedMessage::JobManagerCompoundJobCompletedMessage(std::shared_ptr<CompoundJob> job,
                                                                                  std::shared_ptr<ComputeService> compute_service) : JobManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<JobManagerCompoundJobCompletedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr)) {
             throw std::invalid_argument("JobManagerCompoundJobCompletedMessage::JobManagerCompoundJobCompletedMessage(): Invalid arguments");
@@ -110,6 +113,7 @@ namespace wrench {
     JobManagerCompoundJobFailedMessage::JobManagerCompoundJobFailedMessage(std::shared_ptr<CompoundJob> job,
                                                                            std::shared_ptr<ComputeService> compute_service,
                                                                            std::shared_ptr<FailureCause> cause) : JobManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<JobManagerCompoundJobFailedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr)) {
             throw std::invalid_argument("JobManagerCompoundJobFailedMessage::JobManagerCompoundJobFailedMessage(): Invalid arguments");
@@ -124,5 +128,6 @@ namespace wrench {
      * @brief Message sent to the job manager to wake it up
      */
     JobManagerWakeupMessage::JobManagerWakeupMessage() : JobManagerMessage() {
+        this->kind = SimulationMessage::getKindOf<JobManagerWakeupMessage>();
     }
 }// namespace wrench
@@ -50,15 +50,42 @@ namespace wrench {
     }
 
     /**
-      * @brief Set a property of the Service
+      * @brief Set a property of the Service. The value is parsed once here, so
+      *        that typed property lookups do not parse strings.
       * @param property: the property
       * @param value: the property value
       */
     void Service::setProperty(WRENCH_PROPERTY_TYPE property, const std::string &value) {
-        if (this->property_list.find(property) != this->property_list.end()) {
-            this->property_list[property] = value;
+        if (property < 0) {
+            throw std::invalid_argument("Service::setProperty(): invalid property index");
+        }
+        this->property_list[property] = value;
+
+        if ((unsigned long) property >= this->parsed_property_values.size()) {
+            this->parsed_property_values.resize(property + 1);
+        }
+        auto &parsed = this->parsed_property_values[property];
+        parsed = ParsedPropertyValue();
+        parsed.is_set = true;
+
+        if (value == "infinity") {
+            parsed.is_double = parsed.is_unsigned_long = parsed.is_time = parsed.is_size = parsed.is_bandwidth = true;
+            parsed.as_double = parsed.as_time = parsed.as_bandwidth = DBL_MAX;
+            parsed.as_unsigned_long = ULONG_MAX;
+            parsed.as_size = LLONG_MAX;
+        } else if (value == "zero") {
+            parsed.is_double = parsed.is_unsigned_long = parsed.is_time = parsed.is_size = parsed.is_bandwidth = true;
         } else {
-            this->property_list.insert(std::make_pair(property, value));
+            parsed.is_double = (sscanf(value.c_str(), "%lf", &parsed.as_double) == 1);
+            parsed.is_unsigned_long = (sscanf(value.c_str(), "%lu", &parsed.as_unsigned_long) == 1);
+            if (value == "true" or value == "True") {
+                parsed.is_boolean = true;
+                parsed.as_boolean = true;
+            } else if (value == "false" or value == "False") {
+                parsed.is_boolean = true;
+                parsed.as_boolean = false;
+            }
+            // Values with units are parsed lazily, as not all properties are meant to have units
         }
     }
 
@@ -69,7 +96,32 @@ namespace wrench {
     * @param value: the message payload value
     */
     void Service::setMessagePayload(WRENCH_MESSAGEPAYLOAD_TYPE messagepayload, sg_size_t value) {
+        if (messagepayload < 0) {
+            throw std::invalid_argument("Service::setMessagePayload(): invalid message_payload index");
+        }
         this->messagepayload_list[messagepayload] = value;
+        if ((unsigned long) messagepayload >= this->messagepayload_values.size()) {
+            this->messagepayload_values.resize(messagepayload + 1, 0);
+            this->messagepayload_is_set.resize(messagepayload + 1, false);
+        }
+        this->messagepayload_values[messagepayload] = value;
+        this->messagepayload_is_set[messagepayload] = true;
+    }
+
+    /**
+     * @brief Helper method to get the parsed value of a property
+     * @param property: the property
+     * @param caller: the name of the calling method (for error messages)
+     * @return the parsed property value
+     */
+    Service::ParsedPropertyValue &Service::getParsedPropertyValue(WRENCH_PROPERTY_TYPE property, const std::string &caller) {
+        if ((property < 0) or ((unsigned long) property >= this->parsed_property_values.size()) or
+            (not this->parsed_property_values[property].is_set)) {
+            throw std::invalid_argument(
+                    caller + ": Cannot find value for property " + ServiceProperty::translatePropertyType(property) +
+                    " (perhaps a derived service class does not provide a default value?)");
+        }
+        return this->parsed_property_values[property];
     }
 
     /**
@@ -79,11 +131,7 @@ namespace wrench {
      *
      */
     std::string Service::getPropertyValueAsString(WRENCH_PROPERTY_TYPE property) {
-        if (this->property_list.find(property) == this->property_list.end()) {
-            throw std::invalid_argument(
-                    "Service::getPropertyValueAsString(): Cannot find value for property " + ServiceProperty::translatePropertyType(property) +
-                    " (perhaps a derived service class does not provide a default value?)");
-        }
+        this->getParsedPropertyValue(property, "Service::getPropertyValueAsString()");
         return this->property_list[property];
     }
 
@@ -94,22 +142,13 @@ namespace wrench {
      *
      */
     double Service::getPropertyValueAsDouble(WRENCH_PROPERTY_TYPE property) {
-        double value;
-        std::string string_value;
-        string_value = this->getPropertyValueAsString(property);
-
-        if (string_value == "infinity") {
-            return DBL_MAX;
-        }
-        if (string_value == "zero") {
-            return 0;
-        }
-        if (sscanf(string_value.c_str(), "%lf", &value) != 1) {
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsDouble()");
+        if (not parsed.is_double) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsDouble(): Invalid double property value " + ServiceProperty::translatePropertyType(property) + " " +
                     this->getPropertyValueAsString(property));
         }
-        return value;
+        return parsed.as_double;
     }
 
     /**
@@ -138,7 +177,12 @@ namespace wrench {
      * @return the time in second
      */
     double Service::getPropertyValueAsTimeInSecond(WRENCH_PROPERTY_TYPE property) {
-        return this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_time);
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsTimeInSecond()");
+        if (not parsed.is_time) {
+            parsed.as_time = this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_time);
+            parsed.is_time = true;
+        }
+        return parsed.as_time;
     }
 
     /**
@@ -147,18 +191,12 @@ namespace wrench {
      * @return the size in byte
      */
     sg_size_t Service::getPropertyValueAsSizeInByte(WRENCH_PROPERTY_TYPE property) {
-        sg_size_t value;
-        std::string string_value;
-        string_value = this->getPropertyValueAsString(property);
-        if (string_value == "infinity") {
-            return LLONG_MAX;
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsSizeInByte()");
+        if (not parsed.is_size) {
+            parsed.as_size = static_cast<sg_size_t>(this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_size));
+            parsed.is_size = true;
         }
-        if (string_value == "zero") {
-            return 0;
-        }
-        value = static_cast<sg_size_t>(this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_size));
-
-        return value;
+        return parsed.as_size;
     }
 
     /**
@@ -167,7 +205,12 @@ namespace wrench {
      * @return the bandwidth in byte/sec
      */
     double Service::getPropertyValueAsBandwidthInBytePerSecond(WRENCH_PROPERTY_TYPE property) {
-        return this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_bandwidth);
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsBandwidthInBytePerSecond()");
+        if (not parsed.is_bandwidth) {
+            parsed.as_bandwidth = this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_bandwidth);
+            parsed.is_bandwidth = true;
+        }
+        return parsed.as_bandwidth;
     }
 
     /**
@@ -177,22 +220,14 @@ namespace wrench {
     *
     */
     unsigned long Service::getPropertyValueAsUnsignedLong(WRENCH_PROPERTY_TYPE property) {
-        unsigned long value;
-        std::string string_value;
-        string_value = this->getPropertyValueAsString(property);
-        if (string_value == "infinity") {
-            return ULONG_MAX;
-        }
-        if (string_value == "zero") {
-            return 0;
-        }
-        if (sscanf(string_value.c_str(), "%lu", &value) != 1) {
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsUnsignedLong()");
+        if (not parsed.is_unsigned_long) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsUnsignedLong(): Invalid unsigned long property value " + ServiceProperty::translatePropertyType(property) +
                     " " +
                     this->getPropertyValueAsString(property));
         }
-        return value;
+        return parsed.as_unsigned_long;
     }
 
     /**
@@ -202,7 +237,8 @@ namespace wrench {
      *
      */
     sg_size_t Service::getMessagePayloadValue(WRENCH_MESSAGEPAYLOAD_TYPE message_payload) {
-        if (this->messagepayload_list.find(message_payload) == this->messagepayload_list.end()) {
+        if ((message_payload < 0) or ((unsigned long) message_payload >= this->messagepayload_is_set.size()) or
+            (not this->messagepayload_is_set[message_payload])) {
             try {
                 throw std::invalid_argument(
                         "Service::getMessagePayloadValue(): Cannot find value for message_payload " +
@@ -213,7 +249,7 @@ namespace wrench {
                         "Service::getMessagePayloadValue(): invalid message_payload index");
             }
         }
-        return this->messagepayload_list[message_payload];
+        return this->messagepayload_values[message_payload];
     }
 
     /**
@@ -239,17 +275,13 @@ namespace wrench {
      *
      */
     bool Service::getPropertyValueAsBoolean(WRENCH_PROPERTY_TYPE property) {
-        std::string string_value;
-        string_value = this->getPropertyValueAsString(property);
-        if (string_value == "true" or string_value == "True") {
-            return true;
-        } else if (string_value == "false" or string_value == "False") {
-            return false;
-        } else {
+        auto &parsed = this->getParsedPropertyValue(property, "Service::getPropertyValueAsBoolean()");
+        if (not parsed.is_boolean) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsBoolean(): Invalid boolean property value " + ServiceProperty::translatePropertyType(property) + " " +
                     this->getPropertyValueAsString(property));
         }
+        return parsed.as_boolean;
     }
 
     /**
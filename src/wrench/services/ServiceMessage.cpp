@@ -28,7 +28,9 @@ namespace wrench {
     ServiceStopDaemonMessage::ServiceStopDaemonMessage(S4U_CommPort *ack_commport, bool send_failure_notifications,
                                                        ComputeService::TerminationCause termination_cause,
                                                        sg_size_t payload)
-        : ServiceMessage(payload), ack_commport(ack_commport), send_failure_notifications(send_failure_notifications), termination_cause(termination_cause) {}
+        : ServiceMessage(payload), ack_commport(ack_commport), send_failure_notifications(send_failure_notifications), termination_cause(termination_cause) {
+        this->kind = SimulationMessage::getKindOf<ServiceStopDaemonMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -36,7 +38,9 @@ namespace wrench {
      *
      */
     ServiceDaemonStoppedMessage::ServiceDaemonStoppedMessage(sg_size_t payload)
-        : ServiceMessage(payload) {}
+        : ServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ServiceDaemonStoppedMessage>();
+    }
 
 
 }// namespace wrench
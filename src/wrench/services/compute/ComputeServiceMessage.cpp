@@ -34,6 +34,7 @@ namespace wrench {
             std::shared_ptr<CompoundJob> job,
             std::map<std::string, std::string> service_specific_args,
             sg_size_t payload) : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceSubmitCompoundJobRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (job == nullptr)) {
             throw std::invalid_argument(
@@ -59,6 +60,7 @@ namespace wrench {
                                                                                                bool success,
                                                                                                std::shared_ptr<FailureCause> failure_cause,
                                                                                                sg_size_t payload) : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceSubmitCompoundJobAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr) ||
             (success && (failure_cause != nullptr)) ||
@@ -84,6 +86,7 @@ namespace wrench {
                                                                                std::shared_ptr<ComputeService> cs,
                                                                                sg_size_t payload)
         : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceCompoundJobDoneMessage>();
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (cs == nullptr)) {
@@ -106,6 +109,7 @@ namespace wrench {
                                                                                    std::shared_ptr<ComputeService> cs,
                                                                                    sg_size_t payload)
         : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceCompoundJobFailedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (cs == nullptr)) {
             throw std::invalid_argument(
@@ -127,6 +131,7 @@ namespace wrench {
             S4U_CommPort *answer_commport,
             std::shared_ptr<CompoundJob> job,
             sg_size_t payload) : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceTerminateCompoundJobRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (job == nullptr)) {
             throw std::invalid_argument(
@@ -151,6 +156,7 @@ namespace wrench {
                                                                                                      bool success,
                                                                                                      std::shared_ptr<FailureCause> failure_cause,
                                                                                                      sg_size_t payload) : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceTerminateCompoundJobAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (compute_service == nullptr) ||
             (success && (failure_cause != nullptr)) ||
@@ -177,6 +183,7 @@ namespace wrench {
                                                                                std::shared_ptr<ComputeService> cs,
                                                                                sg_size_t payload)
         : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServicePilotJobStartedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (cs == nullptr)) {
             throw std::invalid_argument(
@@ -198,6 +205,7 @@ namespace wrench {
                                                                                std::shared_ptr<ComputeService> cs,
                                                                                sg_size_t payload)
         : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServicePilotJobExpiredMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((job == nullptr) || (cs == nullptr)) {
             throw std::invalid_argument(
@@ -221,6 +229,7 @@ namespace wrench {
             const std::string &key,
             sg_size_t payload)
         : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceResourceInformationRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) or key.empty()) {
             throw std::invalid_argument(
@@ -240,7 +249,9 @@ namespace wrench {
      */
     ComputeServiceResourceInformationAnswerMessage::ComputeServiceResourceInformationAnswerMessage(
             std::map<std::string, double> info, sg_size_t payload)
-        : ComputeServiceMessage(payload), info(std::move(info)) {}
+        : ComputeServiceMessage(payload), info(std::move(info)) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceResourceInformationAnswerMessage>();
+    }
 
 
     /**
@@ -254,6 +265,7 @@ namespace wrench {
     */
     ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage::ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage(
             S4U_CommPort *answer_commport, unsigned long num_cores, sg_size_t ram, sg_size_t payload) : ComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage>();
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (not answer_commport) {
@@ -274,5 +286,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesAnswerMessage::ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesAnswerMessage(
-            bool answer, sg_size_t payload) : ComputeServiceMessage(payload), answer(answer) {}
+            bool answer, sg_size_t payload) : ComputeServiceMessage(payload), answer(answer) {
+        this->kind = SimulationMessage::getKindOf<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesAnswerMessage>();
+    }
 }// namespace wrench
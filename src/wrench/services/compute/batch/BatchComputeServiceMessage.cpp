@@ -31,6 +31,7 @@ namespace wrench {
                                                                                      std::string job_args_to_scheduler,
                                                                                      sg_size_t payload)
             : BatchComputeServiceMessage("BATCH_SIMULATION_BEGINS", payload) {
+        this->kind = SimulationMessage::getKindOf<BatchSimulationBeginsToSchedulerMessage>();
       if (job_args_to_scheduler.empty()) {
         throw std::invalid_argument(
                 "BatchSimulationBeginsToSchedulerMessage::BatchSimulationBeginsToSchedulerMessage(): Empty job arguments to scheduler");
@@ -53,6 +54,7 @@ namespace wrench {
      */
     BatchSchedReadyMessage::BatchSchedReadyMessage(std::string &answer_commport, sg_size_t payload)
             : BatchComputeServiceMessage("BATCH_SCHED_READY", payload) {
+        this->kind = SimulationMessage::getKindOf<BatchSchedReadyMessage>();
       if (answer_commport.empty()) {
         throw std::invalid_argument(
                 "BatchSchedReadyMessage::BatchSchedReadyMessage(): Empty answer commport");
@@ -72,6 +74,7 @@ namespace wrench {
                                                                            std::string batsched_decision_reply,
                                                                            sg_size_t payload)
         : BatchComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<BatchExecuteJobFromBatSchedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr) {
             throw std::invalid_argument(
@@ -94,6 +97,7 @@ namespace wrench {
      */
     BatchQueryAnswerMessage::BatchQueryAnswerMessage(double estimated_job_start_time, sg_size_t payload)
         : BatchComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<BatchQueryAnswerMessage>();
         this->estimated_start_time = estimated_job_start_time;
     }
 
@@ -111,6 +115,7 @@ namespace wrench {
                                                                                std::string job_args_to_scheduler,
                                                                                sg_size_t payload)
             : BatchComputeServiceMessage("BATCH_JOB_SUBMISSION_TO_SCHEDULER", payload) {
+        this->kind = SimulationMessage::getKindOf<BatchJobSubmissionToSchedulerMessage>();
       if (job_args_to_scheduler.empty()) {
         throw std::invalid_argument(
                 "BatchJobSubmissionToSchedulerMessage::BatchJobSubmissionToSchedulerMessage(): Empty job arguments to scheduler");
@@ -136,7 +141,9 @@ namespace wrench {
      *
      */
     BatchJobReplyFromSchedulerMessage::BatchJobReplyFromSchedulerMessage(std::string reply, sg_size_t payload)
-            : BatchComputeServiceMessage("BATCH_JOB_REPLY_FROM_SCHEDULER", payload), reply(reply) {}
+            : BatchComputeServiceMessage("BATCH_JOB_REPLY_FROM_SCHEDULER", payload), reply(reply) {
+        this->kind = SimulationMessage::getKindOf<BatchJobReplyFromSchedulerMessage>();
+    }
 
 #endif
 
@@ -150,6 +157,7 @@ namespace wrench {
     BatchComputeServiceJobRequestMessage::BatchComputeServiceJobRequestMessage(S4U_CommPort *answer_commport,
                                                                                std::shared_ptr<BatchJob> job, sg_size_t payload)
         : BatchComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<BatchComputeServiceJobRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (job == nullptr) {
             throw std::invalid_argument(
@@ -172,6 +180,7 @@ namespace wrench {
      */
     AlarmJobTimeOutMessage::AlarmJobTimeOutMessage(std::shared_ptr<BatchJob> job, sg_size_t payload)
         : ServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<AlarmJobTimeOutMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (job == nullptr) {
             throw std::invalid_argument(
@@ -189,7 +198,9 @@ namespace wrench {
      *
      */
     AlarmNotifyBatschedMessage::AlarmNotifyBatschedMessage(std::string job_id, sg_size_t payload)
-            : ServiceMessage("ALARM_NOTIFY_BATSCHED", payload), job_id(job_id) {}
+            : ServiceMessage("ALARM_NOTIFY_BATSCHED", payload), job_id(job_id) {
+        this->kind = SimulationMessage::getKindOf<AlarmNotifyBatschedMessage>();
+    }
 #endif
 
 }// namespace wrench
@@ -31,6 +31,7 @@ namespace wrench {
      */
     CloudComputeServiceGetExecutionHostsRequestMessage::CloudComputeServiceGetExecutionHostsRequestMessage(
             S4U_CommPort *answer_commport, sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceGetExecutionHostsRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr) {
             throw std::invalid_argument(
@@ -48,7 +49,9 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     CloudComputeServiceGetExecutionHostsAnswerMessage::CloudComputeServiceGetExecutionHostsAnswerMessage(
-            std::vector<std::string> &execution_hosts, sg_size_t payload) : CloudComputeServiceMessage(payload), execution_hosts(execution_hosts) {}
+            std::vector<std::string> &execution_hosts, sg_size_t payload) : CloudComputeServiceMessage(payload), execution_hosts(execution_hosts) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceGetExecutionHostsAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -72,6 +75,7 @@ namespace wrench {
             WRENCH_PROPERTY_COLLECTION_TYPE property_list,
             WRENCH_MESSAGE_PAYLOAD_COLLECTION_TYPE messagepayload_list,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceCreateVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (ram_memory < 0.0)) {
             //        std::cerr << answer_commport << " - " << pm_hostname << " - " << vm_name << std::endl;
@@ -99,7 +103,9 @@ namespace wrench {
                                                                                        std::string &vm_name,
                                                                                        std::shared_ptr<FailureCause> failure_cause,
                                                                                        sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), vm_name(vm_name),
-                                                                                                         failure_cause(std::move(failure_cause)) {}
+                                                                                                         failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceCreateVMAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -117,6 +123,7 @@ namespace wrench {
             bool send_failure_notifications,
             ComputeService::TerminationCause termination_cause,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceShutdownVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || vm_name.empty()) {
             throw std::invalid_argument(
@@ -138,7 +145,9 @@ namespace wrench {
      */
     CloudComputeServiceShutdownVMAnswerMessage::CloudComputeServiceShutdownVMAnswerMessage(bool success,
                                                                                            std::shared_ptr<FailureCause> failure_cause,
-                                                                                           sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {}
+                                                                                           sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceShutdownVMAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -152,6 +161,7 @@ namespace wrench {
             S4U_CommPort *answer_commport,
             const std::string &vm_name,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceStartVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || vm_name.empty()) {
             throw std::invalid_argument(
@@ -174,7 +184,9 @@ namespace wrench {
                                                                                      std::shared_ptr<BareMetalComputeService> cs,
                                                                                      std::shared_ptr<FailureCause> failure_cause,
                                                                                      sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), cs(std::move(cs)),
-                                                                                                       failure_cause(std::move(failure_cause)) {}
+                                                                                                       failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceStartVMAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -188,6 +200,7 @@ namespace wrench {
             S4U_CommPort *answer_commport,
             const std::string &vm_name,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceSuspendVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || vm_name.empty()) {
             throw std::invalid_argument(
@@ -207,7 +220,9 @@ namespace wrench {
      */
     CloudComputeServiceSuspendVMAnswerMessage::CloudComputeServiceSuspendVMAnswerMessage(bool success,
                                                                                          std::shared_ptr<FailureCause> failure_cause,
-                                                                                         sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {}
+                                                                                         sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceSuspendVMAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -221,6 +236,7 @@ namespace wrench {
             S4U_CommPort *answer_commport,
             const std::string &vm_name,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceResumeVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || vm_name.empty()) {
             throw std::invalid_argument(
@@ -240,7 +256,9 @@ namespace wrench {
      */
     CloudComputeServiceResumeVMAnswerMessage::CloudComputeServiceResumeVMAnswerMessage(bool success,
                                                                                        std::shared_ptr<FailureCause> failure_cause,
-                                                                                       sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {}
+                                                                                       sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceResumeVMAnswerMessage>();
+    }
 
 
     /**
@@ -255,6 +273,7 @@ namespace wrench {
             S4U_CommPort *answer_commport,
             const std::string &vm_name,
             sg_size_t payload) : CloudComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceDestroyVMRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || vm_name.empty()) {
             throw std::invalid_argument(
@@ -274,7 +293,9 @@ namespace wrench {
      */
     CloudComputeServiceDestroyVMAnswerMessage::CloudComputeServiceDestroyVMAnswerMessage(bool success,
                                                                                          std::shared_ptr<FailureCause> failure_cause,
-                                                                                         sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {}
+                                                                                         sg_size_t payload) : CloudComputeServiceMessage(payload), success(success), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<CloudComputeServiceDestroyVMAnswerMessage>();
+    }
 
 
 }// namespace wrench
@@ -28,7 +28,9 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     NegotiatorCompletionMessage::NegotiatorCompletionMessage(std::set<std::shared_ptr<Job>> scheduled_jobs, sg_size_t payload)
-        : HTCondorCentralManagerServiceMessage(payload), scheduled_jobs(std::move(std::move(scheduled_jobs))) {}
+        : HTCondorCentralManagerServiceMessage(payload), scheduled_jobs(std::move(std::move(scheduled_jobs))) {
+        this->kind = SimulationMessage::getKindOf<NegotiatorCompletionMessage>();
+    }
 
 
     /**
@@ -37,6 +39,8 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     CentralManagerWakeUpMessage::CentralManagerWakeUpMessage(sg_size_t payload)
-        : HTCondorCentralManagerServiceMessage(payload) {}
+        : HTCondorCentralManagerServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CentralManagerWakeUpMessage>();
+    }
 
 }// namespace wrench
@@ -8,6 +8,7 @@
  */
 
 #include "wrench/services/compute/serverless/Invocation.h"
+#include "wrench/simulation/Simulation.h"
 
 #include "wrench/logging/TerminalOutput.h"
 WRENCH_LOG_CATEGORY(Invocations, "Log category for Serverless invocations");
@@ -67,6 +68,37 @@ namespace wrench {
         return _end_date;
     }
 
+    /**
+    * @brief Get the invocation's deadline
+    * @return A simulated date (or -1.0 if the invocation has no deadline)
+    */
+    double Invocation::getDeadline() const {
+        return _deadline;
+    }
+
+    /**
+     * @brief Checks if the invocation has a deadline.
+     * @return True if the invocation has a deadline, false otherwise.
+     */
+    bool Invocation::hasDeadline() const {
+        return _deadline >= 0.0;
+    }
+
+    /**
+     * @brief Checks if the invocation has missed its deadline, i.e., has completed
+     *        after its deadline or has not completed and its deadline has passed.
+     * @return True if the deadline was missed, false otherwise (including if there is no deadline).
+     */
+    bool Invocation::hasMissedDeadline() const {
+        if (not hasDeadline()) {
+            return false;
+        }
+        if (_end_date >= 0.0) {
+            return _end_date > _deadline;
+        }
+        return Simulation::getCurrentSimulatedDate() > _deadline;
+    }
+
     /**
      * @brief Checks if the invocation is done.
      * @return True if the invocation is done, false otherwise.
@@ -50,12 +50,32 @@ namespace wrench {
         // Set default and specified properties
         this->setProperties(this->default_property_values, property_list);
 
+        // Check the cold start model
+        auto cold_start_model = this->getPropertyValueAsString(ServerlessComputeServiceProperty::COLD_START_MODEL);
+        if ((cold_start_model != "container") and (cold_start_model != "snapshot")) {
+            throw std::invalid_argument("ServerlessComputeService::ServerlessComputeService(): Invalid " +
+                                        ServerlessComputeServiceProperty::translatePropertyType(
+                                            ServerlessComputeServiceProperty::COLD_START_MODEL) +
+                                        " property value " + cold_start_model);
+        }
+        this->use_snapshots = (cold_start_model == "snapshot");
+        auto working_set_fraction = this->getPropertyValueAsDouble(
+            ServerlessComputeServiceProperty::SNAPSHOT_WORKING_SET_FRACTION);
+        if ((working_set_fraction < 0.0) or (working_set_fraction > 1.0)) {
+            throw std::invalid_argument("ServerlessComputeService::ServerlessComputeService(): Invalid " +
+                                        ServerlessComputeServiceProperty::translatePropertyType(
+                                            ServerlessComputeServiceProperty::SNAPSHOT_WORKING_SET_FRACTION) +
+                                        " property value (should be between 0.0 and 1.0)");
+        }
+
         // Create the state of the system object
         _state_of_the_system = std::shared_ptr<ServerlessStateOfTheSystem>(
             new ServerlessStateOfTheSystem(compute_hosts));
         _state_of_the_system->_head_storage_service_mount_point = head_node_storage_mount_point;
 
         _scheduler = scheduler;
+
+        this->initMessageHandlers();
     }
 
     /**
@@ -136,6 +156,59 @@ namespace wrench {
         return false;
     }
 
+    /**
+     * @brief Get the number of invocations that have been accepted by the service but have
+     *        not completed yet (no simulated overhead)
+     * @return A number of invocations
+     */
+    unsigned long ServerlessComputeService::getNumOutstandingInvocationsZeroTime() const {
+        return _state_of_the_system->getNumOutstandingInvocations();
+    }
+
+    /**
+     * @brief Get the load of the service, i.e., its number of outstanding invocations
+     *        divided by its total number of cores (no simulated overhead)
+     * @return A load value
+     */
+    double ServerlessComputeService::getLoadZeroTime() const {
+        return static_cast<double>(_state_of_the_system->getNumOutstandingInvocations()) /
+               static_cast<double>(_state_of_the_system->getTotalNumCores());
+    }
+
+    /**
+     * @brief Get the number of completed invocations that had a deadline (no simulated overhead)
+     * @return A number of invocations
+     */
+    unsigned long ServerlessComputeService::getNumCompletedInvocationsWithDeadlineZeroTime() const {
+        return _state_of_the_system->getNumCompletedInvocationsWithDeadline();
+    }
+
+    /**
+     * @brief Get the number of completed invocations that have missed their deadline (no simulated overhead)
+     * @return A number of invocations
+     */
+    unsigned long ServerlessComputeService::getNumSLOViolationsZeroTime() const {
+        return _state_of_the_system->getNumSLOViolations();
+    }
+
+    /**
+     * @brief Get the number of images that have been evicted from the head node's storage
+     *        to make room for other images (no simulated overhead)
+     * @return A number of images
+     */
+    unsigned long ServerlessComputeService::getNumHeadStorageImageEvictionsZeroTime() const {
+        return _state_of_the_system->getNumHeadStorageImageEvictions();
+    }
+
+    /**
+     * @brief Get the number of invocations that were started by restoring a snapshot rather
+     *        than by paying the container startup overhead (no simulated overhead)
+     * @return A number of invocations
+     */
+    unsigned long ServerlessComputeService::getNumSnapshotRestoresZeroTime() const {
+        return _state_of_the_system->getNumSnapshotRestores();
+    }
+
     /**
      * @brief Method to submit a compound job to the service
      *
@@ -262,16 +335,18 @@ namespace wrench {
      * @param registered_function the (registered) function to invoke
      * @param input the input to the function
      * @param notify_commport the ExecutionController commport to notify
+     * @param deadline_in_seconds the invocation's deadline, relative to the invocation date (-1.0 if none)
      * @return std::shared_ptr<Invocation> Pointer to the invocation created by the ServerlessComputeService
      */
     std::shared_ptr<Invocation> ServerlessComputeService::invokeFunction(
         const std::shared_ptr<RegisteredFunction>& registered_function, const std::shared_ptr<FunctionInput>& input,
-        S4U_CommPort* notify_commport) {
+        S4U_CommPort* notify_commport, double deadline_in_seconds) {
         const auto answer_commport = S4U_CommPort::getTemporaryCommPort();
         this->commport->dputMessage(
             new ServerlessComputeServiceFunctionInvocationRequestMessage(answer_commport,
                                                                          registered_function, input,
-                                                                         notify_commport, this->getMessagePayloadValue(
+                                                                         notify_commport, deadline_in_seconds,
+                                                                         this->getMessagePayloadValue(
                                                                              ServerlessComputeServiceMessagePayload::FUNCTION_INVOKE_REQUEST_MESSAGE_PAYLOAD)));
 
         // Block here for return, if non-blocking then function manager has to check up on it? or send a message
@@ -346,66 +421,108 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (const auto ss_mesg = std::dynamic_pointer_cast<ServiceStopDaemonMessage>(message)) {
-            // TODO: Die...
-            return false;
-        }
-        else if (const auto scsfrr_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceFunctionRegisterRequestMessage>(message)) {
-            processFunctionRegistrationRequest(
-                scsfrr_msg->answer_commport, scsfrr_msg->function, scsfrr_msg->time_limit_in_seconds,
-                scsfrr_msg->disk_space_limit_in_bytes, scsfrr_msg->ram_limit_in_bytes,
-                scsfrr_msg->ingress_in_bytes, scsfrr_msg->egress_in_bytes);
-            return true;
-        }
-        else if (const auto scsfir_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceFunctionInvocationRequestMessage>(message)) {
-            processFunctionInvocationRequest(scsfir_msg->answer_commport, scsfir_msg->registered_function,
-                                             scsfir_msg->function_input, scsfir_msg->notify_commport);
-            return true;
-        }
-        else if (const auto scsdc_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceDownloadCompleteMessage>(message)) {
-            processImageDownloadCompletion(scsdc_msg->_action, scsdc_msg->_image_file);
-            return true;
-        }
-        else if (const auto scsiec_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceInvocationExecutionCompleteMessage>(message)) {
-            processInvocationCompletion(scsiec_msg->_invocation, scsiec_msg->_action);
-            return true;
-        }
-        else if (const auto scsncc_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceNodeCopyCompleteMessage>(message)) {
-            _state_of_the_system->_being_copied_images[scsncc_msg->_compute_host].erase(scsncc_msg->_image_file);
-            if (scsncc_msg->_action->getState() != Action::State::COMPLETED) {
-                WRENCH_INFO("An image copy has failed (due to disk pressure) for image %s... nevermind",
-                            scsncc_msg->_image_file->getID().c_str());
-                do_scheduling = false;
-            }
-            else {
-                WRENCH_INFO("ServerlessComputeService::processNextMessage(): Image file %s was stored at %s",
-                            scsncc_msg->_image_file->getID().c_str(), scsncc_msg->_compute_host.c_str());
-            }
-            // _state_of_the_system->_copied_images[scsncc_msg->_compute_host].insert(scsncc_msg->_image_file);
-            return true;
+        bool handled;
+        bool keep_going = this->message_handlers.dispatch(message, handled, do_scheduling);
+        if (not handled) {
+            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
         }
-        else if (const auto scsnlc_msg = std::dynamic_pointer_cast<
-            ServerlessComputeServiceNodeLoadCompleteMessage>(message)) {
-            _state_of_the_system->_being_loaded_images[scsnlc_msg->_compute_host].erase(scsnlc_msg->_image_file);
-            if (scsnlc_msg->_action->getState() != Action::State::COMPLETED) {
-                WRENCH_INFO("An image load has failed (due to memory pressure) for image %s... nevermind",
-                            scsnlc_msg->_image_file->getID().c_str());
-                do_scheduling = false;
-            }
-            else {
-                WRENCH_INFO("ServerlessComputeService::processNextMessage(): Image file %s was loaded at %s",
-                            scsnlc_msg->_image_file->getID().c_str(), scsnlc_msg->_compute_host.c_str());
-            }
-            return true;
+        return keep_going;
+    }
+
+    /**
+     * @brief Set up the table of message handlers used by processNextMessage()
+     */
+    void ServerlessComputeService::initMessageHandlers() {
+        this->message_handlers.add<ServiceStopDaemonMessage>(
+            [](const std::shared_ptr<ServiceStopDaemonMessage>& msg, bool& do_scheduling) {
+                // TODO: Die...
+                return false;
+            });
+        this->message_handlers.add<ServerlessComputeServiceFunctionRegisterRequestMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceFunctionRegisterRequestMessage>& msg,
+                   bool& do_scheduling) {
+                processFunctionRegistrationRequest(
+                    msg->answer_commport, msg->function, msg->time_limit_in_seconds,
+                    msg->disk_space_limit_in_bytes, msg->ram_limit_in_bytes,
+                    msg->ingress_in_bytes, msg->egress_in_bytes);
+                return true;
+            });
+        this->message_handlers.add<ServerlessComputeServiceFunctionInvocationRequestMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceFunctionInvocationRequestMessage>& msg,
+                   bool& do_scheduling) {
+                processFunctionInvocationRequest(msg->answer_commport, msg->registered_function,
+                                                 msg->function_input, msg->notify_commport,
+                                                 msg->deadline_in_seconds);
+                return true;
+            });
+        this->message_handlers.add<ServerlessComputeServiceDownloadCompleteMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceDownloadCompleteMessage>& msg,
+                   bool& do_scheduling) {
+                processImageDownloadCompletion(msg->_action, msg->_image_file);
+                return true;
+            });
+        this->message_handlers.add<ServerlessComputeServiceInvocationExecutionCompleteMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceInvocationExecutionCompleteMessage>& msg,
+                   bool& do_scheduling) {
+                processInvocationCompletion(msg->_invocation, msg->_action);
+                return true;
+            });
+        this->message_handlers.add<ServerlessComputeServiceNodeCopyCompleteMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceNodeCopyCompleteMessage>& msg,
+                   bool& do_scheduling) {
+                do_scheduling = processImageCopyCompletion(msg->_action, msg->_image_file, msg->_compute_host);
+                return true;
+            });
+        this->message_handlers.add<ServerlessComputeServiceNodeLoadCompleteMessage>(
+            [this](const std::shared_ptr<ServerlessComputeServiceNodeLoadCompleteMessage>& msg,
+                   bool& do_scheduling) {
+                do_scheduling = processImageLoadCompletion(msg->_action, msg->_image_file, msg->_compute_host);
+                return true;
+            });
+    }
+
+    /**
+     * @brief Helper method to process the completion of an image copy to a compute host
+     * @param action the action that was responsible for the copy
+     * @param image_file the image file
+     * @param compute_host the compute host
+     * @return true if scheduling should happen, false otherwise
+     */
+    bool ServerlessComputeService::processImageCopyCompletion(const std::shared_ptr<Action>& action,
+                                                              const std::shared_ptr<DataFile>& image_file,
+                                                              const std::string& compute_host) {
+        _state_of_the_system->_being_copied_images[compute_host].erase(image_file);
+        _state_of_the_system->unpinHeadStorageImage(image_file);
+        if (action->getState() != Action::State::COMPLETED) {
+            WRENCH_INFO("An image copy has failed (due to disk pressure) for image %s... nevermind",
+                        image_file->getID().c_str());
+            return false;
         }
-        else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        WRENCH_INFO("ServerlessComputeService::processNextMessage(): Image file %s was stored at %s",
+                    image_file->getID().c_str(), compute_host.c_str());
+        // _state_of_the_system->_copied_images[compute_host].insert(image_file);
+        return true;
+    }
+
+    /**
+     * @brief Helper method to process the completion of an image load into RAM at a compute host
+     * @param action the action that was responsible for the load
+     * @param image_file the image file
+     * @param compute_host the compute host
+     * @return true if scheduling should happen, false otherwise
+     */
+    bool ServerlessComputeService::processImageLoadCompletion(const std::shared_ptr<Action>& action,
+                                                              const std::shared_ptr<DataFile>& image_file,
+                                                              const std::string& compute_host) {
+        _state_of_the_system->_being_loaded_images[compute_host].erase(image_file);
+        if (action->getState() != Action::State::COMPLETED) {
+            WRENCH_INFO("An image load has failed (due to memory pressure) for image %s... nevermind",
+                        image_file->getID().c_str());
+            return false;
         }
+        WRENCH_INFO("ServerlessComputeService::processNextMessage(): Image file %s was loaded at %s",
+                    image_file->getID().c_str(), compute_host.c_str());
+        return true;
     }
 
     /**
@@ -430,6 +547,9 @@ namespace wrench {
         // Check that function can ever run!
         {
             sg_size_t needed_disk_space = function->getImage()->getFile()->getSize() + disk_space_limit_in_bytes;
+            if (this->use_snapshots) {
+                needed_disk_space += function->getSnapshotSize();
+            }
             sg_size_t needed_ram_space = function->getImage()->getFile()->getSize() + ram_limit_in_bytes;
 
             if (needed_disk_space > this->disk_space_of_compute_host) {
@@ -452,6 +572,14 @@ namespace wrench {
 
         _state_of_the_system->_registered_functions.insert(registered_function);
 
+        // Create the function's snapshot file, if needed
+        if (this->use_snapshots and (function->getSnapshotSize() > 0) and
+            (_state_of_the_system->_snapshot_files.find(function) == _state_of_the_system->_snapshot_files.end())) {
+            _state_of_the_system->_snapshot_files[function] = Simulation::addFile(
+                "snapshot_" + std::to_string(++ServerlessComputeService::sequence_number) + "_" + function->getName(),
+                function->getSnapshotSize());
+        }
+
         const auto answerMessage = new ServerlessComputeServiceFunctionRegisterAnswerMessage(
             true, registered_function, nullptr, this->getMessagePayloadValue(
                 ServerlessComputeServiceMessagePayload::FUNCTION_REGISTER_ANSWER_MESSAGE_PAYLOAD));
@@ -465,12 +593,14 @@ namespace wrench {
      * @param registered_function the (registered) function to invoke
      * @param input the input to the function
      * @param notify_commport the ExecutionController commport to notify
+     * @param deadline_in_seconds the invocation's deadline, relative to the invocation date (-1.0 if none)
      */
     void ServerlessComputeService::processFunctionInvocationRequest(S4U_CommPort* answer_commport,
                                                                     const std::shared_ptr<RegisteredFunction>
                                                                     & registered_function,
                                                                     const std::shared_ptr<FunctionInput>& input,
-                                                                    S4U_CommPort* notify_commport) {
+                                                                    S4U_CommPort* notify_commport,
+                                                                    double deadline_in_seconds) {
 
         if (_state_of_the_system->_registered_functions.find(registered_function) ==
             _state_of_the_system->_registered_functions.end()) {
@@ -483,7 +613,11 @@ namespace wrench {
         else {
             auto invocation = std::make_shared<Invocation>(registered_function, input, notify_commport);
             invocation->_submit_date = Simulation::getCurrentSimulatedDate();
+            if (deadline_in_seconds >= 0.0) {
+                invocation->_deadline = invocation->_submit_date + deadline_in_seconds;
+            }
             _state_of_the_system->_new_invocations.push(invocation);
+            _state_of_the_system->_num_outstanding_invocations++;
             auto answerMessage = new ServerlessComputeServiceFunctionInvocationAnswerMessage(
                 true, invocation, nullptr, 0);
             answer_commport->dputMessage(answerMessage);
@@ -505,13 +639,13 @@ namespace wrench {
         WRENCH_INFO("ServerlessComputeService::processImageDownloadCompletion(): Image file %s was downloaded",
                     image_file->getID().c_str());
         _state_of_the_system->_being_downloaded_image_files.erase(image_file);
+        _state_of_the_system->touchHeadStorageImage(image_file);
         // _state_of_the_system->_downloaded_image_files.insert(image_file);
 
         // Move all relevant invocations from the admitted to the schedulable queue
         auto& queue = _state_of_the_system->_admitted_invocations[image_file];
         while (not queue.empty()) {
-            _state_of_the_system->_schedulable_invocations.emplace(
-                _state_of_the_system->_schedulable_invocations.end(), std::move(queue.front()));
+            _state_of_the_system->addSchedulableInvocation(queue.front(), false);
             queue.pop();
         }
         _state_of_the_system->_admitted_invocations.erase(image_file);
@@ -535,7 +669,28 @@ namespace wrench {
         invocation->_opened_image_ram_file->close();
         invocation->_opened_tmp_ram_file->close();
         StorageService::removeFileAtLocation(invocation->_tmp_ram_file_location);
+        if (invocation->_opened_snapshot_file) {
+            invocation->_opened_snapshot_file->close();
+            invocation->_opened_snapshot_file = nullptr;
+        }
+        if (invocation->_writes_snapshot) {
+            _state_of_the_system->_being_written_snapshots[host].erase(invocation->_snapshot_location->getFile());
+        }
         _state_of_the_system->_available_cores[host]++;
+        _state_of_the_system->_num_outstanding_invocations--;
+
+        // Learn from the invocation's runtime, and keep track of SLO violations
+        _state_of_the_system->updateEstimatedRuntime(invocation->_registered_function,
+                                                     invocation->_end_date - invocation->_start_date);
+        if (invocation->hasDeadline()) {
+            _state_of_the_system->_num_completed_invocations_with_deadline++;
+            if (invocation->hasMissedDeadline()) {
+                WRENCH_INFO("A function invocation for function %s has missed its deadline by %.2lf seconds",
+                            invocation->getRegisteredFunction()->getFunction()->getName().c_str(),
+                            invocation->_end_date - invocation->_deadline);
+                _state_of_the_system->_num_slo_violations++;
+            }
+        }
 
         bool success = action->getState() == Action::State::COMPLETED;
 
@@ -554,30 +709,25 @@ namespace wrench {
      * @return true if at least one invocation was dispatched
      */
     void ServerlessComputeService::dispatchInvocations(const std::shared_ptr<SchedulingDecisions>& decisions) {
-        // Dispatched the invocations in the order of the schedulable list
-        std::set<std::shared_ptr<Invocation>> dispatched_invocations;
+        // Dispatched invocations are removed from the schedulable queue as we go (each
+        // invocation knows its position in the queue, so this is constant time)
         for (const auto& [hostname, invocations_to_place] : decisions->invocations_to_start_at_compute_node) {
             for (const auto& invocation : invocations_to_place) {
                 // WRENCH_INFO("Trying to dispatch scheduled invocation for function [%s]...",
                 //             invocation_to_place->_registered_function->_function->getName().c_str());
 
+                // A (buggy) scheduler may have placed the same invocation twice
+                if (not invocation->_is_schedulable) {
+                    continue;
+                }
+
                 if (dispatchInvocation(invocation, hostname)) {
                     _state_of_the_system->_running_invocations.push(invocation);
                     invocation->_target_host = hostname;
-                    dispatched_invocations.insert(invocation);
+                    _state_of_the_system->removeSchedulableInvocation(invocation);
                 }
             }
         }
-
-        // Update the list of schedulable invocations (not super efficient, but clearer than the erase-as-I-go)
-        std::vector<std::shared_ptr<Invocation>> updated_list_of_schedulable_invocations;
-        for (auto const& invocation : _state_of_the_system->_schedulable_invocations) {
-            if (dispatched_invocations.find(invocation) == dispatched_invocations.end()) {
-                updated_list_of_schedulable_invocations.push_back(invocation);
-                dispatched_invocations.erase(invocation); // Should be more efficient
-            }
-        }
-        _state_of_the_system->_schedulable_invocations = updated_list_of_schedulable_invocations;
     }
 
     /**
@@ -640,9 +790,7 @@ namespace wrench {
 
 
         // Create and open a tmp memory file in RAM and open it, if possible
-        auto tmp_memory_file = Simulation::addFile(
-            "tmp_ram_file_" + std::to_string(++ServerlessComputeService::sequence_number),
-            invocation->getRegisteredFunction()->getRAMLimit());
+        auto tmp_memory_file = Simulation::addScratchFile(invocation->getRegisteredFunction()->getRAMLimit());
         auto compute_ram_ss = _state_of_the_system->_compute_memories[target_host];
         try {
             auto file_location = FileLocation::LOCATION(compute_ram_ss, tmp_memory_file);
@@ -662,6 +810,9 @@ namespace wrench {
             FileLocation::LOCATION(compute_ram_ss,
                                    invocation->getRegisteredFunction()->getOriginalImageLocation()->getFile()));
 
+        // Determine how the invocation's container will be started
+        double startup_overhead = prepareColdStart(invocation, target_host);
+
 
         const std::function lambda_terminate = [](const std::shared_ptr<ActionExecutor>& action_executor) {
         };
@@ -670,6 +821,18 @@ namespace wrench {
             const std::shared_ptr<ActionExecutor>& action_executor) {
             const auto function = invocation->_registered_function->_function;
 
+            // Restore the function's snapshot, or take it once the container has started
+            if (invocation->_snapshot_bytes_to_restore > 0) {
+                StorageService::readFileAtLocation(invocation->_snapshot_location,
+                                                   invocation->_snapshot_bytes_to_restore);
+            } else if (invocation->_writes_snapshot) {
+                try {
+                    StorageService::writeFileAtLocation(invocation->_snapshot_location);
+                } catch (ExecutionException& e) {
+                    // Not enough disk space at the node, later invocations will pay the startup overhead
+                }
+            }
+
             // Invoke the user's lambda function
             invocation->_function_output = function->_lambda(invocation->_function_input,
                                                              invocation->_tmp_storage_service);
@@ -697,7 +860,7 @@ namespace wrench {
             target_host,
             1,
             0,
-            this->getPropertyValueAsDouble(ServerlessComputeServiceProperty::CONTAINER_STARTUP_OVERHEAD),
+            startup_overhead,
             false,
             this->commport,
             custom_message,
@@ -717,6 +880,56 @@ namespace wrench {
         return true;
     }
 
+    /**
+     * @brief Helper method to determine how an invocation's container is started. With the "container"
+     *        cold start model, or for functions without a snapshot, the container startup overhead is paid.
+     *        With the "snapshot" cold start model, if the function's snapshot is on disk at the target host,
+     *        then it is restored (i.e., read from disk, entirely or only its working set if restores are lazy)
+     *        instead. Otherwise, the container startup overhead is paid and the invocation writes the snapshot
+     *        to disk so that later invocations at that host can restore it.
+     *
+     * @param invocation the invocation
+     * @param target_host the target host
+     * @return the container startup overhead, in seconds
+     */
+    double ServerlessComputeService::prepareColdStart(const std::shared_ptr<Invocation>& invocation,
+                                                      const std::string& target_host) {
+        double container_startup_overhead =
+            this->getPropertyValueAsDouble(ServerlessComputeServiceProperty::CONTAINER_STARTUP_OVERHEAD);
+
+        const auto function = invocation->_registered_function->_function;
+        const auto snapshot = _state_of_the_system->getSnapshotFile(function);
+        if (snapshot == nullptr) {
+            return container_startup_overhead;
+        }
+
+        const auto compute_ss = _state_of_the_system->_compute_storages[target_host];
+        invocation->_snapshot_location = FileLocation::LOCATION(compute_ss, snapshot);
+
+        if (_state_of_the_system->isSnapshotOnNode(target_host, function)) {
+            // Open the snapshot file so that it cannot be evicted while being restored
+            invocation->_opened_snapshot_file = compute_ss->openFile(invocation->_snapshot_location);
+            invocation->_snapshot_bytes_to_restore = snapshot->getSize();
+            if (this->getPropertyValueAsBoolean(ServerlessComputeServiceProperty::SNAPSHOT_LAZY_RESTORE)) {
+                invocation->_snapshot_bytes_to_restore = (sg_size_t)(
+                    (double)snapshot->getSize() *
+                    this->getPropertyValueAsDouble(ServerlessComputeServiceProperty::SNAPSHOT_WORKING_SET_FRACTION));
+            }
+            _state_of_the_system->_num_snapshot_restores++;
+            WRENCH_INFO("Restoring the snapshot of function %s at host %s (%llu bytes)",
+                        function->getName().c_str(), target_host.c_str(), invocation->_snapshot_bytes_to_restore);
+            return 0.0;
+        }
+
+        // Only one invocation at a time writes the snapshot at a host
+        if (_state_of_the_system->_being_written_snapshots[target_host].find(snapshot) ==
+            _state_of_the_system->_being_written_snapshots[target_host].end()) {
+            _state_of_the_system->_being_written_snapshots[target_host].insert(snapshot);
+            invocation->_writes_snapshot = true;
+        }
+        return container_startup_overhead;
+    }
+
     /**
      * @brief Start a SimpleStorageService for each compute host. We don't start a bare-metal
      *        service as we'll do everything ourselves with action executor services.
@@ -781,9 +994,7 @@ namespace wrench {
         std::shared_ptr<simgrid::fsmod::File> opened_tmp_file;
         try {
             tmp_file = wrench::FileLocation::LOCATION(_state_of_the_system->_compute_storages[target_host],
-                                                                 Simulation::addFile(
-                                                                     "tmp_" + std::to_string(++ServerlessComputeService::sequence_number),
-                                                                     invocation->_registered_function->_disk_space));
+                                                                 Simulation::addScratchFile(invocation->_registered_function->_disk_space));
             StorageService::createFileAtLocation(tmp_file);
             opened_tmp_file = _state_of_the_system->_compute_storages[target_host]->openFile(tmp_file);
         } catch (ExecutionException &e) {
@@ -791,6 +1002,7 @@ namespace wrench {
         }
 
         // Create a tmp file system
+        ++ServerlessComputeService::sequence_number;
         const auto disk = S4U_Simulation::hostHasMountPoint(target_host, "/");
         const auto ods = simgrid::fsmod::OneDiskStorage::create("is_" + std::to_string(ServerlessComputeService::sequence_number), disk);
         const auto fs = simgrid::fsmod::FileSystem::create("fs" + std::to_string(ServerlessComputeService::sequence_number));
@@ -853,8 +1065,8 @@ namespace wrench {
             // If the image file is already downloaded, make the invocation schedulable immediately
             if (_state_of_the_system->_head_storage_service->hasFile(image->getFile())) {
                 _state_of_the_system->_new_invocations.pop();
-                _state_of_the_system->_schedulable_invocations.emplace(
-                    _state_of_the_system->_schedulable_invocations.begin(), invocation);
+                _state_of_the_system->touchHeadStorageImage(image->getFile());
+                _state_of_the_system->addSchedulableInvocation(invocation, true);
                 continue;
             }
 
@@ -866,8 +1078,11 @@ namespace wrench {
                 continue;
             }
 
-            // Otherwise, if there is enough space on the head node storage service to store it,
-            // then launch the downloaded and admit the invocation
+            // Otherwise, if there is enough space on the head node storage service to store it
+            // (possibly after evicting unused images), then launch the downloaded and admit the invocation
+            if (_state_of_the_system->_free_space_on_head_storage < image->getFile()->getSize()) {
+                evictHeadStorageImages(image->getFile()->getSize() - _state_of_the_system->_free_space_on_head_storage);
+            }
             if (_state_of_the_system->_free_space_on_head_storage >= image->getFile()->getSize()) {
                 // "Reserve" space on the storage service
                 _state_of_the_system->_free_space_on_head_storage -= image->getFile()->getSize();
@@ -885,6 +1100,28 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Helper method to evict images from the head node storage, in LRU order. Images that are
+     *        needed by schedulable invocations or by in-flight copies to compute nodes are never evicted.
+     *        Nothing is evicted if not enough space can be freed.
+     *
+     * @param space_needed the number of bytes that must be freed
+     * @return true if enough space was freed, false otherwise
+     */
+    bool ServerlessComputeService::evictHeadStorageImages(sg_size_t space_needed) {
+        auto victims = _state_of_the_system->pickHeadStorageImagesToEvict(space_needed);
+        if (victims.empty()) {
+            return false;
+        }
+        for (const auto& image : victims) {
+            WRENCH_INFO("Evicting image %s from the head node storage", image->getID().c_str());
+            StorageService::removeFileAtLocation(FileLocation::LOCATION(_state_of_the_system->_head_storage_service,
+                                                                        image));
+            _state_of_the_system->forgetHeadStorageImage(image);
+        }
+        return true;
+    }
+
     /**
      * @brief Helper method to initiate an image download
      *
@@ -980,6 +1217,9 @@ namespace wrench {
                                                                   const std::shared_ptr<DataFile>& image) {
         // Add the image to the being_copied_images data structure for this host
         _state_of_the_system->_being_copied_images[compute_host].insert(image);
+        // The image cannot be evicted from the head node while it's being copied
+        _state_of_the_system->touchHeadStorageImage(image);
+        _state_of_the_system->pinHeadStorageImage(image);
 
         // std::cerr << "INITIATING IMAGE COPY FOR " << image->getID() << std::endl;
         // Initiate an asynchronous action that copies the image (identified by imageID)
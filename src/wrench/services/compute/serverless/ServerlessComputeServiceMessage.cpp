@@ -46,6 +46,7 @@ namespace wrench
         const sg_size_t payload)
         : ServerlessComputeServiceMessage(payload)
     {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceFunctionRegisterRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (function == nullptr))
         {
@@ -75,7 +76,9 @@ namespace wrench
         std::shared_ptr<RegisteredFunction> registered_function,
         std::shared_ptr<FailureCause> failure_cause,
         sg_size_t payload)
-        : ServerlessComputeServiceMessage(payload), success(success), registered_function(std::move(registered_function)), failure_cause(std::move(failure_cause)) {}
+        : ServerlessComputeServiceMessage(payload), success(success), registered_function(std::move(registered_function)), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceFunctionRegisterAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -84,6 +87,7 @@ namespace wrench
      * @param registered_function: the (registered) function to invoke
      * @param function_input: input arguments passed to the function
      * @param notify_commport: commport to notify
+     * @param deadline_in_seconds: the invocation's deadline, relative to the invocation date (-1.0 if none)
      * @param payload: message size in bytes
      */
     ServerlessComputeServiceFunctionInvocationRequestMessage::ServerlessComputeServiceFunctionInvocationRequestMessage(
@@ -91,9 +95,11 @@ namespace wrench
         const std::shared_ptr<RegisteredFunction>& registered_function,
         const std::shared_ptr<FunctionInput>& function_input,
         S4U_CommPort *notify_commport,
+        double deadline_in_seconds,
         sg_size_t payload)
         : ServerlessComputeServiceMessage(payload)
     {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceFunctionInvocationRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (function == nullptr))
         {
@@ -105,6 +111,7 @@ namespace wrench
         this->registered_function = registered_function;
         this->function_input = function_input;
         this->notify_commport = notify_commport;
+        this->deadline_in_seconds = deadline_in_seconds;
     }
 
     /**
@@ -120,7 +127,9 @@ namespace wrench
         std::shared_ptr<Invocation> invocation,
         std::shared_ptr<FailureCause> failure_cause,
         sg_size_t payload)
-        : ServerlessComputeServiceMessage(payload), success(success), invocation(std::move(invocation)), failure_cause(std::move(failure_cause)) {}
+        : ServerlessComputeServiceMessage(payload), success(success), invocation(std::move(invocation)), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceFunctionInvocationAnswerMessage>();
+    }
 
     /**
      * @brief Constructor
@@ -135,18 +144,28 @@ namespace wrench
         std::shared_ptr<Invocation> invocation,
         std::shared_ptr<FailureCause> failure_cause,
         sg_size_t payload)
-        : ServerlessComputeServiceMessage(payload), success(success), invocation(std::move(invocation)), failure_cause(std::move(failure_cause)) {}
+        : ServerlessComputeServiceMessage(payload), success(success), invocation(std::move(invocation)), failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceFunctionInvocationCompleteMessage>();
+    }
 
     ServerlessComputeServiceDownloadCompleteMessage::ServerlessComputeServiceDownloadCompleteMessage(
-        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)) {}
+        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceDownloadCompleteMessage>();
+    }
 
     ServerlessComputeServiceInvocationExecutionCompleteMessage::ServerlessComputeServiceInvocationExecutionCompleteMessage(
-        std::shared_ptr<CustomAction> action, std::shared_ptr<Invocation> invocation, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _invocation(std::move(invocation)) {}
+        std::shared_ptr<CustomAction> action, std::shared_ptr<Invocation> invocation, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _invocation(std::move(invocation)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceInvocationExecutionCompleteMessage>();
+    }
 
     ServerlessComputeServiceNodeCopyCompleteMessage::ServerlessComputeServiceNodeCopyCompleteMessage(
-        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, std::string compute_host, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)), _compute_host(std::move(compute_host)) {}
+        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, std::string compute_host, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)), _compute_host(std::move(compute_host)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceNodeCopyCompleteMessage>();
+    }
 
     ServerlessComputeServiceNodeLoadCompleteMessage::ServerlessComputeServiceNodeLoadCompleteMessage(
-        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, std::string compute_host, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)), _compute_host(std::move(compute_host)) {}
+        std::shared_ptr<CustomAction> action, std::shared_ptr<DataFile> image_file, std::string compute_host, sg_size_t payload) : ServerlessComputeServiceMessage(payload), _action(std::move(action)), _image_file(std::move(image_file)), _compute_host(std::move(compute_host)) {
+        this->kind = SimulationMessage::getKindOf<ServerlessComputeServiceNodeLoadCompleteMessage>();
+    }
 
 } // namespace wrench
@@ -12,5 +12,8 @@
 namespace wrench {
 
     SET_PROPERTY_NAME(ServerlessComputeServiceProperty, CONTAINER_STARTUP_OVERHEAD);
+    SET_PROPERTY_NAME(ServerlessComputeServiceProperty, COLD_START_MODEL);
+    SET_PROPERTY_NAME(ServerlessComputeServiceProperty, SNAPSHOT_LAZY_RESTORE);
+    SET_PROPERTY_NAME(ServerlessComputeServiceProperty, SNAPSHOT_WORKING_SET_FRACTION);
 
 }// namespace wrench
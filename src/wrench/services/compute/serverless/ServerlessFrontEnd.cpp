@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench/services/compute/serverless/ServerlessFrontEnd.h>
+#include <wrench/services/compute/serverless/ServerlessComputeService.h>
+#include <wrench/logging/TerminalOutput.h>
+
+#include <functional>
+
+WRENCH_LOG_CATEGORY(wrench_core_serverless_front_end, "Log category for Serverless Front End");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param shards the serverless compute services to which invocations are dispatched
+     * @param policy the sharding policy
+     * @param spillover_load_threshold the load (number of outstanding invocations per core) above which
+     *        an invocation is spilled over from the shard picked by the policy to a less loaded shard
+     * @param seed the seed of the random number generator used by the POWER_OF_TWO_CHOICES policy
+     */
+    ServerlessFrontEnd::ServerlessFrontEnd(const std::vector<std::shared_ptr<ServerlessComputeService>>& shards,
+                                           ShardingPolicy policy,
+                                           double spillover_load_threshold,
+                                           unsigned long seed) : _shards(shards),
+                                                                 _policy(policy),
+                                                                 _spillover_load_threshold(spillover_load_threshold),
+                                                                 _rng(seed) {
+        if (_shards.empty()) {
+            throw std::invalid_argument("ServerlessFrontEnd::ServerlessFrontEnd(): at least one shard must be provided");
+        }
+        for (const auto& shard : _shards) {
+            if (shard == nullptr) {
+                throw std::invalid_argument("ServerlessFrontEnd::ServerlessFrontEnd(): invalid nullptr shard");
+            }
+        }
+        if (_spillover_load_threshold <= 0) {
+            throw std::invalid_argument("ServerlessFrontEnd::ServerlessFrontEnd(): the spillover load threshold must be > 0");
+        }
+
+        // Build the consistent hashing ring
+        for (unsigned long i = 0; i < _shards.size(); i++) {
+            for (unsigned long v = 0; v < NUM_VIRTUAL_NODES_PER_SHARD; v++) {
+                _ring[std::hash<std::string>{}(_shards[i]->getName() + "#" + std::to_string(v))] = i;
+            }
+        }
+        _num_invocations_per_shard.resize(_shards.size(), 0);
+    }
+
+    /**
+     * @brief Get the front-end's shards
+     * @return A list of serverless compute services
+     */
+    const std::vector<std::shared_ptr<ServerlessComputeService>>& ServerlessFrontEnd::getShards() const {
+        return _shards;
+    }
+
+    /**
+     * @brief Get the front-end's sharding policy
+     * @return A sharding policy
+     */
+    ServerlessFrontEnd::ShardingPolicy ServerlessFrontEnd::getShardingPolicy() const {
+        return _policy;
+    }
+
+    /**
+     * @brief Get the number of invocations that were not sent to the shard picked by
+     *        the sharding policy because that shard was overloaded
+     * @return A number of invocations
+     */
+    unsigned long ServerlessFrontEnd::getNumSpillovers() const {
+        return _num_spillovers;
+    }
+
+    /**
+     * @brief Get the number of invocations that the front-end has sent to each shard
+     * @return A map of numbers of invocations, indexed by shard
+     */
+    std::map<std::shared_ptr<ServerlessComputeService>, unsigned long> ServerlessFrontEnd::getNumInvocationsPerShard() const {
+        std::map<std::shared_ptr<ServerlessComputeService>, unsigned long> to_return;
+        for (unsigned long i = 0; i < _shards.size(); i++) {
+            to_return[_shards[i]] = _num_invocations_per_shard[i];
+        }
+        return to_return;
+    }
+
+    /**
+     * @brief Get the shard that a function maps to on the consistent hashing ring
+     * @param function a function
+     * @return A serverless compute service
+     */
+    std::shared_ptr<ServerlessComputeService> ServerlessFrontEnd::getHomeShard(const std::shared_ptr<Function>& function) const {
+        return _shards[getHomeShardIndex(function)];
+    }
+
+    /**
+     * @brief Register a function with all the shards, so that its invocations can be sent to any of them
+     *
+     * @param function the function to register
+     * @param time_limit_in_seconds the time limit for execution
+     * @param disk_space_limit_in_bytes the disk space limit for the function
+     * @param RAM_limit_in_bytes the RAM limit for the function
+     * @param ingress_in_bytes the ingress data limit
+     * @param egress_in_bytes the egress data limit
+     * @return The RegisteredFunction object created by the function's home shard
+     * @throw ExecutionException if the function registration fails
+     */
+    std::shared_ptr<RegisteredFunction> ServerlessFrontEnd::registerFunction(const std::shared_ptr<Function>& function,
+                                                                             double time_limit_in_seconds,
+                                                                             sg_size_t disk_space_limit_in_bytes,
+                                                                             sg_size_t RAM_limit_in_bytes,
+                                                                             sg_size_t ingress_in_bytes,
+                                                                             sg_size_t egress_in_bytes) {
+        std::vector<std::shared_ptr<RegisteredFunction>> registered_functions;
+        for (const auto& shard : _shards) {
+            registered_functions.push_back(shard->registerFunction(function, time_limit_in_seconds,
+                                                                   disk_space_limit_in_bytes, RAM_limit_in_bytes,
+                                                                   ingress_in_bytes, egress_in_bytes));
+        }
+        auto home_registered_function = registered_functions.at(getHomeShardIndex(function));
+        _registrations[function] = std::move(registered_functions);
+        return home_registered_function;
+    }
+
+    /**
+     * @brief Invoke a function on the shard picked by the sharding policy
+     *
+     * @param registered_function a function registered via this front-end
+     * @param input the input to the function
+     * @param notify_commport the commport to notify upon completion
+     * @param deadline_in_seconds the invocation's deadline, relative to the invocation date (-1.0 if none)
+     * @return The Invocation object created by the selected shard
+     */
+    std::shared_ptr<Invocation> ServerlessFrontEnd::invokeFunction(const std::shared_ptr<RegisteredFunction>& registered_function,
+                                                                   const std::shared_ptr<FunctionInput>& input,
+                                                                   S4U_CommPort* notify_commport,
+                                                                   double deadline_in_seconds) {
+        auto function = registered_function->getFunction();
+        auto it = _registrations.find(function);
+        if (it == _registrations.end()) {
+            throw std::invalid_argument("ServerlessFrontEnd::invokeFunction(): function " + function->getName() +
+                                        " was not registered via this front-end");
+        }
+
+        auto shard_index = pickShardIndex(function);
+        _num_invocations_per_shard[shard_index]++;
+        WRENCH_DEBUG("Sending an invocation of function %s to shard %s",
+                     function->getName().c_str(), _shards[shard_index]->getName().c_str());
+        return _shards[shard_index]->invokeFunction(it->second[shard_index], input, notify_commport, deadline_in_seconds);
+    }
+
+    /**
+     * @brief Helper method to find a function's home shard on the consistent hashing ring
+     * @param function a function
+     * @return A shard index
+     */
+    unsigned long ServerlessFrontEnd::getHomeShardIndex(const std::shared_ptr<Function>& function) const {
+        auto it = _ring.lower_bound(std::hash<std::string>{}(function->getName()));
+        if (it == _ring.end()) {
+            it = _ring.begin();
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Helper method to pick the shard for an invocation, according to the sharding policy
+     * @param function the function being invoked
+     * @return A shard index
+     */
+    unsigned long ServerlessFrontEnd::pickShardIndex(const std::shared_ptr<Function>& function) {
+        unsigned long picked = 0;
+        switch (_policy) {
+            case CONSISTENT_HASHING: {
+                picked = getHomeShardIndex(function);
+                break;
+            }
+            case LEAST_LOADED: {
+                for (unsigned long i = 1; i < _shards.size(); i++) {
+                    if (getShardLoad(i) < getShardLoad(picked)) {
+                        picked = i;
+                    }
+                }
+                // Nowhere better to go
+                return picked;
+            }
+            case POWER_OF_TWO_CHOICES: {
+                std::uniform_int_distribution<unsigned long> dist(0, _shards.size() - 1);
+                auto first = dist(_rng);
+                auto second = dist(_rng);
+                picked = (getShardLoad(second) < getShardLoad(first)) ? second : first;
+                break;
+            }
+        }
+
+        if (getShardLoad(picked) >= _spillover_load_threshold) {
+            return spillOver(picked, function);
+        }
+        return picked;
+    }
+
+    /**
+     * @brief Helper method to pick a replacement for an overloaded shard. For consistent hashing, the
+     *        next shard on the ring that is below the threshold is picked (so that a function's spilled-over
+     *        invocations keep hitting the same few shards). For other policies, the least loaded shard is picked.
+     *        If no shard is below the threshold, the overloaded shard is kept.
+     * @param shard_index the index of the overloaded shard
+     * @param function the function being invoked
+     * @return A shard index
+     */
+    unsigned long ServerlessFrontEnd::spillOver(unsigned long shard_index, const std::shared_ptr<Function>& function) {
+        unsigned long replacement = shard_index;
+
+        if (_policy == CONSISTENT_HASHING) {
+            auto it = _ring.lower_bound(std::hash<std::string>{}(function->getName()));
+            for (unsigned long i = 0; i < _ring.size(); i++, it++) {
+                if (it == _ring.end()) {
+                    it = _ring.begin();
+                }
+                if ((it->second != shard_index) and (getShardLoad(it->second) < _spillover_load_threshold)) {
+                    replacement = it->second;
+                    break;
+                }
+            }
+        } else {
+            for (unsigned long i = 0; i < _shards.size(); i++) {
+                if (getShardLoad(i) < getShardLoad(replacement)) {
+                    replacement = i;
+                }
+            }
+            if (getShardLoad(replacement) >= _spillover_load_threshold) {
+                replacement = shard_index;
+            }
+        }
+
+        if (replacement != shard_index) {
+            WRENCH_DEBUG("Shard %s is overloaded: spilling an invocation of function %s over to shard %s",
+                         _shards[shard_index]->getName().c_str(), function->getName().c_str(),
+                         _shards[replacement]->getName().c_str());
+            _num_spillovers++;
+        }
+        return replacement;
+    }
+
+    /**
+     * @brief Helper method to get the current load of a shard
+     * @param shard_index a shard index
+     * @return The shard's number of outstanding invocations per core
+     */
+    double ServerlessFrontEnd::getShardLoad(unsigned long shard_index) const {
+        return _shards[shard_index]->getLoadZeroTime();
+    }
+
+} // namespace wrench
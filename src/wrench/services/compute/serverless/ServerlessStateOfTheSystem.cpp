@@ -24,10 +24,17 @@ namespace wrench {
      */
     ServerlessStateOfTheSystem::ServerlessStateOfTheSystem(const std::vector<std::string>& compute_hosts)
         : _compute_hosts(compute_hosts),
+          _num_outstanding_invocations(0),
+          _total_num_cores(0),
+          _num_completed_invocations_with_deadline(0),
+          _num_slo_violations(0),
           _head_storage_service(nullptr),
-          _free_space_on_head_storage(0) {
+          _free_space_on_head_storage(0),
+          _num_head_storage_image_evictions(0),
+          _num_snapshot_restores(0) {
         for (const auto& compute_host : _compute_hosts) {
             _available_cores[compute_host] = S4U_Simulation::getHostNumCores(compute_host);
+            _total_num_cores += _available_cores[compute_host];
             _available_ram[compute_host] = S4U_Simulation::getHostMemoryCapacity(compute_host);
         }
 
@@ -52,6 +59,245 @@ namespace wrench {
         return _available_cores;
     }
 
+    /**
+     * @brief Get the number of invocations that have been accepted by the service
+     *        but have not completed yet (i.e., new, admitted, schedulable, or running)
+     * @return A number of invocations
+     */
+    unsigned long ServerlessStateOfTheSystem::getNumOutstandingInvocations() const {
+        return _num_outstanding_invocations;
+    }
+
+    /**
+     * @brief Get the total number of cores over all compute hosts
+     * @return A number of cores
+     */
+    unsigned long ServerlessStateOfTheSystem::getTotalNumCores() const {
+        return _total_num_cores;
+    }
+
+    /**
+     * @brief Get the estimated runtime of a registered function, i.e., an exponential moving average
+     *        of the durations of its completed invocations (including the container startup overhead),
+     *        or the function's time limit if no invocation has completed yet
+     * @param registered_function a registered function
+     * @return A duration in seconds
+     */
+    double ServerlessStateOfTheSystem::getEstimatedRuntime(const std::shared_ptr<RegisteredFunction>& registered_function) const {
+        auto it = _estimated_runtimes.find(registered_function);
+        if (it == _estimated_runtimes.end()) {
+            return registered_function->getTimeLimit();
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Update the estimated runtime of a registered function based on an observed runtime
+     * @param registered_function a registered function
+     * @param runtime the observed runtime of one of its invocations
+     */
+    void ServerlessStateOfTheSystem::updateEstimatedRuntime(const std::shared_ptr<RegisteredFunction>& registered_function,
+                                                            double runtime) {
+        auto it = _estimated_runtimes.find(registered_function);
+        if (it == _estimated_runtimes.end()) {
+            _estimated_runtimes[registered_function] = runtime;
+        } else {
+            it->second = RUNTIME_ESTIMATE_SMOOTHING_FACTOR * runtime +
+                         (1.0 - RUNTIME_ESTIMATE_SMOOTHING_FACTOR) * it->second;
+        }
+    }
+
+    /**
+     * @brief Add an invocation to the queue of schedulable invocations
+     * @param invocation the invocation
+     * @param at_front true if the invocation should be added at the front of the queue, false if at the back
+     */
+    void ServerlessStateOfTheSystem::addSchedulableInvocation(const std::shared_ptr<Invocation>& invocation,
+                                                              bool at_front) {
+        if (invocation->_is_schedulable) {
+            throw std::runtime_error("ServerlessStateOfTheSystem::addSchedulableInvocation(): "
+                                     "invocation is already in the schedulable queue");
+        }
+        invocation->_schedulable_queue_position = _schedulable_invocations.insert(
+            at_front ? _schedulable_invocations.begin() : _schedulable_invocations.end(), invocation);
+        invocation->_is_schedulable = true;
+        // The image on the head node will be needed to copy it to some compute node
+        pinHeadStorageImage(invocation->getRegisteredFunction()->getImageFile());
+    }
+
+    /**
+     * @brief Remove an invocation from the queue of schedulable invocations (constant time)
+     * @param invocation the invocation
+     */
+    void ServerlessStateOfTheSystem::removeSchedulableInvocation(const std::shared_ptr<Invocation>& invocation) {
+        if (not invocation->_is_schedulable) {
+            return;
+        }
+        _schedulable_invocations.erase(invocation->_schedulable_queue_position);
+        invocation->_is_schedulable = false;
+        unpinHeadStorageImage(invocation->getRegisteredFunction()->getImageFile());
+    }
+
+    /**
+     * @brief Get the snapshot file of a function
+     * @param function a function
+     * @return A file, or nullptr if the function does not have a snapshot (or if the
+     *         service does not use the "snapshot" cold start model)
+     */
+    std::shared_ptr<DataFile> ServerlessStateOfTheSystem::getSnapshotFile(const std::shared_ptr<Function>& function) const {
+        auto it = _snapshot_files.find(function);
+        if (it == _snapshot_files.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Determine whether a function's snapshot is on disk at a node, and can thus be restored
+     * @param node the compute node
+     * @param function a function
+     *
+     * @return true or false
+     */
+    bool ServerlessStateOfTheSystem::isSnapshotOnNode(const std::string& node, const std::shared_ptr<Function>& function) {
+        auto snapshot = getSnapshotFile(function);
+        if (snapshot == nullptr) {
+            return false;
+        }
+        if (_being_written_snapshots[node].find(snapshot) != _being_written_snapshots[node].end()) {
+            return false;
+        }
+        return _compute_storages[node]->hasFile(snapshot);
+    }
+
+    /**
+     * @brief Get the number of invocations that were started by restoring a snapshot
+     * @return A number of invocations
+     */
+    unsigned long ServerlessStateOfTheSystem::getNumSnapshotRestores() const {
+        return _num_snapshot_restores;
+    }
+
+    /**
+     * @brief Get the free space on the head node storage, as accounted for by the service
+     *        (i.e., counting space reserved for images being downloaded as used)
+     * @return A number of bytes
+     */
+    sg_size_t ServerlessStateOfTheSystem::getFreeSpaceOnHeadStorage() const {
+        return _free_space_on_head_storage;
+    }
+
+    /**
+     * @brief Determine whether an image on the head node is pinned, i.e., cannot be evicted
+     *        because schedulable invocations or in-flight copies to compute nodes need it
+     * @param image an image file
+     * @return true or false
+     */
+    bool ServerlessStateOfTheSystem::isImageOnHeadStoragePinned(const std::shared_ptr<DataFile>& image) const {
+        return _head_storage_pin_counts.find(image) != _head_storage_pin_counts.end();
+    }
+
+    /**
+     * @brief Get the number of images that have been evicted from the head node storage
+     * @return A number of images
+     */
+    unsigned long ServerlessStateOfTheSystem::getNumHeadStorageImageEvictions() const {
+        return _num_head_storage_image_evictions;
+    }
+
+    /**
+     * @brief Mark an image on the head node as most recently used (adding it to the LRU list if need be)
+     * @param image an image file
+     */
+    void ServerlessStateOfTheSystem::touchHeadStorageImage(const std::shared_ptr<DataFile>& image) {
+        auto it = _head_storage_lru_positions.find(image);
+        if (it != _head_storage_lru_positions.end()) {
+            _head_storage_lru_images.splice(_head_storage_lru_images.end(), _head_storage_lru_images, it->second);
+        } else {
+            _head_storage_lru_positions[image] = _head_storage_lru_images.insert(_head_storage_lru_images.end(), image);
+        }
+    }
+
+    /**
+     * @brief Prevent an image on the head node from being evicted
+     * @param image an image file
+     */
+    void ServerlessStateOfTheSystem::pinHeadStorageImage(const std::shared_ptr<DataFile>& image) {
+        _head_storage_pin_counts[image]++;
+    }
+
+    /**
+     * @brief Undo one pinHeadStorageImage() call for an image on the head node
+     * @param image an image file
+     */
+    void ServerlessStateOfTheSystem::unpinHeadStorageImage(const std::shared_ptr<DataFile>& image) {
+        auto it = _head_storage_pin_counts.find(image);
+        if (it == _head_storage_pin_counts.end()) {
+            throw std::runtime_error("ServerlessStateOfTheSystem::unpinHeadStorageImage(): image " +
+                                     image->getID() + " is not pinned");
+        }
+        if (--(it->second) == 0) {
+            _head_storage_pin_counts.erase(it);
+        }
+    }
+
+    /**
+     * @brief Pick images to evict from the head node, in LRU order and skipping pinned images,
+     *        so as to free up some space
+     * @param space_needed the number of bytes that must be freed
+     * @return The images to evict (empty if enough space cannot be freed)
+     */
+    std::vector<std::shared_ptr<DataFile>> ServerlessStateOfTheSystem::pickHeadStorageImagesToEvict(
+        sg_size_t space_needed) const {
+        std::vector<std::shared_ptr<DataFile>> victims;
+        sg_size_t freed_space = 0;
+        for (const auto& image : _head_storage_lru_images) {
+            if (freed_space >= space_needed) {
+                break;
+            }
+            if (isImageOnHeadStoragePinned(image)) {
+                continue;
+            }
+            victims.push_back(image);
+            freed_space += image->getSize();
+        }
+        if (freed_space < space_needed) {
+            return {};
+        }
+        return victims;
+    }
+
+    /**
+     * @brief Forget about an image that has been removed from the head node, and reclaim its space
+     * @param image an image file
+     */
+    void ServerlessStateOfTheSystem::forgetHeadStorageImage(const std::shared_ptr<DataFile>& image) {
+        auto it = _head_storage_lru_positions.find(image);
+        if (it == _head_storage_lru_positions.end()) {
+            return;
+        }
+        _head_storage_lru_images.erase(it->second);
+        _head_storage_lru_positions.erase(it);
+        _free_space_on_head_storage += image->getSize();
+        _num_head_storage_image_evictions++;
+    }
+
+    /**
+     * @brief Get the number of completed invocations that had a deadline
+     * @return A number of invocations
+     */
+    unsigned long ServerlessStateOfTheSystem::getNumCompletedInvocationsWithDeadline() const {
+        return _num_completed_invocations_with_deadline;
+    }
+
+    /**
+     * @brief Get the number of completed invocations that have missed their deadline
+     * @return A number of invocations
+     */
+    unsigned long ServerlessStateOfTheSystem::getNumSLOViolations() const {
+        return _num_slo_violations;
+    }
+
     /**
      * @brief Getter for the map of available RAM
      * @return The RAM availability map
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench/services/compute/serverless/schedulers/DeadlineAwareServerlessScheduler.h>
+#include <wrench/simulation/Simulation.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param ordering the order in which schedulable invocations are considered
+     */
+    DeadlineAwareServerlessScheduler::DeadlineAwareServerlessScheduler(Ordering ordering) : _ordering(ordering) {
+    }
+
+    /**
+     * @brief Given the list of schedulable invocations and the current system state, decide:
+     *   - which images to copy to compute nodes
+     *   - which images to load into memory at compute nodes
+     *   - which invocations to start at compute nodes
+     *
+     * @param schedulable_invocations A list of invocations whose images reside on the head node
+     * @param state The current system state
+     * @return A SchedulingDecisions object
+     */
+    std::shared_ptr<SchedulingDecisions> DeadlineAwareServerlessScheduler::schedule(
+        const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
+        const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
+        // Compute each invocation's priority key once
+        const double now = Simulation::getCurrentSimulatedDate();
+        std::vector<std::pair<double, std::shared_ptr<Invocation>>> keyed_invocations;
+        keyed_invocations.reserve(schedulable_invocations.size());
+        for (const auto& invocation : schedulable_invocations) {
+            double key = std::numeric_limits<double>::infinity();
+            if (invocation->hasDeadline()) {
+                key = invocation->getDeadline();
+                if (_ordering == LEAST_SLACK_FIRST) {
+                    key -= now + state->getEstimatedRuntime(invocation->getRegisteredFunction());
+                }
+            }
+            keyed_invocations.emplace_back(key, invocation);
+        }
+
+        // Stable sort, so that ties (e.g., invocations without deadlines) keep their original order
+        std::stable_sort(keyed_invocations.begin(), keyed_invocations.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::list<std::shared_ptr<Invocation>> ordered_invocations;
+        for (auto& [key, invocation] : keyed_invocations) {
+            ordered_invocations.push_back(std::move(invocation));
+        }
+
+        return FCFSServerlessScheduler::schedule(ordered_invocations, state);
+    }
+} // namespace wrench
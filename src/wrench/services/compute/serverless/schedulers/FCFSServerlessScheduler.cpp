@@ -18,7 +18,7 @@ namespace wrench {
      * @return A SchedulingDecisions object
      */
     std::shared_ptr<SchedulingDecisions> FCFSServerlessScheduler::schedule(
-        const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+        const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
         const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
         auto decisions = std::make_shared<SchedulingDecisions>();
         makeImageDecisions(decisions, schedulable_invocations, state);
@@ -33,7 +33,7 @@ namespace wrench {
      * @param state The current system state
      */
     void FCFSServerlessScheduler::makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                             const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
         // Copy data from the state of the system so we can simulate assignment
         auto available_cores = state->getAvailableCores();
@@ -87,7 +87,7 @@ namespace wrench {
      * @param state The current system state
      */
     void FCFSServerlessScheduler::makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                 const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                 const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                  const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
         auto available_cores = state->getAvailableCores();
 
@@ -22,7 +22,7 @@ namespace wrench {
      * @return A SchedulingDecisions object
      */
     std::shared_ptr<SchedulingDecisions> RandomServerlessScheduler::schedule(
-        const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+        const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
         const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
         auto decision = std::make_shared<SchedulingDecisions>();
 
@@ -38,7 +38,7 @@ namespace wrench {
      * @param state The current system state
      */
     void RandomServerlessScheduler::makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                                       const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                                       const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                                        const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
 
         // Copy available cores so we can simulate assignment
@@ -106,7 +106,7 @@ namespace wrench {
      * @param state The current system state
      */
     void RandomServerlessScheduler::makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                 const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
 
         auto availableCores = state->getAvailableCores();
@@ -17,7 +17,7 @@ namespace wrench {
      * @return A SchedulingDecisions object
      */
     std::shared_ptr<SchedulingDecisions> WorkloadBalancingServerlessScheduler::schedule(
-        const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+        const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
         const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
         auto decisions = std::make_shared<SchedulingDecisions>();
         makeImageDecisions(decisions, schedulable_invocations, state);
@@ -32,7 +32,7 @@ namespace wrench {
      * @param state The current system state
      */
     void WorkloadBalancingServerlessScheduler::makeImageDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                            const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                            const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                             const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
 
 
@@ -71,7 +71,7 @@ namespace wrench {
      * @param state The current system state
      */
     void WorkloadBalancingServerlessScheduler::makeInvocationDecisions(const std::shared_ptr<SchedulingDecisions>& decisions,
-                                 const std::vector<std::shared_ptr<Invocation>>& schedulable_invocations,
+                                 const std::list<std::shared_ptr<Invocation>>& schedulable_invocations,
                                  const std::shared_ptr<ServerlessStateOfTheSystem>& state) {
 
         // Get current available cores
@@ -119,7 +119,7 @@ namespace wrench {
      * @param invocations A list of invocations
      */
     void WorkloadBalancingServerlessScheduler::calculateFunctionWorkloads(
-        const std::vector<std::shared_ptr<Invocation> > &invocations) {
+        const std::list<std::shared_ptr<Invocation> > &invocations) {
         // Clear existing data
         function_workloads.clear();
         function_pending_count.clear();
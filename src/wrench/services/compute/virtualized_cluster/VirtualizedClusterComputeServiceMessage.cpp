@@ -34,6 +34,7 @@ namespace wrench {
             const std::string &vm_name,
             const std::string &dest_pm_hostname,
             sg_size_t payload) : VirtualizedClusterComputeServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<VirtualizedClusterComputeServiceMigrateVMRequestMessage>();
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || dest_pm_hostname.empty() || vm_name.empty()) {
@@ -57,7 +58,9 @@ namespace wrench {
             bool success,
             std::shared_ptr<FailureCause> failure_cause,
             sg_size_t payload) : VirtualizedClusterComputeServiceMessage(payload), success(success),
-                              failure_cause(std::move(failure_cause)) {}
+                              failure_cause(std::move(failure_cause)) {
+        this->kind = SimulationMessage::getKindOf<VirtualizedClusterComputeServiceMigrateVMAnswerMessage>();
+    }
 
 
 }// namespace wrench
@@ -29,6 +29,7 @@ namespace wrench {
      */
     FileRegistryFileLookupRequestMessage::FileRegistryFileLookupRequestMessage(S4U_CommPort *answer_commport,
                                                                                const std::shared_ptr<DataFile> &file, sg_size_t payload) : FileRegistryMessage(payload), answer_commport(answer_commport), file(file) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryFileLookupRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || file == nullptr) {
             throw std::invalid_argument(
@@ -44,6 +45,7 @@ namespace wrench {
      */
     FileRegistryFileLookupAnswerMessage::FileRegistryFileLookupAnswerMessage(std::set<std::shared_ptr<FileLocation>> locations,
                                                                              sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryFileLookupAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
 //        if (locations.empty()) {
 //            throw std::invalid_argument(
@@ -64,6 +66,7 @@ namespace wrench {
     FileRegistryFileLookupByProximityRequestMessage::FileRegistryFileLookupByProximityRequestMessage(
             S4U_CommPort *answer_commport, std::shared_ptr<DataFile> file, const std::string& reference_host,
             std::shared_ptr<NetworkProximityService> network_proximity_service, sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryFileLookupByProximityRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((file == nullptr) || (answer_commport == nullptr) || (reference_host == "") ||
             (network_proximity_service == nullptr)) {
@@ -88,6 +91,7 @@ namespace wrench {
             std::shared_ptr<DataFile> file, const std::string& reference_host,
             std::map<double, std::shared_ptr<FileLocation>> locations,
             sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryFileLookupByProximityAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((file == nullptr) || (reference_host.empty())) {
             throw std::invalid_argument(
@@ -108,6 +112,7 @@ namespace wrench {
     FileRegistryRemoveEntryRequestMessage::FileRegistryRemoveEntryRequestMessage(S4U_CommPort *answer_commport,
                                                                                  std::shared_ptr<FileLocation> location,
                                                                                  sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryRemoveEntryRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (location == nullptr)) {
             throw std::invalid_argument(
@@ -126,6 +131,7 @@ namespace wrench {
      */
     FileRegistryRemoveEntryAnswerMessage::FileRegistryRemoveEntryAnswerMessage(bool success,
                                                                                sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryRemoveEntryAnswerMessage>();
         this->success = success;
     }
 
@@ -138,6 +144,7 @@ namespace wrench {
     FileRegistryAddEntryRequestMessage::FileRegistryAddEntryRequestMessage(S4U_CommPort *answer_commport,
                                                                            std::shared_ptr<FileLocation> location,
                                                                            sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryAddEntryRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (location == nullptr)) {
             throw std::invalid_argument(
@@ -153,6 +160,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     FileRegistryAddEntryAnswerMessage::FileRegistryAddEntryAnswerMessage(sg_size_t payload) : FileRegistryMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<FileRegistryAddEntryAnswerMessage>();
     }
 
 }// namespace wrench
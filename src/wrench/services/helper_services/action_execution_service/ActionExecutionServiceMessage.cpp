@@ -34,6 +34,7 @@ namespace wrench {
             S4U_CommPort *reply_commport,
             std::shared_ptr<Action> action,
             sg_size_t payload) : ActionExecutionServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ActionExecutionServiceSubmitActionRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((reply_commport == nullptr) || (action == nullptr)) {
             throw std::invalid_argument("ActionExecutionServiceSubmitActionRequestMessage::ActionExecutionServiceSubmitActionRequestMessage(): invalid argument");
@@ -53,6 +54,7 @@ namespace wrench {
             bool success,
             std::shared_ptr<FailureCause> cause,
             sg_size_t payload) : ActionExecutionServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ActionExecutionServiceSubmitActionAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
 #endif
         this->success = success;
@@ -71,6 +73,7 @@ namespace wrench {
             std::shared_ptr<Action> action,
             ComputeService::TerminationCause termination_cause,
             sg_size_t payload) : ActionExecutionServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ActionExecutionServiceTerminateActionRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((reply_commport == nullptr) || (action == nullptr)) {
             throw std::invalid_argument("ActionExecutionServiceTerminateActionRequestMessage::ActionExecutionServiceTerminateActionRequestMessage(): invalid argument");
@@ -90,6 +93,7 @@ namespace wrench {
     ActionExecutionServiceTerminateActionAnswerMessage::ActionExecutionServiceTerminateActionAnswerMessage(
             bool success,
             std::shared_ptr<FailureCause> cause, sg_size_t payload) : ActionExecutionServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ActionExecutionServiceTerminateActionAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
 #endif
         this->success = success;
@@ -103,6 +107,7 @@ namespace wrench {
   */
     ActionExecutionServiceActionDoneMessage::ActionExecutionServiceActionDoneMessage(
             std::shared_ptr<Action> action, sg_size_t payload) : ActionExecutionServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<ActionExecutionServiceActionDoneMessage>();
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (action == nullptr) {
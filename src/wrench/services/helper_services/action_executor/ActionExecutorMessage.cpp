@@ -26,6 +26,7 @@ namespace wrench {
      * @param action_executor: The Action Executor
      */
     ActionExecutorDoneMessage::ActionExecutorDoneMessage(std::shared_ptr<ActionExecutor> action_executor) : ActionExecutorMessage() {
+        this->kind = SimulationMessage::getKindOf<ActionExecutorDoneMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (action_executor == nullptr) {
             throw std::invalid_argument("ActionExecutorDoneMessage::ActionExecutorDoneMessage(): invalid argument");
@@ -27,6 +27,7 @@ namespace wrench {
      * @param hostname: the name of the host that has turned on
      */
     HostHasTurnedOnMessage::HostHasTurnedOnMessage(const std::string& hostname) : HostStateChangeDetectorMessage() {
+        this->kind = SimulationMessage::getKindOf<HostHasTurnedOnMessage>();
         this->hostname = hostname;
     }
 
@@ -36,6 +37,7 @@ namespace wrench {
      * @param hostname: the name of the host that has turned off
      */
     HostHasTurnedOffMessage::HostHasTurnedOffMessage(const std::string& hostname) : HostStateChangeDetectorMessage() {
+        this->kind = SimulationMessage::getKindOf<HostHasTurnedOffMessage>();
         this->hostname = hostname;
     }
 
@@ -46,6 +48,7 @@ namespace wrench {
      * @param speed: the host's new speed
      */
     HostHasChangedSpeedMessage::HostHasChangedSpeedMessage(const std::string& hostname, double speed) : HostStateChangeDetectorMessage() {
+        this->kind = SimulationMessage::getKindOf<HostHasChangedSpeedMessage>();
         this->hostname = std::move(hostname);
         this->speed = speed;
     }
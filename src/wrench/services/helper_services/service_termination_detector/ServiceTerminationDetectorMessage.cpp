@@ -27,6 +27,7 @@ namespace wrench {
      * @param service: the service that has crashed
      */
     ServiceHasCrashedMessage::ServiceHasCrashedMessage(std::shared_ptr<Service> service) : ServiceTerminationDetectorMessage() {
+        this->kind = SimulationMessage::getKindOf<ServiceHasCrashedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (service == nullptr) {
             throw std::invalid_argument("ServiceHasCrashedMessage::ServiceHasCrashedMessage(): invalid argument");
@@ -42,6 +43,7 @@ namespace wrench {
      * @param exit_code: the service exit_code
      */
     ServiceHasTerminatedMessage::ServiceHasTerminatedMessage(std::shared_ptr<Service> service, int exit_code) : ServiceTerminationDetectorMessage() {
+        this->kind = SimulationMessage::getKindOf<ServiceHasTerminatedMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (service == nullptr) {
             throw std::invalid_argument("ServiceHasTerminatedMessage::ServiceHasTerminatedMessage(): invalid argument");
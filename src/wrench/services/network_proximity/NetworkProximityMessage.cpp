@@ -29,6 +29,7 @@ namespace wrench {
     NetworkProximityLookupRequestMessage::NetworkProximityLookupRequestMessage(S4U_CommPort *answer_commport,
                                                                                std::pair<std::string, std::string> hosts,
                                                                                sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NetworkProximityLookupRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (std::get<0>(hosts).empty()) || (std::get<1>(hosts).empty())) {
             throw std::invalid_argument(
@@ -50,6 +51,7 @@ namespace wrench {
     NetworkProximityLookupAnswerMessage::NetworkProximityLookupAnswerMessage(std::pair<std::string, std::string> hosts,
                                                                              double proximity_value, double timestamp,
                                                                              sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NetworkProximityLookupAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((std::get<0>(hosts).empty()) || (std::get<1>(hosts).empty())) {
             throw std::invalid_argument(
@@ -69,6 +71,7 @@ namespace wrench {
      */
     NetworkProximityComputeAnswerMessage::NetworkProximityComputeAnswerMessage(
             std::pair<std::string, std::string> hosts, double proximity_value, sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NetworkProximityComputeAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((std::get<0>(hosts).empty()) || (std::get<1>(hosts).empty())) {
             throw std::invalid_argument(
@@ -87,6 +90,7 @@ namespace wrench {
      */
     NextContactDaemonRequestMessage::NextContactDaemonRequestMessage(std::shared_ptr<NetworkProximitySenderDaemon> daemon,
                                                                      sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NextContactDaemonRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (daemon == nullptr) {
             throw std::invalid_argument(
@@ -106,6 +110,7 @@ namespace wrench {
     NextContactDaemonAnswerMessage::NextContactDaemonAnswerMessage(std::string next_host_to_send,
                                                                    std::shared_ptr<NetworkProximityReceiverDaemon> next_daemon_to_send,
                                                                    S4U_CommPort *next_commport_to_send, sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NextContactDaemonAnswerMessage>();
         this->next_host_to_send = std::move(next_host_to_send);
         this->next_daemon_to_send = std::move(next_daemon_to_send);
         this->next_commport_to_send = next_commport_to_send;
@@ -117,6 +122,7 @@ namespace wrench {
      * @param payload: the message size in bytes
      */
     NetworkProximityTransferMessage::NetworkProximityTransferMessage(sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<NetworkProximityTransferMessage>();
     }
 
     /**
@@ -127,6 +133,7 @@ namespace wrench {
      */
     CoordinateLookupRequestMessage::CoordinateLookupRequestMessage(S4U_CommPort *answer_commport,
                                                                    std::string requested_host, sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CoordinateLookupRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr || requested_host.empty()) {
             throw std::invalid_argument(
@@ -150,6 +157,7 @@ namespace wrench {
                                                                  const std::pair<double, double>& xy_coordinate,
                                                                  double timestamp,
                                                                  sg_size_t payload) : NetworkProximityMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CoordinateLookupAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (requested_host.empty()) {
             throw std::invalid_argument(
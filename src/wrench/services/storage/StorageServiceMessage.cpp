@@ -35,6 +35,7 @@ namespace wrench {
                                                                                  const std::string &path,
                                                                                  sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFreeSpaceRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr) {
             throw std::invalid_argument(
@@ -58,6 +59,7 @@ namespace wrench {
     StorageServiceFreeSpaceAnswerMessage::StorageServiceFreeSpaceAnswerMessage(
             sg_size_t free_space, sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFreeSpaceAnswerMessage>();
         this->free_space = free_space;
     }
 
@@ -71,6 +73,7 @@ namespace wrench {
                                                                                    const std::shared_ptr<FileLocation> &location,
                                                                                    sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileLookupRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (location == nullptr)) {
             throw std::invalid_argument(
@@ -92,6 +95,7 @@ namespace wrench {
                                                                                  bool file_is_available,
                                                                                  sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileLookupAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (file == nullptr) {
             throw std::invalid_argument(
@@ -113,6 +117,7 @@ namespace wrench {
                                                                                    const std::shared_ptr<FileLocation> &location,
                                                                                    sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileDeleteRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullptr) || (location == nullptr)) {
             throw std::invalid_argument(
@@ -138,6 +143,7 @@ namespace wrench {
                                                                                  std::shared_ptr<FailureCause> failure_cause,
                                                                                  sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileDeleteAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((file == nullptr) || (storage_service == nullptr) ||
             (success && (failure_cause != nullptr)) ||
@@ -164,6 +170,7 @@ namespace wrench {
                                                                                std::shared_ptr<FileLocation> src,
                                                                                std::shared_ptr<FileLocation> dst,
                                                                                sg_size_t payload) : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileCopyRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullpr) || (src == nullptr) || (dst == nullptr)) {
             throw std::invalid_argument(
@@ -190,6 +197,7 @@ namespace wrench {
                                                                              std::shared_ptr<FailureCause> failure_cause,
                                                                              sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileCopyAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((src == nullptr) || (dst == nullptr) ||
             (success && (failure_cause != nullptr)) ||
@@ -219,6 +227,7 @@ namespace wrench {
                                                                                  sg_size_t num_bytes_to_write,
                                                                                  sg_size_t payload)
         : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileWriteRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((!answer_commport) or (!requesting_host) or (!location)) {
             throw std::invalid_argument(
@@ -247,6 +256,7 @@ namespace wrench {
                                                                                std::map<S4U_CommPort *, sg_size_t> data_write_commports_and_bytes,
                                                                                sg_size_t buffer_size,
                                                                                sg_size_t payload) : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileWriteAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((location == nullptr) ||
             (success && (data_write_commport == nullptr)) ||
@@ -278,6 +288,7 @@ namespace wrench {
                                                                                std::shared_ptr<FileLocation> location,
                                                                                sg_size_t num_bytes_to_read,
                                                                                sg_size_t payload) : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileReadRequestMessage>();
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
 
@@ -307,6 +318,7 @@ namespace wrench {
     *
     */
     StorageServiceFileReadRequestMessage::StorageServiceFileReadRequestMessage(StorageServiceFileReadRequestMessage *other) : StorageServiceMessage(other->payload), answer_commport(other->answer_commport), location(other->location), num_bytes_to_read(other->num_bytes_to_read) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileReadRequestMessage>();
     }
 
     /**
@@ -327,6 +339,7 @@ namespace wrench {
                                                                              sg_size_t buffer_size,
                                                                              unsigned long number_of_sources,
                                                                              sg_size_t payload) : StorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileReadAnswerMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((location == nullptr) ||
             (success && (failure_cause != nullptr)) || (!success && (failure_cause == nullptr))) {
@@ -351,6 +364,7 @@ namespace wrench {
     */
     StorageServiceFileContentChunkMessage::StorageServiceFileContentChunkMessage(
             std::shared_ptr<DataFile> file, sg_size_t chunk_size, bool last_chunk) : StorageServiceMessage(chunk_size) {
+        this->kind = SimulationMessage::getKindOf<StorageServiceFileContentChunkMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (file == nullptr) {
             throw std::invalid_argument(
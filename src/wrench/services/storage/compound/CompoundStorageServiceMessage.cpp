@@ -32,6 +32,7 @@ namespace wrench {
                                                                                      unsigned int stripe_count,
                                                                                      sg_size_t payload)
         : CompoundStorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CompoundStorageAllocationRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr) {
             throw std::invalid_argument(
@@ -52,6 +53,7 @@ namespace wrench {
     CompoundStorageAllocationAnswerMessage::CompoundStorageAllocationAnswerMessage(
             std::vector<std::shared_ptr<FileLocation>> locations, sg_size_t payload)
         : CompoundStorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CompoundStorageAllocationAnswerMessage>();
         this->locations = std::move(locations);
     }
 
@@ -65,6 +67,7 @@ namespace wrench {
     CompoundStorageLookupRequestMessage::CompoundStorageLookupRequestMessage(S4U_CommPort *answer_commport,
                                                                              std::shared_ptr<DataFile> file, sg_size_t payload)
         : CompoundStorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CompoundStorageLookupRequestMessage>();
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (answer_commport == nullptr) {
             throw std::invalid_argument(
@@ -84,6 +87,7 @@ namespace wrench {
     CompoundStorageLookupAnswerMessage::CompoundStorageLookupAnswerMessage(
             std::vector<std::shared_ptr<FileLocation>> locations, sg_size_t payload)
         : CompoundStorageServiceMessage(payload) {
+        this->kind = SimulationMessage::getKindOf<CompoundStorageLookupAnswerMessage>();
         this->locations = std::move(locations);
     }
 
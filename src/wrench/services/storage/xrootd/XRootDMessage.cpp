@@ -44,7 +44,9 @@ namespace wrench {
                                                      Node *node,
                                                      sg_size_t payload,
                                                      std::shared_ptr<bool> answered,
-                                                     int timeToLive) : Message(payload), answer_commport(answer_commport), original(std::move(std::move(original))), file(std::move(std::move(file))), node(node), answered(std::move(std::move(answered))), timeToLive(timeToLive) {}
+                                                     int timeToLive) : Message(payload), answer_commport(answer_commport), original(std::move(std::move(original))), file(std::move(std::move(file))), node(node), answered(std::move(std::move(answered))), timeToLive(timeToLive) {
+            this->kind = SimulationMessage::getKindOf<ContinueSearchMessage>();
+        }
         /**
          * @brief Constructor
          * @param answer_commport: The commport the final answer should be sent to
@@ -56,12 +58,16 @@ namespace wrench {
         FileNotFoundAlarm::FileNotFoundAlarm(S4U_CommPort *answer_commport,
                                              std::shared_ptr<DataFile> file,
                                              bool fileReadRequest,
-                                             std::shared_ptr<bool> answered) : Message(0), answer_commport(answer_commport), file(std::move(std::move(file))), fileReadRequest(fileReadRequest), answered(std::move(std::move(answered))) {}
+                                             std::shared_ptr<bool> answered) : Message(0), answer_commport(answer_commport), file(std::move(std::move(file))), fileReadRequest(fileReadRequest), answered(std::move(std::move(answered))) {
+            this->kind = SimulationMessage::getKindOf<FileNotFoundAlarm>();
+        }
         /**
         * @brief Copy Constructor
         * @param other: The message to copy.  timeToLive is decremented
         */
-        ContinueSearchMessage::ContinueSearchMessage(ContinueSearchMessage *other) : Message(other->payload), answer_commport(other->answer_commport), original(other->original), file(other->file), node(other->node), answered(other->answered), timeToLive(other->timeToLive - 1) {}
+        ContinueSearchMessage::ContinueSearchMessage(ContinueSearchMessage *other) : Message(other->payload), answer_commport(other->answer_commport), original(other->original), file(other->file), node(other->node), answered(other->answered), timeToLive(other->timeToLive - 1) {
+            this->kind = SimulationMessage::getKindOf<ContinueSearchMessage>();
+        }
 
         /**
          * @brief Constructor
@@ -74,7 +80,9 @@ namespace wrench {
          * @param answered: A shared boolean for if the answer has been sent to the client.  This should be the same for all messages searching for this request.  Used to prevent the multiple response problem
          */
         UpdateCacheMessage::UpdateCacheMessage(S4U_CommPort *answer_commport, std::shared_ptr<StorageServiceFileReadRequestMessage> original, Node *node, std::shared_ptr<DataFile> file, std::set<std::shared_ptr<FileLocation>> locations,
-                                               sg_size_t payload, std::shared_ptr<bool> answered) : Message(payload), answer_commport(answer_commport), original(std::move(std::move(original))), file(std::move(std::move(file))), locations(std::move(std::move(locations))), node(node), answered(std::move(std::move(answered))) {}
+                                               sg_size_t payload, std::shared_ptr<bool> answered) : Message(payload), answer_commport(answer_commport), original(std::move(std::move(original))), file(std::move(std::move(file))), locations(std::move(std::move(locations))), node(node), answered(std::move(std::move(answered))) {
+            this->kind = SimulationMessage::getKindOf<UpdateCacheMessage>();
+        }
         /**
         * @brief Pointer Copy Constructor
         * @param other: The message to copy.
@@ -84,26 +92,34 @@ namespace wrench {
         * @brief Reference Copy Constructor
         * @param other: The message to copy.
         */
-        UpdateCacheMessage::UpdateCacheMessage(UpdateCacheMessage &other) : Message(other.payload), answer_commport(other.answer_commport), original(other.original), file(other.file), locations(other.locations), node(other.node), answered(other.answered) {}
+        UpdateCacheMessage::UpdateCacheMessage(UpdateCacheMessage &other) : Message(other.payload), answer_commport(other.answer_commport), original(other.original), file(other.file), locations(other.locations), node(other.node), answered(other.answered) {
+            this->kind = SimulationMessage::getKindOf<UpdateCacheMessage>();
+        }
         /**
         * @brief Constructor
         * @param file: The file to delete.
         * @param payload: the message size in bytes
         * @param timeToLive:  The max number of hops this message can take
         */
-        RippleDelete::RippleDelete(std::shared_ptr<DataFile> file, sg_size_t payload, int timeToLive) : Message(payload), file(std::move(std::move(file))), timeToLive(timeToLive){}
+        RippleDelete::RippleDelete(std::shared_ptr<DataFile> file, sg_size_t payload, int timeToLive) : Message(payload), file(std::move(std::move(file))), timeToLive(timeToLive){
+            this->kind = SimulationMessage::getKindOf<RippleDelete>();
+        }
         /**
         * @brief Copy Constructor
         * @param other: The message to copy.
         */
-        RippleDelete::RippleDelete(RippleDelete *other) : Message(other->payload), file(other->file), timeToLive(other->timeToLive - 1) {}
+        RippleDelete::RippleDelete(RippleDelete *other) : Message(other->payload), file(other->file), timeToLive(other->timeToLive - 1) {
+            this->kind = SimulationMessage::getKindOf<RippleDelete>();
+        }
 
         /**
         * @brief External Copy Constructor
         * @param other: The storage service file delete message to copy.
         * @param timeToLive:  The max number of hops this message can take
         */
-        RippleDelete::RippleDelete(StorageServiceFileDeleteRequestMessage *other, int timeToLive) : Message(other->payload), file(other->location->getFile()), timeToLive(timeToLive) {}
+        RippleDelete::RippleDelete(StorageServiceFileDeleteRequestMessage *other, int timeToLive) : Message(other->payload), file(other->location->getFile()), timeToLive(timeToLive) {
+            this->kind = SimulationMessage::getKindOf<RippleDelete>();
+        }
 
         /**
          * @brief Constructor
@@ -117,19 +133,25 @@ namespace wrench {
          * @param search_stack:  The available paths to the file
          */
         AdvancedContinueSearchMessage::AdvancedContinueSearchMessage(S4U_CommPort *answer_commport, std::shared_ptr<StorageServiceFileReadRequestMessage> original,
-                                                                     std::shared_ptr<DataFile> file, Node *node, sg_size_t payload, std::shared_ptr<bool> answered, int timeToLive, std::vector<std::stack<Node *>> search_stack) : ContinueSearchMessage(answer_commport, std::move(original), std::move(file), node, payload, std::move(answered), timeToLive), search_stack(std::move(std::move(search_stack))){};
+                                                                     std::shared_ptr<DataFile> file, Node *node, sg_size_t payload, std::shared_ptr<bool> answered, int timeToLive, std::vector<std::stack<Node *>> search_stack) : ContinueSearchMessage(answer_commport, std::move(original), std::move(file), node, payload, std::move(answered), timeToLive), search_stack(std::move(std::move(search_stack))){
+            this->kind = SimulationMessage::getKindOf<AdvancedContinueSearchMessage>();
+        };
         /**
         * @brief Pointer Copy Constructor with auxiliary stack
         * @param toCopy: The message to copy, timeToLive is decremented
         * @param search_stack:  The available paths to the file
         */
-        AdvancedContinueSearchMessage::AdvancedContinueSearchMessage(ContinueSearchMessage *toCopy, std::vector<std::stack<Node *>> search_stack) : ContinueSearchMessage(toCopy), search_stack(std::move(std::move(search_stack))){};
+        AdvancedContinueSearchMessage::AdvancedContinueSearchMessage(ContinueSearchMessage *toCopy, std::vector<std::stack<Node *>> search_stack) : ContinueSearchMessage(toCopy), search_stack(std::move(std::move(search_stack))){
+            this->kind = SimulationMessage::getKindOf<AdvancedContinueSearchMessage>();
+        };
 
         /**
         * @brief Pointer Copy Constructor
         * @param toCopy: The message to copy, timeToLive is decremented
         */
-        AdvancedContinueSearchMessage::AdvancedContinueSearchMessage(AdvancedContinueSearchMessage *toCopy) : ContinueSearchMessage(toCopy), search_stack(toCopy->search_stack){};
+        AdvancedContinueSearchMessage::AdvancedContinueSearchMessage(AdvancedContinueSearchMessage *toCopy) : ContinueSearchMessage(toCopy), search_stack(toCopy->search_stack){
+            this->kind = SimulationMessage::getKindOf<AdvancedContinueSearchMessage>();
+        };
 
         /**
         * @brief Constructor
@@ -138,20 +160,26 @@ namespace wrench {
         * @param timeToLive:  The max number of hops this message can take
         * @param search_stack:  The available paths to the file
         */
-        AdvancedRippleDelete::AdvancedRippleDelete(std::shared_ptr<DataFile> file, sg_size_t payload, int timeToLive, std::vector<std::stack<Node *>> search_stack) : RippleDelete(std::move(file), payload, timeToLive), search_stack(std::move(std::move(search_stack))) {}
+        AdvancedRippleDelete::AdvancedRippleDelete(std::shared_ptr<DataFile> file, sg_size_t payload, int timeToLive, std::vector<std::stack<Node *>> search_stack) : RippleDelete(std::move(file), payload, timeToLive), search_stack(std::move(std::move(search_stack))) {
+            this->kind = SimulationMessage::getKindOf<AdvancedRippleDelete>();
+        }
 
         /**
         * @brief Copy Constructor with auxiliary stack
         * @param other: The message to copy.
         * @param search_stack:  The available paths to the file
         */
-        AdvancedRippleDelete::AdvancedRippleDelete(RippleDelete *other, std::vector<std::stack<Node *>> search_stack) : RippleDelete(other), search_stack(std::move(std::move(search_stack))){};
+        AdvancedRippleDelete::AdvancedRippleDelete(RippleDelete *other, std::vector<std::stack<Node *>> search_stack) : RippleDelete(other), search_stack(std::move(std::move(search_stack))){
+            this->kind = SimulationMessage::getKindOf<AdvancedRippleDelete>();
+        };
 
         /**
         * @brief Copy Constructor
         * @param other: The message to copy.
         */
-        AdvancedRippleDelete::AdvancedRippleDelete(AdvancedRippleDelete *other) : RippleDelete(other), search_stack(other->search_stack){};
+        AdvancedRippleDelete::AdvancedRippleDelete(AdvancedRippleDelete *other) : RippleDelete(other), search_stack(other->search_stack){
+            this->kind = SimulationMessage::getKindOf<AdvancedRippleDelete>();
+        };
 
         /**
          * @brief External Copy Constructor
@@ -159,6 +187,8 @@ namespace wrench {
          * @param timeToLive:  The max number of hops this message can take
          * @param search_stack:  The available paths to the file
          */
-        AdvancedRippleDelete::AdvancedRippleDelete(StorageServiceFileDeleteRequestMessage *other, int timeToLive, std::vector<std::stack<Node *>> search_stack) : RippleDelete(other, timeToLive), search_stack(std::move(std::move(search_stack))){};
+        AdvancedRippleDelete::AdvancedRippleDelete(StorageServiceFileDeleteRequestMessage *other, int timeToLive, std::vector<std::stack<Node *>> search_stack) : RippleDelete(other, timeToLive), search_stack(std::move(std::move(search_stack))){
+            this->kind = SimulationMessage::getKindOf<AdvancedRippleDelete>();
+        };
     }// namespace XRootD
 };   // namespace wrench
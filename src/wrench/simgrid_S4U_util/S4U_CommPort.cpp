@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <simgrid/s4u/Mailbox.hpp>
@@ -35,7 +36,10 @@ namespace wrench {
     std::deque<S4U_CommPort *> S4U_CommPort::free_commports;
     std::set<S4U_CommPort *> S4U_CommPort::used_commports;
     std::deque<S4U_CommPort *> S4U_CommPort::commports_to_drain;
-    unsigned long S4U_CommPort::commport_pool_size = 5000;
+    unsigned long S4U_CommPort::commport_pool_size = 1000;
+    unsigned long S4U_CommPort::commport_pool_chunk_size = 1000;
+    unsigned long S4U_CommPort::max_num_used_commports = 0;
+    unsigned long S4U_CommPort::num_commport_pool_growths = 0;
     sg_size_t S4U_CommPort::default_control_message_size;
 
     /**
@@ -137,7 +141,90 @@ namespace wrench {
         WRENCH_DEBUG("Getting a message from commport '%s' with timeout %lf sec", this->get_cname(), timeout);
 
 
-        simgrid::s4u::ActivitySet pending_receives;
+        // Fast path: a message is already available, no need to wait
+        SimulationMessage *msg = this->getAvailableMessage();
+        if (msg == nullptr) {
+            msg = this->waitForMessage(timeout);
+        }
+
+#ifdef MESSAGE_MANAGER
+        MessageManager::removeReceivedMessage(this, msg);
+#endif
+
+        WRENCH_DEBUG("Received a '%s' message from commport '%s' (%p, %llu bytes)",
+                     msg->getName().c_str(), this->get_cname(),
+                     msg, msg->payload);
+
+        return std::unique_ptr<SimulationMessage>(msg);
+    }
+
+    /**
+     * @brief Helper method to retrieve a message that is already available, if any, without going
+     *        through a (blocking) wait on the commport's pending receives. Messages are returned in
+     *        the same order as waitForMessage() would return them: a completed mailbox receive comes
+     *        before a message from the message queue.
+     *
+     * @return the message, or nullptr if no message is available
+     */
+    SimulationMessage *S4U_CommPort::getAvailableMessage() {
+        // Post a receive on the mailbox (if not already done), so that a message with a non-zero
+        // payload is transferred while zero-payload messages are being returned
+        if (not this->mb_comm_posted) {
+            WRENCH_DEBUG("POSTING GET ASYNC ON MB for %s: %p", this->get_cname(), (this->mb_comm.get()));
+            this->mb_comm = this->s4u_mb->get_async<SimulationMessage>(&this->msg_mb);
+            this->mb_comm_posted = true;
+        }
+        bool done;
+        try {
+            done = this->mb_comm->test();
+        } catch (simgrid::Exception &) {
+            this->mb_comm_posted = false;
+            this->mb_comm = nullptr;
+            throw ExecutionException(std::make_shared<NetworkError>(
+                    NetworkError::RECEIVING, NetworkError::FAILURE, this->name, ""));
+        }
+        if (done) {
+            this->mb_comm_posted = false;
+            this->mb_comm = nullptr;
+            return this->msg_mb;
+        }
+
+        if (this->mq_comm_posted) {
+            // A receive was posted by a previous call (e.g., one that returned a message from the
+            // mailbox), and may have completed since then
+            try {
+                done = this->mq_comm->test();
+            } catch (simgrid::Exception &) {
+                this->mq_comm_posted = false;
+                this->mq_comm = nullptr;
+                throw ExecutionException(std::make_shared<NetworkError>(
+                        NetworkError::RECEIVING, NetworkError::FAILURE, this->name, ""));
+            }
+            if (not done) {
+                return nullptr;
+            }
+            this->mq_comm_posted = false;
+            this->mq_comm = nullptr;
+            return this->msg_mq;
+        } else if (not this->s4u_mq->empty()) {
+            // The message queue matches the pending put right away
+            try {
+                return this->s4u_mq->get<SimulationMessage>();
+            } catch (simgrid::Exception &) {
+                throw ExecutionException(std::make_shared<NetworkError>(
+                        NetworkError::RECEIVING, NetworkError::FAILURE, this->name, ""));
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Helper method to wait for a message on either the mailbox or the message queue of the commport
+     *
+     * @param timeout:  a timeout value in seconds (<0 means never timeout)
+     * @return the message
+     */
+    SimulationMessage *S4U_CommPort::waitForMessage(double timeout) {
         if (not this->mb_comm_posted) {
             WRENCH_DEBUG("POSTING GET ASYNC ON MB for %s: %p", this->get_cname(), (this->mb_comm.get()));
             this->mb_comm = this->s4u_mb->get_async<SimulationMessage>(&this->msg_mb);
@@ -153,8 +240,8 @@ namespace wrench {
             WRENCH_DEBUG("GET ASYNC ON MQ ALREADY POSTED FROM BEFORE FOR %s: %p", this->get_cname(), this->mq_comm.get());
         }
 
-        pending_receives.push(this->mb_comm);
-        pending_receives.push(this->mq_comm);
+        this->pending_receives.push(this->mb_comm);
+        this->pending_receives.push(this->mq_comm);
 
         //        WRENCH_DEBUG("IN GET MESSAGE: %p(%s)   %p(%s)",
         //                    this->mb_comm.get(), this->mb_comm->get_mailbox()->get_cname(),
@@ -163,31 +250,31 @@ namespace wrench {
         simgrid::s4u::ActivityPtr finished_recv;
         try {
             // Wait for one activity to complete
-            finished_recv = pending_receives.wait_any_for(timeout);
+            finished_recv = this->pending_receives.wait_any_for(timeout);
         } catch (simgrid::TimeoutException &) {
             //            WRENCH_DEBUG("Got A TimeoutException");
-            pending_receives.erase(this->mq_comm);
-            pending_receives.erase(this->mb_comm);
+            this->pending_receives.erase(this->mq_comm);
+            this->pending_receives.erase(this->mb_comm);
             this->mq_comm->cancel();
             this->mq_comm_posted = false;
             this->mq_comm = nullptr;
             this->mb_comm->cancel();
-            this->mq_comm = nullptr;
+            this->mb_comm = nullptr;
             this->mb_comm_posted = false;
             throw ExecutionException(std::make_shared<NetworkError>(NetworkError::RECEIVING, NetworkError::TIMEOUT, this->name, ""));
         } catch (simgrid::Exception &) {
             //            WRENCH_DEBUG("Got A simgrid::Exception");
-            auto failed_recv = pending_receives.get_failed_activity();
+            auto failed_recv = this->pending_receives.get_failed_activity();
             if (failed_recv == this->mb_comm) {
-                pending_receives.erase(this->mb_comm);
-                pending_receives.erase(this->mq_comm);
+                this->pending_receives.erase(this->mb_comm);
+                this->pending_receives.erase(this->mq_comm);
                 this->mb_comm_posted = false;
                 this->mb_comm = nullptr;
                 throw ExecutionException(std::make_shared<NetworkError>(
                         NetworkError::RECEIVING, NetworkError::FAILURE, this->name, ""));
             } else {
-                pending_receives.erase(this->mq_comm);
-                pending_receives.erase(this->mb_comm);
+                this->pending_receives.erase(this->mq_comm);
+                this->pending_receives.erase(this->mb_comm);
                 this->mq_comm_posted = false;
                 this->mq_comm = nullptr;
                 throw ExecutionException(std::make_shared<NetworkError>(
@@ -195,36 +282,28 @@ namespace wrench {
             }
         }
 
-        SimulationMessage *msg = nullptr;
+        SimulationMessage *msg;
 
         if (finished_recv == this->mb_comm) {
             //            WRENCH_DEBUG("SOME COMM FINISHED ON MB");
-            pending_receives.erase(this->mq_comm);
-            pending_receives.erase(this->mb_comm);
+            this->pending_receives.erase(this->mq_comm);
+            this->pending_receives.erase(this->mb_comm);
             msg = this->msg_mb;
             this->mb_comm_posted = false;
             this->mb_comm = nullptr;
         } else if (finished_recv == this->mq_comm) {
             //            WRENCH_DEBUG("SOME COMM FINISHED ON MQ");
-            pending_receives.erase(this->mb_comm);
-            pending_receives.erase(this->mq_comm);
+            this->pending_receives.erase(this->mb_comm);
+            this->pending_receives.erase(this->mq_comm);
             msg = this->msg_mq;
             this->mq_comm_posted = false;
             this->mq_comm = nullptr;
         } else {
-            throw std::runtime_error("S4U_CommPort::getMessage(): unknown completed communication - this should never happen: " +
+            throw std::runtime_error("S4U_CommPort::waitForMessage(): unknown completed communication - this should never happen: " +
                                      std::to_string(reinterpret_cast<unsigned long>(finished_recv.get())) + "  " + finished_recv->get_name());
         }
 
-#ifdef MESSAGE_MANAGER
-        MessageManager::removeReceivedMessage(this, msg);
-#endif
-
-        WRENCH_DEBUG("Received a '%s' message from commport '%s' (%p, %llu bytes)",
-                     msg->getName().c_str(), this->get_cname(),
-                     msg, msg->payload);
-
-        return std::unique_ptr<SimulationMessage>(msg);
+        return msg;
     }
 
     /**
@@ -391,42 +470,109 @@ namespace wrench {
 
 
     /**
-     * @brief Get a temporary commport
+     * @brief Get a temporary commport. If no commport is free, commports that were set aside
+     *        because they still held messages are reclaimed if they have since been drained and,
+     *        failing that, the pool is grown by commport_pool_chunk_size commports.
      *
      * @return a temporary commport
      */
     S4U_CommPort *S4U_CommPort::getTemporaryCommPort() {
-        if (S4U_CommPort::free_commports.empty()) {
-            throw std::runtime_error("S4U_CommPort::getTemporaryCommPort(): Out of communication ports! "
-                                     "(Increase the communication port pool size with the --wrench-commport-pool-size command-line argument (currently set at: " +
-                                     std::to_string(S4U_CommPort::commport_pool_size) + ")");
+        while (true) {
+            if (S4U_CommPort::free_commports.empty()) {
+                if (not S4U_CommPort::reclaimDrainedCommPorts()) {
+                    S4U_CommPort::growCommPortPool(std::max<unsigned long>(1, S4U_CommPort::commport_pool_chunk_size));
+                    S4U_CommPort::num_commport_pool_growths++;
+                }
+            }
+
+            auto commport = S4U_CommPort::free_commports.back();
+            S4U_CommPort::free_commports.pop_back();
+
+            if ((not commport->s4u_mb->empty()) or (not commport->s4u_mq->empty())) {
+                // Some message sent to a previous user of this commport is still there: set the
+                // commport aside until it is drained
+                S4U_CommPort::commports_to_drain.push_front(commport);
+                continue;
+            }
+
+            S4U_CommPort::used_commports.insert(commport);
+            S4U_CommPort::max_num_used_commports = std::max<unsigned long>(S4U_CommPort::max_num_used_commports,
+                                                                           S4U_CommPort::used_commports.size());
+            commport->reset();// Just in case
+            WRENCH_DEBUG("Gotten temporary commport %s (%p %p)", commport->name.c_str(), commport->mq_comm.get(), commport->mb_comm.get());
+            return commport;
         }
+    }
 
-        //        std::cerr << "FREE MAILBOX: " << S4U_CommPort::free_commports.size() << "\n";
-
-        auto commport = *(S4U_CommPort::free_commports.end() - 1);
-        S4U_CommPort::free_commports.pop_back();
-
-        if ((not commport->s4u_mb->empty()) or (not commport->s4u_mq->empty())) {
-            //            std::cerr << "############### WASTING MAILBOX " << commport->get_name() << "\n";
-            S4U_CommPort::commports_to_drain.push_front(commport);
-            return S4U_CommPort::getTemporaryCommPort();// Recursive call!
-
-            //            // Drain one commport
-            //            if (not S4U_CommPort::commports_to_drain.empty()) {
-            //                auto to_drain = *(S4U_CommPort::commports_to_drain.end() - 1);
-            //                std::cerr << "############ UNWASTING MAILBOX " << to_drain->get_name() << "\n";
-            //                S4U_CommPort::commports_to_drain.pop_back();
-            //                while (not to_drain->empty()) {
-            //                    to_drain->get<SimulationMessage>();
-            //                }
-            //            }
+    /**
+     * @brief Move the set-aside commports that have been drained back to the free commports
+     *
+     * @return true if at least one commport was reclaimed, false otherwise
+     */
+    bool S4U_CommPort::reclaimDrainedCommPorts() {
+        bool reclaimed = false;
+        for (auto it = S4U_CommPort::commports_to_drain.begin(); it != S4U_CommPort::commports_to_drain.end();) {
+            if ((*it)->s4u_mb->empty() and (*it)->s4u_mq->empty()) {
+                S4U_CommPort::free_commports.push_back(*it);
+                it = S4U_CommPort::commports_to_drain.erase(it);
+                reclaimed = true;
+            } else {
+                ++it;
+            }
+        }
+        return reclaimed;
+    }
+
+    /**
+     * @brief Add commports to the pool
+     *
+     * @param num_commports: the number of commports to add
+     */
+    void S4U_CommPort::growCommPortPool(unsigned long num_commports) {
+        WRENCH_DEBUG("Adding %lu commports to the commport pool (which has %zu commports)",
+                     num_commports, S4U_CommPort::all_commports.size());
+        S4U_CommPort::all_commports.reserve(S4U_CommPort::all_commports.size() + num_commports);
+        for (unsigned long i = 0; i < num_commports; i++) {
+            auto mb = std::make_unique<S4U_CommPort>();
+            S4U_CommPort::free_commports.push_back(mb.get());
+            S4U_CommPort::all_commports.push_back(std::move(mb));
         }
+    }
+
+    /**
+     * @brief Get the number of commports in the pool
+     *
+     * @return a number of commports
+     */
+    unsigned long S4U_CommPort::getCommPortPoolSize() {
+        return S4U_CommPort::all_commports.size();
+    }
+
+    /**
+     * @brief Get the number of commports currently in use
+     *
+     * @return a number of commports
+     */
+    unsigned long S4U_CommPort::getNumUsedCommPorts() {
+        return S4U_CommPort::used_commports.size();
+    }
 
-        S4U_CommPort::used_commports.insert(commport);
-        commport->reset();// Just in case
-                WRENCH_DEBUG("Gotten temporary commport %s (%p %p)", commport->name.c_str(), commport->mq_comm.get(), commport->mb_comm.get());
-        return commport;
+    /**
+     * @brief Get the largest number of commports that have been in use at the same time (high-water mark)
+     *
+     * @return a number of commports
+     */
+    unsigned long S4U_CommPort::getMaxNumUsedCommPorts() {
+        return S4U_CommPort::max_num_used_commports;
+    }
+
+    /**
+     * @brief Get the number of times the commport pool had to be grown
+     *
+     * @return a number of pool growths
+     */
+    unsigned long S4U_CommPort::getNumCommPortPoolGrowths() {
+        return S4U_CommPort::num_commport_pool_growths;
     }
 
 
@@ -456,12 +602,7 @@ namespace wrench {
      * @brief Create the pool of commports to use
      */
     void S4U_CommPort::createCommPortPool() {
-        S4U_CommPort::all_commports.reserve(S4U_CommPort::commport_pool_size);
-        for (unsigned long i = 0; i < S4U_CommPort::commport_pool_size; i++) {
-            auto mb = std::make_unique<S4U_CommPort>();
-            S4U_CommPort::free_commports.push_back(mb.get());
-            S4U_CommPort::all_commports.push_back(std::move(mb));
-        }
+        S4U_CommPort::growCommPortPool(S4U_CommPort::commport_pool_size);
     }
 
     unsigned long long S4U_CommPort::messageCounter = 0;
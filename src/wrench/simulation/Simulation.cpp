@@ -47,7 +47,10 @@ namespace wrench {
 
     bool Simulation::initialized = false;
 
-    std::map<std::string, std::shared_ptr<DataFile>> Simulation::data_files;
+    std::unordered_map<std::string, std::shared_ptr<DataFile>> Simulation::data_files;
+    std::map<std::string, std::shared_ptr<DataFile>> Simulation::data_file_map;
+    bool Simulation::data_file_map_is_up_to_date = true;
+    unsigned long Simulation::num_scratch_files = 0;
 
 
     /**
@@ -239,9 +242,8 @@ namespace wrench {
             std::cout << "     (use --log=xxx.threshold=info to enable log category xxxx)\n";
             std::cout << "   --help-logs for detailed help on (SimGrid's) logging options/syntax)\n";
             std::cout << "   --help-simgrid: show full help on general Simgrid command-line arguments\n";
-            std::cout << "   --wrench-commport-pool-size=<integer>: set the number of communication ports used by WRENCH (default: 50000).\n";
-            std::cout << "      This value may need to be increased, especially for simulations that simulate many\n";
-            std::cout << "      failures, for which WRENCH has a hard time avoiding all commport-related memory leaks\n";
+            std::cout << "   --wrench-commport-pool-size=<integer>: set the initial number of communication ports used by WRENCH (default: 1000).\n";
+            std::cout << "      The pool grows on demand, but starting with a larger pool avoids growing it during the simulation\n";
             std::cout << "   --wrench-default-control-message-size=<int>: the default size of control messages in bytes (default: 0). \n";
             std::cerr << "\n";
         }
@@ -1525,12 +1527,29 @@ namespace wrench {
     }
 
     /**
-      * @brief Get the list of all files in the simulation
+      * @brief Get the list of all files in the simulation. Files are stored in a hash-based
+      *        registry, and this ordered map is a view of it that is rebuilt only when files
+      *        have been added or removed since the last call (modifying it does not
+      *        add or remove files to/from the simulation).
       *
       * @return a reference to the map of files in the simulation, indexed by file ID
       */
     std::map<std::string, std::shared_ptr<DataFile>> &Simulation::getFileMap() {
-        return Simulation::data_files;
+        if (not Simulation::data_file_map_is_up_to_date) {
+            Simulation::data_file_map.clear();
+            Simulation::data_file_map.insert(Simulation::data_files.begin(), Simulation::data_files.end());
+            Simulation::data_file_map_is_up_to_date = true;
+        }
+        return Simulation::data_file_map;
+    }
+
+    /**
+     * @brief Get the number of files in the simulation (not counting scratch files)
+     *
+     * @return a number of files
+     */
+    unsigned long Simulation::getNumFiles() {
+        return Simulation::data_files.size();
     }
 
     /**
@@ -1542,11 +1561,11 @@ namespace wrench {
     *
     */
     std::shared_ptr<DataFile> Simulation::getFileByID(const std::string &id) {
-        if (Simulation::data_files.find(id) == Simulation::data_files.end()) {
+        auto file = Simulation::getFileByIDOrNull(id);
+        if (not file) {
             throw std::invalid_argument("Workflow::getFileByID(): Unknown DataFile ID " + id);
-        } else {
-            return Simulation::data_files[id];
         }
+        return file;
     }
 
     /**
@@ -1558,11 +1577,11 @@ namespace wrench {
     *
     */
     std::shared_ptr<DataFile> Simulation::getFileByIDOrNull(const std::string &id) {
-        if (Simulation::data_files.find(id) == Simulation::data_files.end()) {
+        auto it = Simulation::data_files.find(id);
+        if (it == Simulation::data_files.end()) {
             return nullptr;
-        } else {
-            return Simulation::data_files[id];
         }
+        return it->second;
     }
 
     /**
@@ -1575,16 +1594,16 @@ namespace wrench {
      *
      */
     std::shared_ptr<DataFile> Simulation::addFile(const std::string &id, sg_size_t size) {
-        // Create the DataFile object
-        if (Simulation::data_files.find(id) != Simulation::data_files.end()) {
+        auto entry = Simulation::data_files.emplace(id, nullptr);
+        if (not entry.second) {
             throw std::invalid_argument("Simulation::addFile(): DataFile with id '" +
                                         id + "' already exists");
         }
 
+        // Create the DataFile object, and add it to the set of workflow files
         auto file = std::shared_ptr<DataFile>(new DataFile(id, size));
-
-        // Add if to the set of workflow files
-        Simulation::data_files[file->id] = file;
+        entry.first->second = file;
+        Simulation::data_file_map_is_up_to_date = false;
 
         return file;
     }
@@ -1602,15 +1621,29 @@ namespace wrench {
         return Simulation::addFile(id, UnitParser::parse_size(size));
     }
 
+    /**
+     * @brief Create an anonymous scratch file, i.e., a file that is not registered with the
+     *        simulation (it cannot be looked up by ID, does not appear in the file map, and
+     *        is destroyed once no longer referenced). This is useful for temporary files that
+     *        a service creates and removes over and over.
+     *
+     * @param size: a file size in bytes
+     *
+     * @return the DataFile instance
+     */
+    std::shared_ptr<DataFile> Simulation::addScratchFile(sg_size_t size) {
+        return std::shared_ptr<DataFile>(new DataFile("__scratch_file_" + std::to_string(++Simulation::num_scratch_files), size));
+    }
+
     /**
      * @brief Remove a file from the simulation (use at your own peril if you're using the workflow API - use Workflow::removeFile() instead)
      * @param file : file to remove
      */
     void Simulation::removeFile(const std::shared_ptr<DataFile> &file) {
-        if (Simulation::data_files.find(file->getID()) == Simulation::data_files.end()) {
+        if (Simulation::data_files.erase(file->getID()) == 0) {
             throw std::invalid_argument("Simulation::removeFile(): Unknown file");
         }
-        Simulation::data_files.erase(file->getID());
+        Simulation::data_file_map_is_up_to_date = false;
     }
 
     /**
@@ -1618,6 +1651,8 @@ namespace wrench {
      */
     void Simulation::removeAllFiles() {
         Simulation::data_files.clear();
+        Simulation::data_file_map.clear();
+        Simulation::data_file_map_is_up_to_date = true;
     }
 
 
@@ -18,6 +18,26 @@ WRENCH_LOG_CATEGORY(wrench_core_simulation_message, "Log category for Simulation
 
 namespace wrench {
 
+    // Number of message kinds assigned so far (kinds are dense, in the order in which message types were first seen)
+    static unsigned long num_message_kinds = 0;
+
+#ifndef MESSAGE_MANAGER
+    // Message objects are allocated from per-size-class pools: since all objects of a message type have
+    // the same size, each pool in practice serves a handful of message types. Slabs are never given back
+    // (the pools stay at their high-water mark), and are never destroyed so that messages deleted during
+    // static destruction are still fine. Simulation actors never run in parallel, so no locking is needed.
+    // When the message manager is enabled (for debugging), plain heap allocation is used instead so that
+    // tools like valgrind and ASan see every message.
+    static constexpr std::size_t MESSAGE_POOL_GRANULARITY = 16;
+    static constexpr std::size_t MESSAGE_POOL_MAX_OBJECT_SIZE = 1024;
+    static constexpr std::size_t MESSAGE_POOL_OBJECTS_PER_SLAB = 64;
+
+    struct FreeMessageBlock {
+        FreeMessageBlock *next;
+    };
+    static FreeMessageBlock *message_pool_free_lists[MESSAGE_POOL_MAX_OBJECT_SIZE / MESSAGE_POOL_GRANULARITY] = {};
+#endif
+
 
     SimulationMessage::~SimulationMessage() {
         UNTRACK_OBJECT("message");
@@ -39,6 +59,55 @@ namespace wrench {
         TRACK_OBJECT("message");
     }
 
+    /**
+     * @brief Allocate memory for a message object
+     * @param size the size of the object
+     * @return a pointer to the allocated memory
+     */
+    void *SimulationMessage::operator new(std::size_t size) {
+#ifndef MESSAGE_MANAGER
+        if ((size > 0) and (size <= MESSAGE_POOL_MAX_OBJECT_SIZE)) {
+            auto size_class = (size - 1) / MESSAGE_POOL_GRANULARITY;
+            auto &free_list = message_pool_free_lists[size_class];
+            if (free_list == nullptr) {
+                // Carve a new slab into free blocks
+                auto block_size = (size_class + 1) * MESSAGE_POOL_GRANULARITY;
+                auto slab = static_cast<char *>(::operator new(block_size * MESSAGE_POOL_OBJECTS_PER_SLAB));
+                for (std::size_t i = 0; i < MESSAGE_POOL_OBJECTS_PER_SLAB; i++) {
+                    auto block = reinterpret_cast<FreeMessageBlock *>(slab + i * block_size);
+                    block->next = free_list;
+                    free_list = block;
+                }
+            }
+            auto block = free_list;
+            free_list = block->next;
+            return block;
+        }
+#endif
+        return ::operator new(size);
+    }
+
+    /**
+     * @brief Free the memory of a message object
+     * @param ptr a pointer to the object
+     * @param size the size of the object
+     */
+    void SimulationMessage::operator delete(void *ptr, std::size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+#ifndef MESSAGE_MANAGER
+        if ((size > 0) and (size <= MESSAGE_POOL_MAX_OBJECT_SIZE)) {
+            auto block = static_cast<FreeMessageBlock *>(ptr);
+            auto &free_list = message_pool_free_lists[(size - 1) / MESSAGE_POOL_GRANULARITY];
+            block->next = free_list;
+            free_list = block;
+            return;
+        }
+#endif
+        ::operator delete(ptr);
+    }
+
     /**
      * @brief Retrieve the message name
      * @return the name
@@ -48,5 +117,13 @@ namespace wrench {
         return boost::core::demangle(name);
     }
 
+    /**
+     * @brief Assign a new message kind
+     * @return the kind
+     */
+    unsigned long SimulationMessage::allocateKind() {
+        return num_message_kinds++;
+    }
+
 
 }// namespace wrench
@@ -20,6 +20,11 @@
 
 #include <iomanip>
 #include <fstream>
+#include <cstdio>
+#include <functional>
+#include <future>
+#include <streambuf>
+#include <map>
 #include <algorithm>
 #include <utility>
 #include <vector>
@@ -43,6 +48,169 @@ namespace wrench {
     /*******************/
 
     int SimulationOutput::unique_disk_sequence_number = 0;
+    int SimulationOutput::unique_file_sequence_number = 0;
+
+    /* Number of task records of the workflow execution section that are serialized together */
+    static constexpr size_t JSON_RECORDS_PER_CHUNK = 1024;
+
+    /**
+     * @brief A stream buffer that forwards its output to another stream buffer, indenting every line but
+     *        the first (newlines in a JSON document are all structural, as they are escaped in strings)
+     */
+    class IndentingStreamBuffer : public std::streambuf {
+    public:
+        IndentingStreamBuffer(std::streambuf *destination, std::string indentation) : destination(destination), indentation(std::move(indentation)) {}
+
+    protected:
+        int overflow(int c) override {
+            if (traits_type::eq_int_type(c, traits_type::eof())) {
+                return traits_type::not_eof(c);
+            }
+            char character = traits_type::to_char_type(c);
+            return (this->xsputn(&character, 1) == 1) ? c : traits_type::eof();
+        }
+
+        std::streamsize xsputn(const char *s, std::streamsize n) override {
+            std::streamsize start = 0;
+            for (std::streamsize i = 0; i < n; i++) {
+                if (s[i] == '\n') {
+                    this->destination->sputn(s + start, i + 1 - start);
+                    this->destination->sputn(this->indentation.data(), (std::streamsize) this->indentation.size());
+                    start = i + 1;
+                }
+            }
+            this->destination->sputn(s + start, n - start);
+            return n;
+        }
+
+    private:
+        std::streambuf *destination;
+        std::string indentation;
+    };
+
+    /**
+     * @brief A writer of a JSON file that is given the document piece by piece. JSON values are serialized
+     *        on a worker thread while the caller builds the next ones: at most two batches of values are in
+     *        memory at a time (the one being serialized and the one being built). Values are serialized
+     *        as "output << std::setw(4) << value" would, so that the file is byte-identical to a dump
+     *        of the whole document.
+     */
+    class JSONFileWriter {
+    public:
+        /**
+         * @brief Constructor
+         * @param file_path: the path of the file to write
+         */
+        explicit JSONFileWriter(const std::string &file_path) : file_path(file_path), output(file_path) {}
+
+        /**
+         * @brief Write raw text (written before the next values)
+         * @param text: the text
+         */
+        void writeText(const std::string &text) {
+            this->pending_text += text;
+        }
+
+        /**
+         * @brief Write JSON values, separated by commas, at some indentation level. This waits for
+         *        the previous values to have been serialized, and returns while these are being serialized.
+         * @param values: the values
+         * @param indent_level: the indentation level of the values
+         */
+        void writeValues(std::vector<nlohmann::json> values, unsigned int indent_level) {
+            this->waitForPendingValues();
+            this->pending_values = std::async(std::launch::async, [this, text = std::move(this->pending_text), values = std::move(values), indent_level]() {
+                this->output << text;
+                IndentingStreamBuffer indenting_buffer(this->output.rdbuf(), std::string(4 * indent_level, ' '));
+                std::ostream indented_output(&indenting_buffer);
+                for (size_t i = 0; i < values.size(); i++) {
+                    if (i > 0) {
+                        indented_output << ",\n";
+                    }
+                    indented_output << std::setw(4) << values[i];
+                }
+            });
+            this->pending_text.clear();
+        }
+
+        /**
+         * @brief Write a JSON value at some indentation level (see writeValues())
+         * @param value: the value
+         * @param indent_level: the indentation level of the value
+         */
+        void writeValue(nlohmann::json value, unsigned int indent_level) {
+            std::vector<nlohmann::json> values;
+            values.push_back(std::move(value));
+            this->writeValues(std::move(values), indent_level);
+        }
+
+        /**
+         * @brief Finish writing the file
+         */
+        void close() {
+            this->waitForPendingValues();
+            this->output << this->pending_text;
+            this->pending_text.clear();
+            this->output.close();
+        }
+
+        /**
+         * @brief Give up writing the file, which is removed
+         */
+        void abort() {
+            try {
+                this->waitForPendingValues();
+            } catch (...) {
+            }
+            this->output.close();
+            std::remove(this->file_path.c_str());
+        }
+
+    private:
+        void waitForPendingValues() {
+            if (this->pending_values.valid()) {
+                // Re-throws any exception thrown by the serialization
+                this->pending_values.get();
+            }
+        }
+
+        std::string file_path;
+        std::ofstream output;
+        std::string pending_text;
+        // Declared last so that it is destroyed first (which waits for the worker thread)
+        std::future<void> pending_values;
+    };
+
+    /**
+     * @brief Write a JSON array whose elements are generated one at a time, in chunks of JSON_RECORDS_PER_CHUNK
+     *        elements, at some indentation level, as "output << std::setw(4) << array" would (an array
+     *        with no elements is written as null, as nlohmann::json serializes a never-assigned array)
+     * @param writer: the JSON file writer
+     * @param indent_level: the indentation level of the array
+     * @param generate_elements: a function that passes each element to the function it is given
+     */
+    static void writeJSONArray(JSONFileWriter &writer, unsigned int indent_level,
+                               const std::function<void(const std::function<void(nlohmann::json)> &)> &generate_elements) {
+        std::string element_indentation(4 * (indent_level + 1), ' ');
+        bool first_chunk = true;
+        std::vector<nlohmann::json> chunk;
+        auto write_chunk = [&]() {
+            writer.writeText((first_chunk ? "[\n" : ",\n") + element_indentation);
+            writer.writeValues(std::move(chunk), indent_level + 1);
+            chunk.clear();
+            first_chunk = false;
+        };
+        generate_elements([&](nlohmann::json element) {
+            chunk.push_back(std::move(element));
+            if (chunk.size() == JSON_RECORDS_PER_CHUNK) {
+                write_chunk();
+            }
+        });
+        if (not chunk.empty()) {
+            write_chunk();
+        }
+        writer.writeText(first_chunk ? "null" : "\n" + std::string(4 * indent_level, ' ') + "]");
+    }
 
     /**
      * @brief Object representing an instance when a WorkflowTask was run.
@@ -170,42 +338,75 @@ namespace wrench {
                                            bool generate_host_utilization_layout,
                                            bool include_disk,
                                            bool include_bandwidth) {
-        nlohmann::json unified_json;
+        if (file_path.empty()) {
+            throw std::invalid_argument("SimulationOutput::dumpUnifiedJSON() requires a valid file_path");
+        }
+        if ((include_workflow_exec or include_workflow_graph) and (workflow == nullptr)) {
+            throw std::invalid_argument("SimulationOutput::dumpUnifiedJSON() requires a valid workflow");
+        }
+
+        // Each section is built while the previous one is being serialized (see writeJSONObject()), so that at most
+        // two sections are in memory at a time, and the task records of the workflow execution section are streamed
+        std::map<std::string, std::function<void(JSONFileWriter &)>> sections;
 
         if (include_platform) {
-            dumpPlatformGraphJSON(file_path, false);
-            unified_json["platform"] = platform_json_part;
+            sections["platform"] = [this](JSONFileWriter &writer) { writer.writeValue(this->buildPlatformGraphJSON(), 1); };
         }
 
         if (include_workflow_exec) {
-            dumpWorkflowExecutionJSON(workflow, file_path, generate_host_utilization_layout, false);
-            unified_json["workflow_execution"] = workflow_exec_json_part;
+            sections["workflow_execution"] = [this, &workflow, generate_host_utilization_layout](JSONFileWriter &writer) {
+                this->writeWorkflowExecutionJSON(writer, workflow, generate_host_utilization_layout);
+            };
         }
 
         if (include_workflow_graph) {
-            dumpWorkflowGraphJSON(workflow, file_path, false);
-            unified_json["workflow_graph"] = workflow_graph_json_part;
+            sections["workflow_graph"] = [this, &workflow](JSONFileWriter &writer) { writer.writeValue(this->buildWorkflowGraphJSON(workflow), 1); };
         }
 
         if (include_energy) {
-            dumpHostEnergyConsumptionJSON(file_path, false);
-            unified_json["energy_consumption"] = energy_json_part;
+            sections["energy_consumption"] = [this](JSONFileWriter &writer) { writer.writeValue(this->buildHostEnergyConsumptionJSON(), 1); };
         }
 
         if (include_disk) {
-            dumpDiskOperationsJSON(file_path, false);
-            unified_json["disk_operations"] = disk_json_part;
+            sections["disk_operations"] = [this](JSONFileWriter &writer) { writer.writeValue(this->buildDiskOperationsJSON(), 1); };
         }
 
         if (include_bandwidth) {
-            dumpLinkUsageJSON(file_path, false);
-            unified_json["link_usage"] = bandwidth_json_part;
+            sections["link_usage"] = [this](JSONFileWriter &writer) { writer.writeValue(this->buildLinkUsageJSON(), 1); };
         }
 
-        std::ofstream output(file_path);
-        output << std::setw(4) << unified_json << std::endl;
+        SimulationOutput::writeJSONObject(file_path, sections);
+    }
 
-        output.close();
+    /**
+     * @brief Write a JSON object to a file, byte-for-byte as "output << std::setw(4) << object << std::endl" would,
+     *        but without building the object: members are written in key order, each one by a function that
+     *        writes its value at an indentation level of 1 (see JSONFileWriter). If writing a member throws,
+     *        the partially written file is removed and the exception is re-thrown.
+     *
+     * @param file_path: the path of the file to write
+     * @param members: functions that write the values of the members of the object, indexed by key
+     */
+    void SimulationOutput::writeJSONObject(const std::string &file_path, const std::map<std::string, std::function<void(JSONFileWriter &)>> &members) {
+        JSONFileWriter writer(file_path);
+        try {
+            if (members.empty()) {
+                // nlohmann::json serializes a default-constructed (i.e., never assigned) object as null
+                writer.writeText("null\n");
+            } else {
+                writer.writeText("{\n");
+                for (auto it = members.begin(); it != members.end(); ++it) {
+                    writer.writeText("    " + nlohmann::json(it->first).dump() + ": ");
+                    it->second(writer);
+                    writer.writeText(std::next(it) == members.end() ? "\n" : ",\n");
+                }
+                writer.writeText("}\n");
+            }
+            writer.close();
+        } catch (...) {
+            writer.abort();
+            throw;
+        }
     }
 
 #if 0// Seems to never be used
@@ -509,8 +710,7 @@ namespace wrench {
       * @param file_path: the path to write the file
       * @param generate_host_utilization_layout: boolean specifying whether or not you would like a possible host utilization
       *     layout to be generated
-      * @param writing_file: whether or not the file is written, true by default but will be false when utilized as part
-      * of dumpUnifiedJSON
+      * @param writing_file: whether or not the file is written (true by default)
       *
       */
     void SimulationOutput::dumpWorkflowExecutionJSON(const std::shared_ptr<Workflow> &workflow,
@@ -522,8 +722,42 @@ namespace wrench {
                     "SimulationOutput::dumpWorkflowExecutionJSON() requires a valid workflow and file_path");
         }
 
+        if (writing_file) {
+            SimulationOutput::writeJSONObject(file_path, {{"workflow_execution", [this, &workflow, generate_host_utilization_layout](JSONFileWriter &writer) {
+                                                               this->writeWorkflowExecutionJSON(writer, workflow, generate_host_utilization_layout);
+                                                           }}});
+        } else {
+            this->forEachWorkflowExecutionTaskJSON(workflow, generate_host_utilization_layout, [](const nlohmann::json &) {});
+        }
+    }
+
+    /**
+     * @brief Write the workflow execution section of the JSON output (see dumpWorkflowExecutionJSON()) at an
+     *        indentation level of 1, streaming its task records
+     * @param writer: the JSON file writer
+     * @param workflow: a pointer to the Workflow
+     * @param generate_host_utilization_layout: whether a host utilization layout should be generated
+     */
+    void SimulationOutput::writeWorkflowExecutionJSON(JSONFileWriter &writer, const std::shared_ptr<Workflow> &workflow,
+                                                      bool generate_host_utilization_layout) {
+        writer.writeText("{\n        \"tasks\": ");
+        writeJSONArray(writer, 2, [this, &workflow, generate_host_utilization_layout](const std::function<void(nlohmann::json)> &add_record) {
+            this->forEachWorkflowExecutionTaskJSON(workflow, generate_host_utilization_layout, add_record);
+        });
+        writer.writeText("\n    }");
+    }
+
+    /**
+     * @brief Generate the task records of the workflow execution section of the JSON output (see dumpWorkflowExecutionJSON())
+     *        one at a time
+     * @param workflow: a pointer to the Workflow
+     * @param generate_host_utilization_layout: whether a host utilization layout should be generated
+     * @param function: a function called with each task record
+     */
+    void SimulationOutput::forEachWorkflowExecutionTaskJSON(const std::shared_ptr<Workflow> &workflow,
+                                                            bool generate_host_utilization_layout,
+                                                            const std::function<void(nlohmann::json)> &function) {
         auto tasks = workflow->getTasks();
-        nlohmann::json task_json;
 
         auto read_start_timestamps = this->getTrace<SimulationTimestampFileReadStart>();
         auto read_completion_timestamps = this->getTrace<wrench::SimulationTimestampFileReadCompletion>();
@@ -578,7 +812,7 @@ namespace wrench {
                                                                         {"id", std::get<2>(r)}});
                     file_writes.push_back(file_write);
                 }
-                task_json.push_back(
+                function(
                         {{"task_id", task->getID()},
                          {"color", task->getColor()},
                          {"execution_host", {{"hostname", current_task_execution.physical_execution_host}, {"flop_rate", Simulation::getHostFlopRate(current_task_execution.physical_execution_host)}, {"memory_manager_service", Simulation::getHostMemoryCapacity(current_task_execution.physical_execution_host)}, {"cores", Simulation::getHostNumCores(current_task_execution.physical_execution_host)}}},
@@ -593,6 +827,11 @@ namespace wrench {
             }
         }
 
+        // The remaining is only needed to generate a host utilization layout
+        if (not generate_host_utilization_layout) {
+            return;
+        }
+
         // For each attempted execution of a task, add a WorkflowTaskExecutionInstance to the list.
         for (auto const &task: tasks) {
             auto execution_history = task->getExecutionHistory();
@@ -649,24 +888,10 @@ namespace wrench {
         }
 
         // Set the "vertical position" of each WorkflowExecutionInstance, so we know where to plot each rectangle
-        if (generate_host_utilization_layout) {
-            generateHostUtilizationGraphLayout(data);
-            std::ofstream output("host_utilization_layout.json");
-            output << std::setw(4) << host_utilization_layout << std::endl;
-            output.close();
-        }
-
-        nlohmann::json workflow_execution_json;
-        nlohmann::json workflow_execution_json_single;
-        workflow_execution_json["tasks"] = task_json;
-        workflow_execution_json_single["workflow_execution"] = workflow_execution_json;
-        workflow_exec_json_part = workflow_execution_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << workflow_execution_json_single << std::endl;
-            output.close();
-        }
+        generateHostUtilizationGraphLayout(data);
+        std::ofstream output("host_utilization_layout.json");
+        output << std::setw(4) << host_utilization_layout << std::endl;
+        output.close();
     }
 
     /**
@@ -679,8 +904,7 @@ namespace wrench {
      *
      * @param workflow: a pointer to the workflow
      * @param file_path: the path to write the file
-     * @param writing_file: whether or not the file is written, true by default but will be false when utilized as part
-     * of dumpUnifiedJSON
+     * @param writing_file: whether or not the file is written (true by default)
      *
      */
     void SimulationOutput::dumpWorkflowGraphJSON(const std::shared_ptr<wrench::Workflow> &workflow,
@@ -691,6 +915,21 @@ namespace wrench {
                     "SimulationOutput::dumpWorkflowGraphJSON() requires a valid workflow and file_path");
         }
 
+        auto json_workflow = this->buildWorkflowGraphJSON(workflow);
+
+        if (writing_file) {
+            SimulationOutput::writeJSONObject(file_path, {{"name", [](JSONFileWriter &writer) { writer.writeValue("WRENCH-generated workflow", 1); }},
+                                                          {"schemaVersion", [](JSONFileWriter &writer) { writer.writeValue("1.3", 1); }},
+                                                          {"workflow", [&json_workflow](JSONFileWriter &writer) { writer.writeValue(std::move(json_workflow), 1); }}});
+        }
+    }
+
+    /**
+     * @brief Build the workflow graph section of the JSON output (see dumpWorkflowGraphJSON())
+     * @param workflow: a pointer to the Workflow
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::buildWorkflowGraphJSON(const std::shared_ptr<Workflow> &workflow) {
         std::set<std::string> used_machines;
 
         nlohmann::json tasks = nlohmann::json::array();
@@ -710,12 +949,12 @@ namespace wrench {
             }
 
             nlohmann::json parents = nlohmann::json::array();
-            for (const auto &parent: task->getParents()) {
+            for (const auto &parent: task->getParentsSpan()) {
                 parents.push_back(parent->getID());
             }
 
             nlohmann::json children = nlohmann::json::array();
-            for (const auto &child: task->getChildren()) {
+            for (const auto &child: task->getChildrenSpan()) {
                 children.push_back(child->getID());
             }
 
@@ -758,20 +997,9 @@ namespace wrench {
 
         nlohmann::json json_workflow;
         json_workflow["makespan"] = workflow->getCompletionDate();
-        json_workflow["tasks"] = tasks;
-        json_workflow["machines"] = machines;
-
-        nlohmann::json json_object;
-        json_object["name"] = "WRENCH-generated workflow";
-        json_object["schemaVersion"] = "1.3";
-        json_object["workflow"] = json_workflow;
-        workflow_graph_json_part = json_workflow;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << nlohmann::json(json_object) << std::endl;
-            output.close();
-        }
+        json_workflow["tasks"] = std::move(tasks);
+        json_workflow["machines"] = std::move(machines);
+        return json_workflow;
     }
 
     /**
@@ -818,8 +1046,7 @@ namespace wrench {
      * </pre>
      *
      * @param file_path: the path to write the file
-     * @param writing_file: whether or not the file is written, true by default but will be false when utilized as part
-     * of dumpUnifiedJSON
+     * @param writing_file: whether or not the file is written (true by default)
      */
     void SimulationOutput::dumpHostEnergyConsumptionJSON(const std::string &file_path,
                                                          bool writing_file) {
@@ -827,6 +1054,18 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpHostEnergyConsumptionJSON() requires a valid file_path");
         }
 
+        auto hosts_energy_consumption_information = this->buildHostEnergyConsumptionJSON();
+
+        if (writing_file) {
+            SimulationOutput::writeJSONObject(file_path, {{"energy_consumption", [&hosts_energy_consumption_information](JSONFileWriter &writer) { writer.writeValue(std::move(hosts_energy_consumption_information), 1); }}});
+        }
+    }
+
+    /**
+     * @brief Build the energy consumption section of the JSON output (see dumpHostEnergyConsumptionJSON())
+     * @return a JSON array
+     */
+    nlohmann::json SimulationOutput::buildHostEnergyConsumptionJSON() {
         try {
             std::vector<simgrid::s4u::Host *> hosts = get_all_physical_hosts();
 
@@ -897,15 +1136,7 @@ namespace wrench {
                 hosts_energy_consumption_information.push_back(datum);
             }
 
-            nlohmann::json energy_consumption;
-            energy_consumption["energy_consumption"] = hosts_energy_consumption_information;
-            energy_json_part = hosts_energy_consumption_information;
-
-            if (writing_file) {
-                std::ofstream output(file_path);
-                output << std::setw(4) << nlohmann::json(energy_consumption) << std::endl;
-                output.close();
-            }
+            return hosts_energy_consumption_information;
         } catch (std::runtime_error &) {
             // Just re-throw
             throw;
@@ -962,8 +1193,7 @@ namespace wrench {
      * </pre>
      *
      * @param file_path: the path to write the file
-     * @param writing_file: whether or not the file is written, true by default but will be false when utilized as part
-     * of dumpUnifiedJSON
+     * @param writing_file: whether or not the file is written (true by default)
      *
      */
     void SimulationOutput::dumpPlatformGraphJSON(const std::string &file_path,
@@ -972,6 +1202,18 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpPlatformGraphJSON() requires a valid file_path");
         }
 
+        auto platform_graph_json = this->buildPlatformGraphJSON();
+
+        if (writing_file) {
+            SimulationOutput::writeJSONObject(file_path, {{"platform", [&platform_graph_json](JSONFileWriter &writer) { writer.writeValue(std::move(platform_graph_json), 1); }}});
+        }
+    }
+
+    /**
+     * @brief Build the platform section of the JSON output (see dumpPlatformGraphJSON())
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::buildPlatformGraphJSON() {
         nlohmann::json platform_graph_json;
 
         //        simgrid::s4u::Engine *simgrid_engine = simgrid::s4u::Engine::get_instance();
@@ -1170,15 +1412,7 @@ namespace wrench {
         }
 
         //std::cerr << platform_graph_json.dump(4) << std::endl;
-        nlohmann::json platform;
-        platform["platform"] = platform_graph_json;
-        platform_json_part = platform_graph_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << nlohmann::json(platform) << std::endl;
-            output.close();
-        }
+        return platform_graph_json;
     }
 
     /**
@@ -1224,7 +1458,7 @@ namespace wrench {
      * </pre>
      *
      * @param file_path - path to save JSON at
-     * @param writing_file - boolean, default true, to write the JSON to the specified file path. Used for unified output.
+     * @param writing_file - boolean, default true, to write the JSON to the specified file path.
      *
      */
     void SimulationOutput::dumpDiskOperationsJSON(const std::string &file_path,
@@ -1232,6 +1466,24 @@ namespace wrench {
         if (file_path.empty()) {
             throw std::invalid_argument("SimulationOutput::dumpDiskOperationJSON() requires a valid file_path");
         }
+
+        auto disk_operations_json = this->buildDiskOperationsJSON();
+
+        if (writing_file) {
+            // The hosts are the members of the document
+            std::map<std::string, std::function<void(JSONFileWriter &)>> hosts;
+            for (auto &host: disk_operations_json.items()) {
+                hosts[host.key()] = [&host_json = host.value()](JSONFileWriter &writer) { writer.writeValue(std::move(host_json), 1); };
+            }
+            SimulationOutput::writeJSONObject(file_path, hosts);
+        }
+    }
+
+    /**
+     * @brief Build the disk operations section of the JSON output (see dumpDiskOperationsJSON())
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::buildDiskOperationsJSON() {
         nlohmann::json disk_operations_json;
 
         auto read_start_timestamps = this->getTrace<SimulationTimestampDiskReadStart>();
@@ -1344,13 +1596,7 @@ namespace wrench {
             }
         }
 
-        disk_json_part = disk_operations_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << disk_operations_json << std::endl;
-            output.close();
-        }
+        return disk_operations_json;
     }
 
     /** Writes a JSON file containing link usage information as a JSON array.
@@ -1393,6 +1639,18 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpLinkUsageJSON() requires a valid file_path");
         }
 
+        auto links_list = this->buildLinkUsageJSON();
+
+        if (writing_file) {
+            SimulationOutput::writeJSONObject(file_path, {{"link_usage", [&links_list](JSONFileWriter &writer) { writer.writeValue(std::move(links_list), 1); }}});
+        }
+    }
+
+    /**
+     * @brief Build the link usage section of the JSON output (see dumpLinkUsageJSON())
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::buildLinkUsageJSON() {
         nlohmann::json bandwidth_json;
 
         std::vector<simgrid::s4u::Link *> links = get_all_links();
@@ -1412,17 +1670,9 @@ namespace wrench {
             bandwidth_json.push_back(datum);
         }
 
-        nlohmann::json link_usage;
         nlohmann::json links_list;
-        links_list["links"] = bandwidth_json;
-        link_usage["link_usage"] = links_list;
-        bandwidth_json_part = links_list;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << link_usage << std::endl;
-            output.close();
-        }
+        links_list["links"] = std::move(bandwidth_json);
+        return links_list;
     }
 
     /**
@@ -1531,16 +1781,19 @@ namespace wrench {
      * @param src: the source location
      * @param service: the source storage service
      * @param task: the workflow task for which this read is done (or nullptr);
+     * @return a correlation handle to pass to the matching failure/completion timestamp
      */
-    void SimulationOutput::addTimestampFileReadStart(double date,
-                                                     const std::shared_ptr<DataFile> &file,
-                                                     const std::shared_ptr<FileLocation> &src,
-                                                     const std::shared_ptr<StorageService> &service,
-                                                     std::shared_ptr<WorkflowTask> task) {
+    int SimulationOutput::addTimestampFileReadStart(double date,
+                                                    const std::shared_ptr<DataFile> &file,
+                                                    const std::shared_ptr<FileLocation> &src,
+                                                    const std::shared_ptr<StorageService> &service,
+                                                    std::shared_ptr<WorkflowTask> task) {
+        int unique_sequence_number = SimulationOutput::unique_file_sequence_number++;
         if (this->isEnabled<SimulationTimestampFileReadStart>()) {
             this->addTimestamp<SimulationTimestampFileReadStart>(
-                    new SimulationTimestampFileReadStart(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileReadStart(date, file, src, service, std::move(task), unique_sequence_number));
         }
+        return unique_sequence_number;
     }
 
     /**
@@ -1550,15 +1803,18 @@ namespace wrench {
     * @param src: the source location
     * @param service: the source storage service
     * @param task: the workflow task for which this read is done (or nullptr);
+    * @param unique_sequence_number: the correlation handle returned when the start timestamp was added (-1 if unknown, in which case
+    *        the start timestamp is found by a linear scan of the pending start timestamps, which is slower)
     */
     void SimulationOutput::addTimestampFileReadFailure(double date,
                                                        const std::shared_ptr<DataFile> &file,
                                                        const std::shared_ptr<FileLocation> &src,
                                                        const std::shared_ptr<StorageService> &service,
-                                                       std::shared_ptr<WorkflowTask> task) {
+                                                       std::shared_ptr<WorkflowTask> task,
+                                                       int unique_sequence_number) {
         if (this->isEnabled<SimulationTimestampFileReadFailure>()) {
             this->addTimestamp<SimulationTimestampFileReadFailure>(
-                    new SimulationTimestampFileReadFailure(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileReadFailure(date, file, src, service, std::move(task), unique_sequence_number));
         }
     }
 
@@ -1569,16 +1825,19 @@ namespace wrench {
     * @param src: the source location
     * @param service: the source storage service
     * @param task: the workflow task for which this read is done (or nullptr);
+    * @param unique_sequence_number: the correlation handle returned when the start timestamp was added (-1 if unknown, in which case
+    *        the start timestamp is found by a linear scan of the pending start timestamps, which is slower)
     */
     void
     SimulationOutput::addTimestampFileReadCompletion(double date,
                                                      const std::shared_ptr<DataFile> &file,
                                                      const std::shared_ptr<FileLocation> &src,
                                                      const std::shared_ptr<StorageService> &service,
-                                                     std::shared_ptr<WorkflowTask> task) {
+                                                     std::shared_ptr<WorkflowTask> task,
+                                                     int unique_sequence_number) {
         if (this->isEnabled<SimulationTimestampFileReadCompletion>()) {
             this->addTimestamp<SimulationTimestampFileReadCompletion>(
-                    new SimulationTimestampFileReadCompletion(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileReadCompletion(date, file, src, service, std::move(task), unique_sequence_number));
         }
     }
 
@@ -1589,16 +1848,19 @@ namespace wrench {
      * @param src: the target location
      * @param service: the target storage service
      * @param task: the workflow task for which this write is done (or nullptr);
+     * @return a correlation handle to pass to the matching failure/completion timestamp
      */
-    void SimulationOutput::addTimestampFileWriteStart(double date,
-                                                      const std::shared_ptr<DataFile> &file,
-                                                      const std::shared_ptr<FileLocation> &src,
-                                                      const std::shared_ptr<StorageService> &service,
-                                                      std::shared_ptr<WorkflowTask> task) {
+    int SimulationOutput::addTimestampFileWriteStart(double date,
+                                                     const std::shared_ptr<DataFile> &file,
+                                                     const std::shared_ptr<FileLocation> &src,
+                                                     const std::shared_ptr<StorageService> &service,
+                                                     std::shared_ptr<WorkflowTask> task) {
+        int unique_sequence_number = SimulationOutput::unique_file_sequence_number++;
         if (this->isEnabled<SimulationTimestampFileWriteStart>()) {
             this->addTimestamp<SimulationTimestampFileWriteStart>(
-                    new SimulationTimestampFileWriteStart(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileWriteStart(date, file, src, service, std::move(task), unique_sequence_number));
         }
+        return unique_sequence_number;
     }
 
     /**
@@ -1608,15 +1870,18 @@ namespace wrench {
     * @param src: the target location
     * @param service: the target storage service
     * @param task: the workflow task for which this write is done (or nullptr);
+    * @param unique_sequence_number: the correlation handle returned when the start timestamp was added (-1 if unknown, in which case
+    *        the start timestamp is found by a linear scan of the pending start timestamps, which is slower)
     */
     void SimulationOutput::addTimestampFileWriteFailure(double date,
                                                         const std::shared_ptr<DataFile> &file,
                                                         const std::shared_ptr<FileLocation> &src,
                                                         const std::shared_ptr<StorageService> &service,
-                                                        std::shared_ptr<WorkflowTask> task) {
+                                                        std::shared_ptr<WorkflowTask> task,
+                                                        int unique_sequence_number) {
         if (this->isEnabled<SimulationTimestampFileWriteFailure>()) {
             this->addTimestamp<SimulationTimestampFileWriteFailure>(
-                    new SimulationTimestampFileWriteFailure(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileWriteFailure(date, file, src, service, std::move(task), unique_sequence_number));
         }
     }
 
@@ -1627,16 +1892,19 @@ namespace wrench {
     * @param src: the target location
     * @param service: the target storage service
     * @param task: the workflow task for which this write is done (or nullptr);
+    * @param unique_sequence_number: the correlation handle returned when the start timestamp was added (-1 if unknown, in which case
+    *        the start timestamp is found by a linear scan of the pending start timestamps, which is slower)
     */
     void
     SimulationOutput::addTimestampFileWriteCompletion(double date,
                                                       const std::shared_ptr<DataFile> &file,
                                                       const std::shared_ptr<FileLocation> &src,
                                                       const std::shared_ptr<StorageService> &service,
-                                                      std::shared_ptr<WorkflowTask> task) {
+                                                      std::shared_ptr<WorkflowTask> task,
+                                                      int unique_sequence_number) {
         if (this->isEnabled<SimulationTimestampFileWriteCompletion>()) {
             this->addTimestamp<SimulationTimestampFileWriteCompletion>(
-                    new SimulationTimestampFileWriteCompletion(date, file, src, service, std::move(task)));
+                    new SimulationTimestampFileWriteCompletion(date, file, src, service, std::move(task), unique_sequence_number));
         }
     }
 
@@ -1822,33 +2090,34 @@ namespace wrench {
      */
     void SimulationOutput::addTimestampEnergyConsumption(double date, const std::string &hostname,
                                                          double joules) {
-        static std::unordered_map<std::string, std::vector<SimulationTimestampEnergyConsumption *>> last_two_timestamps;
+        // The last two timestamps added for each host, as (timestamp, index in the trace) pairs
+        static std::unordered_map<std::string, std::vector<std::pair<SimulationTimestampEnergyConsumption *, unsigned long>>> last_two_timestamps;
 
         if (not this->isEnabled<SimulationTimestampEnergyConsumption>()) {
             return;
         }
 
         auto new_timestamp = new SimulationTimestampEnergyConsumption(date, hostname, joules);
+        auto trace = this->getOrCreateTrace<SimulationTimestampEnergyConsumption>();
+        auto &last_two = last_two_timestamps[hostname];
 
         // If less thant 2 time-stamp for that host, just record and add
-        if (last_two_timestamps[hostname].size() < 2) {
-            last_two_timestamps[hostname].push_back(new_timestamp);
-            this->addTimestamp<SimulationTimestampEnergyConsumption>(new_timestamp);
+        if (last_two.size() < 2) {
+            last_two.emplace_back(new_timestamp, trace->addTimestamp(new_timestamp));
             return;
         }
 
         // Otherwise, check whether we can merge
-        bool can_merge = DBL_EQUAL(last_two_timestamps[hostname].at(0)->getConsumption(),
-                                   last_two_timestamps[hostname].at(1)->getConsumption()) and
-                         DBL_EQUAL(last_two_timestamps[hostname].at(1)->getConsumption(),
-                                   new_timestamp->getConsumption());
+        bool can_merge = DBL_EQUAL(last_two.at(0).first->getConsumption(), last_two.at(1).first->getConsumption()) and
+                         DBL_EQUAL(last_two.at(1).first->getConsumption(), new_timestamp->getConsumption());
 
         if (can_merge) {
-            last_two_timestamps[hostname].at(1)->setDate(new_timestamp->getDate());
+            // Update the date in place (so that the trace's date column is updated as well)
+            trace->setDate(last_two.at(1).second, new_timestamp->getDate());
+            delete new_timestamp;
         } else {
-            last_two_timestamps[hostname][0] = last_two_timestamps[hostname][1];
-            last_two_timestamps[hostname][1] = new_timestamp;
-            this->addTimestamp<SimulationTimestampEnergyConsumption>(new_timestamp);
+            last_two[0] = last_two[1];
+            last_two[1] = std::make_pair(new_timestamp, trace->addTimestamp(new_timestamp));
         }
     }
 
@@ -1860,35 +2129,151 @@ namespace wrench {
      */
     void SimulationOutput::addTimestampLinkUsage(double date, const std::string &link_name,
                                                  double bytes_per_second) {
-        static std::unordered_map<std::string, std::vector<SimulationTimestampLinkUsage *>> last_two_timestamps;
+        // The last two timestamps added for each link, as (timestamp, index in the trace) pairs
+        static std::unordered_map<std::string, std::vector<std::pair<SimulationTimestampLinkUsage *, unsigned long>>> last_two_timestamps;
 
         if (not this->isEnabled<SimulationTimestampLinkUsage>()) {
             return;
         }
 
         auto new_timestamp = new SimulationTimestampLinkUsage(date, link_name, bytes_per_second);
+        auto trace = this->getOrCreateTrace<SimulationTimestampLinkUsage>();
+        auto &last_two = last_two_timestamps[link_name];
 
         // If less thant 2 time-stamp for that link, just record and add
-        if (last_two_timestamps[link_name].size() < 2) {
-            last_two_timestamps[link_name].push_back(new_timestamp);
-            this->addTimestamp<SimulationTimestampLinkUsage>(new_timestamp);
+        if (last_two.size() < 2) {
+            last_two.emplace_back(new_timestamp, trace->addTimestamp(new_timestamp));
             return;
         }
 
         // Otherwise, check whether we can merge
-        bool can_merge = DBL_EQUAL(last_two_timestamps[link_name].at(0)->getUsage(),
-                                   last_two_timestamps[link_name].at(1)->getUsage()) and
-                         DBL_EQUAL(last_two_timestamps[link_name].at(1)->getUsage(), new_timestamp->getUsage());
+        bool can_merge = DBL_EQUAL(last_two.at(0).first->getUsage(), last_two.at(1).first->getUsage()) and
+                         DBL_EQUAL(last_two.at(1).first->getUsage(), new_timestamp->getUsage());
 
         if (can_merge) {
-            last_two_timestamps[link_name].at(1)->setDate(new_timestamp->getDate());
+            // Update the date in place (so that the trace's date column is updated as well)
+            trace->setDate(last_two.at(1).second, new_timestamp->getDate());
+            delete new_timestamp;
         } else {
-            last_two_timestamps[link_name][0] = last_two_timestamps[link_name][1];
-            last_two_timestamps[link_name][1] = new_timestamp;
-            this->addTimestamp<SimulationTimestampLinkUsage>(new_timestamp);
+            last_two[0] = last_two[1];
+            last_two[1] = std::make_pair(new_timestamp, trace->addTimestamp(new_timestamp));
         }
     }
 
+    /**
+     * @brief Enable the streaming of timestamps to a file: instead of being kept in memory
+     *        until the end of the simulation, task, file read/write/copy, and disk read/write
+     *        timestamps are written to the file as they are generated (start timestamps are
+     *        kept in memory only until their matching end timestamps are generated). Streamed
+     *        timestamps do not appear in traces returned by getTrace() or in JSON dumps, and
+     *        can be read back with a SimulationTimestampStreamReader. Energy, pstate, and link usage
+     *        timestamps, which are merged/overwritten after they have been recorded, are not streamed.
+     *
+     * @param file_path: the path of the file to write (overwritten if it exists)
+     * @param format: the file format
+     */
+    void SimulationOutput::enableTimestampStreaming(const std::string &file_path, SimulationTimestampStream::Format format) {
+        this->timestamp_stream = std::make_unique<SimulationTimestampStream>(file_path, format);
+    }
+
+    /**
+     * @brief Disable the streaming of timestamps to a file (the file is flushed and closed), after
+     *        which timestamps are kept in memory again. Start timestamps that have been streamed but not
+     *        yet matched by end timestamps are moved to the in-memory traces, so that their end timestamps
+     *        can be matched with them.
+     */
+    void SimulationOutput::disableTimestampStreaming() {
+        this->timestamp_stream = nullptr;
+
+        // Move the pending start timestamps to their traces, in the order in which they were streamed
+        std::vector<StreamedPendingTimestamp *> pending;
+        pending.reserve(this->streamed_pending_timestamps.size());
+        for (auto &p: this->streamed_pending_timestamps) {
+            pending.push_back(&p.second);
+        }
+        std::sort(pending.begin(), pending.end(), [](const StreamedPendingTimestamp *lhs, const StreamedPendingTimestamp *rhs) {
+            return lhs->sequence_number < rhs->sequence_number;
+        });
+        for (auto const &p: pending) {
+            p->add_to_trace(this, p->timestamp.release());
+        }
+        this->streamed_pending_timestamps.clear();
+    }
+
+    /**
+     * @brief Helper method to get the fields of a task timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampTask *timestamp) {
+        return {{"task", timestamp->getTask()->getID()}};
+    }
+
+    /**
+     * @brief Helper method to get the fields of a file read timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampFileRead *timestamp) {
+        nlohmann::json fields = {{"file", timestamp->getFile()->getID()},
+                                 {"source", timestamp->getSource()->toString()},
+                                 {"service", timestamp->getService()->getName()}};
+        if (timestamp->getTask()) {
+            fields["task"] = timestamp->getTask()->getID();
+        }
+        return fields;
+    }
+
+    /**
+     * @brief Helper method to get the fields of a file write timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampFileWrite *timestamp) {
+        nlohmann::json fields = {{"file", timestamp->getFile()->getID()},
+                                 {"destination", timestamp->getDestination()->toString()},
+                                 {"service", timestamp->getService()->getName()}};
+        if (timestamp->getTask()) {
+            fields["task"] = timestamp->getTask()->getID();
+        }
+        return fields;
+    }
+
+    /**
+     * @brief Helper method to get the fields of a file copy timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampFileCopy *timestamp) {
+        return {{"file", timestamp->getFile()->getID()},
+                {"source", timestamp->getSource()->toString()},
+                {"destination", timestamp->getDestination()->toString()}};
+    }
+
+    /**
+     * @brief Helper method to get the fields of a disk read timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampDiskRead *timestamp) {
+        return {{"hostname", timestamp->getHostname()},
+                {"mount", timestamp->getMount()},
+                {"bytes", timestamp->getBytes()},
+                {"counter", timestamp->getCounter()}};
+    }
+
+    /**
+     * @brief Helper method to get the fields of a disk write timestamp to be streamed
+     * @param timestamp: the timestamp
+     * @return a JSON object
+     */
+    nlohmann::json SimulationOutput::getTimestampFields(SimulationTimestampDiskWrite *timestamp) {
+        return {{"hostname", timestamp->getHostname()},
+                {"mount", timestamp->getMount()},
+                {"bytes", timestamp->getBytes()},
+                {"counter", timestamp->getCounter()}};
+    }
+
     /**
      * @brief Enable or Disable the insertion of task-related timestamps in
      *        the simulation output (enabled by default)
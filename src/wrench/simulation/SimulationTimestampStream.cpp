@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <wrench/simulation/SimulationTimestampStream.h>
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param file_path: the path of the file to write (overwritten if it exists)
+     * @param format: the format of the file
+     */
+    SimulationTimestampStream::SimulationTimestampStream(const std::string &file_path, Format format) : file_path(file_path), format(format) {
+        this->stream.open(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (not this->stream.is_open()) {
+            throw std::invalid_argument("SimulationTimestampStream::SimulationTimestampStream(): cannot open file " + file_path + " for writing");
+        }
+        if (this->format == BINARY) {
+            this->stream.write(BINARY_MAGIC, (std::streamsize) strlen(BINARY_MAGIC));
+        }
+    }
+
+    /**
+     * @brief Destructor (flushes and closes the file)
+     */
+    SimulationTimestampStream::~SimulationTimestampStream() {
+        this->stream.close();
+    }
+
+    /**
+     * @brief Write a timestamp record
+     * @param type: the timestamp type
+     * @param date: the timestamp date
+     * @param fields: the type-specific fields of the timestamp (a JSON object)
+     */
+    void SimulationTimestampStream::write(const std::string &type, double date, nlohmann::json fields) {
+        fields["type"] = type;
+        fields["date"] = date;
+
+        if (this->format == JSON_LINES) {
+            this->stream << fields.dump() << '\n';
+        } else {
+            auto bytes = nlohmann::json::to_cbor(fields);
+            auto length = (uint32_t) bytes.size();
+            unsigned char length_bytes[4];
+            for (int i = 0; i < 4; i++) {
+                length_bytes[i] = (unsigned char) ((length >> (8 * i)) & 0xFF);
+            }
+            this->stream.write(reinterpret_cast<const char *>(length_bytes), 4);
+            this->stream.write(reinterpret_cast<const char *>(bytes.data()), (std::streamsize) bytes.size());
+        }
+        if (not this->stream.good()) {
+            throw std::runtime_error("SimulationTimestampStream::write(): error while writing to file " + this->file_path);
+        }
+        this->num_records++;
+    }
+
+    /**
+     * @brief Flush all written records to the file
+     */
+    void SimulationTimestampStream::flush() {
+        this->stream.flush();
+    }
+
+    /**
+     * @brief Get the format of the stream
+     * @return a format
+     */
+    SimulationTimestampStream::Format SimulationTimestampStream::getFormat() const {
+        return this->format;
+    }
+
+    /**
+     * @brief Get the path of the file to which the stream writes
+     * @return a file path
+     */
+    const std::string &SimulationTimestampStream::getFilePath() const {
+        return this->file_path;
+    }
+
+    /**
+     * @brief Get the number of records written so far
+     * @return a number of records
+     */
+    unsigned long SimulationTimestampStream::getNumRecords() const {
+        return this->num_records;
+    }
+
+    /**
+     * @brief Constructor
+     * @param file_path: the path of a file written by a SimulationTimestampStream
+     */
+    SimulationTimestampStreamReader::SimulationTimestampStreamReader(const std::string &file_path) {
+        this->stream.open(file_path, std::ios::in | std::ios::binary);
+        if (not this->stream.is_open()) {
+            throw std::invalid_argument("SimulationTimestampStreamReader::SimulationTimestampStreamReader(): cannot open file " + file_path);
+        }
+
+        // Detect the format
+        auto magic_length = strlen(SimulationTimestampStream::BINARY_MAGIC);
+        std::vector<char> magic(magic_length);
+        this->stream.read(magic.data(), (std::streamsize) magic_length);
+        if ((this->stream.gcount() == (std::streamsize) magic_length) and
+            (not strncmp(magic.data(), SimulationTimestampStream::BINARY_MAGIC, magic_length))) {
+            this->format = SimulationTimestampStream::BINARY;
+        } else {
+            this->format = SimulationTimestampStream::JSON_LINES;
+            this->stream.clear();
+            this->stream.seekg(0);
+        }
+    }
+
+    /**
+     * @brief Read the next record
+     * @param record: the record to fill in
+     * @return true if a record was read, false if the end of the stream has been reached
+     */
+    bool SimulationTimestampStreamReader::next(nlohmann::json &record) {
+        if (this->format == SimulationTimestampStream::JSON_LINES) {
+            std::string line;
+            while (std::getline(this->stream, line)) {
+                if (not line.empty()) {
+                    record = nlohmann::json::parse(line);
+                    return true;
+                }
+            }
+            return false;
+        } else {
+            unsigned char length_bytes[4];
+            this->stream.read(reinterpret_cast<char *>(length_bytes), 4);
+            if (this->stream.gcount() == 0) {
+                return false;
+            }
+            if (this->stream.gcount() != 4) {
+                throw std::runtime_error("SimulationTimestampStreamReader::next(): truncated record");
+            }
+            uint32_t length = 0;
+            for (int i = 0; i < 4; i++) {
+                length |= ((uint32_t) length_bytes[i]) << (8 * i);
+            }
+            std::vector<std::uint8_t> bytes(length);
+            this->stream.read(reinterpret_cast<char *>(bytes.data()), length);
+            if (this->stream.gcount() != (std::streamsize) length) {
+                throw std::runtime_error("SimulationTimestampStreamReader::next(): truncated record");
+            }
+            record = nlohmann::json::from_cbor(bytes);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Get the (detected) format of the stream
+     * @return a format
+     */
+    SimulationTimestampStream::Format SimulationTimestampStreamReader::getFormat() const {
+        return this->format;
+    }
+
+}// namespace wrench
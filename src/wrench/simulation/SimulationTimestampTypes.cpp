@@ -86,7 +86,7 @@ namespace wrench {
     /**
      * @brief A static map of SimulationTimestampTaskStart objects that have yet to matched with SimulationTimestampTaskFailure, SimulationTimestampTaskTerminated, SimulationTimestampTaskCompletion timestamps
      */
-    std::map<std::string, SimulationTimestampTask *> SimulationTimestampTask::pending_task_timestamps;
+    std::unordered_map<WorkflowTask *, SimulationTimestampTask *> SimulationTimestampTask::pending_task_timestamps;
 
 
     /**
@@ -94,7 +94,7 @@ namespace wrench {
      */
     void SimulationTimestampTask::setEndpoints() {
         // find the SimulationTimestampTaskStart object containing the same task
-        auto pending_tasks_itr = pending_task_timestamps.find(this->task->getID());
+        auto pending_tasks_itr = pending_task_timestamps.find(this->task.get());
 
         if (pending_tasks_itr != pending_task_timestamps.end()) {
             // set my endpoint to the SimulationTimestampTaskStart
@@ -131,7 +131,7 @@ namespace wrench {
          * Upon creation, this object adds a pointer of itself to the 'pending_task_timestamps' map so that it's endpoint can
          * be set when a SimulationTimestampTaskFailure, SimulationTimestampTaskTerminated, or SimulationTimestampTaskCompletion is created
          */
-        pending_task_timestamps.insert(std::make_pair(task->getID(), this));
+        pending_task_timestamps.insert(std::make_pair(task.get(), this));
     }
 
     /**
@@ -342,11 +342,13 @@ namespace wrench {
      * @param src_location: the source location
      * @param service: service requesting file read
      * @param task: a task associated to  this file read (or nullptr)
+     * @param counter: a correlation handle (-1 if none)
      */
     SimulationTimestampFileRead::SimulationTimestampFileRead(double date, std::shared_ptr<DataFile> file,
                                                              std::shared_ptr<FileLocation> src_location,
                                                              std::shared_ptr<StorageService> service,
-                                                             std::shared_ptr<WorkflowTask> task) : file(std::move(file)), source(std::move(src_location)), service(std::move(std::move(service))), task(std::move(task)) {
+                                                             std::shared_ptr<WorkflowTask> task,
+                                                             int counter) : file(std::move(file)), source(std::move(src_location)), service(std::move(std::move(service))), task(std::move(task)), counter(counter) {
         this->date = date;
     }
 
@@ -391,22 +393,36 @@ namespace wrench {
     }
 
     /**
-     * @brief A static unordered multimap of SimulationTimestampFileReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
+     * @brief A static unordered map of SimulationTimestampFileReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps, indexed by correlation handle
      */
-    std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileRead *, std::shared_ptr<WorkflowTask>>> SimulationTimestampFileRead::pending_file_reads;
+    std::unordered_map<int, SimulationTimestampFileRead *> SimulationTimestampFileRead::pending_file_reads;
 
     /**
      * @brief Sets the endpoint of the calling object (SimulationTimestampFileReadFailure, SimulationTimestampFileReadTerminated, SimulationTimestampFileReadStart) with a SimulationTimestampFileReadStart object
      */
     void SimulationTimestampFileRead::setEndpoints() {
-        // find the SimulationTimestampFileRead object containing the same task
-        auto pending_reads_itr = pending_file_reads.find(FileReadWrite(this->file, this->source, this->service));
+        auto pending_reads_itr = pending_file_reads.end();
+        if (this->counter >= 0) {
+            // find the SimulationTimestampFileReadStart object with the same correlation handle
+            pending_reads_itr = pending_file_reads.find(this->counter);
+        } else {
+            // no correlation handle (only for backward compatibility, since all internal callers pass one): find a
+            // SimulationTimestampFileReadStart object for the same file, location, and service, which takes time linear
+            // in the number of pending start timestamps, and picks an arbitrary one if there are several matching ones
+            for (auto it = pending_file_reads.begin(); it != pending_file_reads.end(); ++it) {
+                if ((it->second->file == this->file) and (it->second->source == this->source) and (it->second->service == this->service)) {
+                    pending_reads_itr = it;
+                    break;
+                }
+            }
+        }
+
         if (pending_reads_itr != pending_file_reads.end()) {
             // set my endpoint to the SimulationTimestampFileReadStart
-            this->endpoint = (*pending_reads_itr).second.first;
+            this->endpoint = (*pending_reads_itr).second;
 
             // set the SimulationTimestampFileReadStart's endpoint to me
-            (*pending_reads_itr).second.first->endpoint = this;
+            (*pending_reads_itr).second->endpoint = this;
 
             // the SimulationTimestampFileReadStart is no longer waiting to be matched with an end timestamp, remove it from the map
             pending_file_reads.erase(pending_reads_itr);
@@ -423,12 +439,14 @@ namespace wrench {
      * @param src: the source location
      * @param service: service requesting file read
      * @param task: a  task associated to  this file read (or nullptr)
+     * @param counter: the correlation handle to be passed to the matching end timestamp
      */
     SimulationTimestampFileReadStart::SimulationTimestampFileReadStart(double date,
                                                                        std::shared_ptr<DataFile> file,
                                                                        std::shared_ptr<FileLocation> src,
                                                                        std::shared_ptr<StorageService> service,
-                                                                       std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileRead(date, std::move(file), std::move(src), std::move(service), std::move(task)) {
+                                                                       std::shared_ptr<WorkflowTask> task,
+                                                                       int counter) : SimulationTimestampFileRead(date, std::move(file), std::move(src), std::move(service), std::move(task), counter) {
         WRENCH_DEBUG("Inserting a FileReadStart timestamp for file read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -440,7 +458,7 @@ namespace wrench {
 #endif
 
 
-        pending_file_reads.insert(std::make_pair(FileReadWrite(this->file, this->source, this->service), std::make_pair(this, this->task)));
+        pending_file_reads.insert(std::make_pair(this->counter, this));
     }
 
     /**
@@ -450,11 +468,13 @@ namespace wrench {
      * @param src: the source location
      * @param service: service requesting file read
      * @param task: a workflow task associated to this file read
+     * @param counter: the correlation handle of the matching start timestamp (-1 if none, in which case the start timestamp is found based on the file, location, and service)
      */
     SimulationTimestampFileReadFailure::SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file,
                                                                            const std::shared_ptr<FileLocation> &src,
                                                                            const std::shared_ptr<StorageService> &service,
-                                                                           std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
+                                                                           std::shared_ptr<WorkflowTask> task,
+                                                                           int counter) : SimulationTimestampFileRead(date, file, src, service, std::move(task), counter) {
         WRENCH_DEBUG("Inserting a FileReadFailure timestamp for file read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -475,11 +495,13 @@ namespace wrench {
      * @param src: the source location
      * @param service: service requesting file read
      * @param task: a task associated to  this file read (or nullptr)
+     * @param counter: the correlation handle of the matching start timestamp (-1 if none, in which case the start timestamp is found based on the file, location, and service)
      */
     SimulationTimestampFileReadCompletion::SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file,
                                                                                  const std::shared_ptr<FileLocation> &src,
                                                                                  const std::shared_ptr<StorageService> &service,
-                                                                                 std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
+                                                                                 std::shared_ptr<WorkflowTask> task,
+                                                                                 int counter) : SimulationTimestampFileRead(date, file, src, service, std::move(task), counter) {
         WRENCH_DEBUG("Inserting a FileReadCompletion timestamp for file read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -500,12 +522,14 @@ namespace wrench {
      * @param dst_location: the destination location
      * @param service: service requesting file write
      * @param task: a task associated to  this file read (or nullptr)
+     * @param counter: a correlation handle (-1 if none)
      */
     SimulationTimestampFileWrite::SimulationTimestampFileWrite(double date,
                                                                std::shared_ptr<DataFile> file,
                                                                std::shared_ptr<FileLocation> dst_location,
                                                                std::shared_ptr<StorageService> service,
-                                                               std::shared_ptr<WorkflowTask> task) : file(std::move(file)), destination(std::move(dst_location)), service(std::move(service)), task(std::move(task)) {
+                                                               std::shared_ptr<WorkflowTask> task,
+                                                               int counter) : file(std::move(file)), destination(std::move(dst_location)), service(std::move(service)), task(std::move(task)), counter(counter) {
         this->date = date;
     }
 
@@ -550,22 +574,36 @@ namespace wrench {
     }
 
     /**
-     * @brief A static unordered multimap of SimulationTimestampFileWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
+     * @brief A static unordered map of SimulationTimestampFileWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps, indexed by correlation handle
      */
-    std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileWrite *, std::shared_ptr<WorkflowTask>>> SimulationTimestampFileWrite::pending_file_writes;
+    std::unordered_map<int, SimulationTimestampFileWrite *> SimulationTimestampFileWrite::pending_file_writes;
 
     /**
      * @brief Sets the endpoint of the calling object (SimulationTimestampFileWriteFailure, SimulationTimestampFileWriteTerminated, SimulationTimestampFileWriteStart) with a SimulationTimestampFileWriteStart object
      */
     void SimulationTimestampFileWrite::setEndpoints() {
-        // find the SimulationTimestampFileWrite object containing the same task
-        auto pending_writes_itr = pending_file_writes.find(FileReadWrite(this->file, this->destination, this->service));
+        auto pending_writes_itr = pending_file_writes.end();
+        if (this->counter >= 0) {
+            // find the SimulationTimestampFileWriteStart object with the same correlation handle
+            pending_writes_itr = pending_file_writes.find(this->counter);
+        } else {
+            // no correlation handle (only for backward compatibility, since all internal callers pass one): find a
+            // SimulationTimestampFileWriteStart object for the same file, location, and service, which takes time linear
+            // in the number of pending start timestamps, and picks an arbitrary one if there are several matching ones
+            for (auto it = pending_file_writes.begin(); it != pending_file_writes.end(); ++it) {
+                if ((it->second->file == this->file) and (it->second->destination == this->destination) and (it->second->service == this->service)) {
+                    pending_writes_itr = it;
+                    break;
+                }
+            }
+        }
+
         if (pending_writes_itr != pending_file_writes.end()) {
             // set my endpoint to the SimulationTimestampFileWriteStart
-            this->endpoint = (*pending_writes_itr).second.first;
+            this->endpoint = (*pending_writes_itr).second;
 
             // set the SimulationTimestampFileWriteStart's endpoint to me
-            (*pending_writes_itr).second.first->endpoint = this;
+            (*pending_writes_itr).second->endpoint = this;
 
             // the SimulationTimestampFileWriteStart is no longer waiting to be matched with an end timestamp, remove it from the map
             pending_file_writes.erase(pending_writes_itr);
@@ -582,15 +620,18 @@ namespace wrench {
      * @param dst: the destination location
      * @param service: service requesting file write
      * @param task: a  task associated to  this file read (or nullptr)
+     * @param counter: the correlation handle to be passed to the matching end timestamp
      */
     SimulationTimestampFileWriteStart::SimulationTimestampFileWriteStart(double date, std::shared_ptr<DataFile> file,
                                                                          std::shared_ptr<FileLocation> dst,
                                                                          std::shared_ptr<StorageService> service,
-                                                                         std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileWrite(date,
-                                                                                                                                            std::move(file),
-                                                                                                                                            std::move(dst),
-                                                                                                                                            std::move(service),
-                                                                                                                                            std::move(task)) {
+                                                                         std::shared_ptr<WorkflowTask> task,
+                                                                         int counter) : SimulationTimestampFileWrite(date,
+                                                                                                                     std::move(file),
+                                                                                                                     std::move(dst),
+                                                                                                                     std::move(service),
+                                                                                                                     std::move(task),
+                                                                                                                     counter) {
         WRENCH_DEBUG("Inserting a FileWriteStart timestamp for file write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -602,7 +643,7 @@ namespace wrench {
 #endif
 
 
-        pending_file_writes.insert(std::make_pair(FileReadWrite(this->file, this->destination, this->service), std::make_pair(this, this->task)));
+        pending_file_writes.insert(std::make_pair(this->counter, this));
     }
 
     /**
@@ -612,11 +653,13 @@ namespace wrench {
      * @param dst: the destination location
      * @param service: service requesting file write
      * @param task: the workflow task
+     * @param counter: the correlation handle of the matching start timestamp (-1 if none, in which case the start timestamp is found based on the file, location, and service)
      */
     SimulationTimestampFileWriteFailure::SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file,
                                                                              const std::shared_ptr<FileLocation> &dst,
                                                                              const std::shared_ptr<StorageService> &service,
-                                                                             std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
+                                                                             std::shared_ptr<WorkflowTask> task,
+                                                                             int counter) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task), counter) {
         WRENCH_DEBUG("Inserting a FileWriteFailure timestamp for file write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -637,11 +680,13 @@ namespace wrench {
      * @param dst: the destination location
      * @param service: service requesting file write
      * @param task: a workfow task associated to this file write
+     * @param counter: the correlation handle of the matching start timestamp (-1 if none, in which case the start timestamp is found based on the file, location, and service)
      */
     SimulationTimestampFileWriteCompletion::SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file,
                                                                                    const std::shared_ptr<FileLocation> &dst,
                                                                                    const std::shared_ptr<StorageService> &service,
-                                                                                   std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
+                                                                                   std::shared_ptr<WorkflowTask> task,
+                                                                                   int counter) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task), counter) {
         WRENCH_DEBUG("Inserting a FileWriteCompletion timestamp for file write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -712,16 +757,16 @@ namespace wrench {
     }
 
     /**
-     * @brief A static unordered multimap of SimulationTimestampDiskReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
+     * @brief A static unordered map of SimulationTimestampDiskReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps, indexed by counter
      */
-    std::unordered_multimap<DiskAccess, SimulationTimestampDiskRead *> SimulationTimestampDiskRead::pending_disk_reads;
+    std::unordered_map<int, SimulationTimestampDiskRead *> SimulationTimestampDiskRead::pending_disk_reads;
 
     /**
      * @brief Sets the endpoint of the calling object (SimulationTimestampDiskReadFailure, SimulationTimestampDiskReadTerminated, SimulationTimestampDiskReadStart) with a SimulationTimestampDiskReadStart object
      */
     void SimulationTimestampDiskRead::setEndpoints() {
-        // find the SimulationTimestampDiskRead object containing the same task
-        auto pending_disk_reads_itr = pending_disk_reads.find(DiskAccess(this->hostname, this->mount, this->counter));
+        // find the SimulationTimestampDiskReadStart object with the same counter (which is unique)
+        auto pending_disk_reads_itr = pending_disk_reads.find(this->counter);
         if (pending_disk_reads_itr != pending_disk_reads.end()) {
             // set my endpoint to the SimulationTimestampDiskReadStart
             this->endpoint = (*pending_disk_reads_itr).second;
@@ -760,7 +805,7 @@ namespace wrench {
 #endif
 
 
-        pending_disk_reads.insert(std::make_pair(DiskAccess(this->hostname, this->mount, this->counter), this));
+        pending_disk_reads.insert(std::make_pair(this->counter, this));
     }
 
     /**
@@ -870,16 +915,16 @@ namespace wrench {
     }
 
     /**
-     * @brief A static unordered multimap of SimulationTimestampDiskWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
+     * @brief A static unordered map of SimulationTimestampDiskWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps, indexed by counter
      */
-    std::unordered_multimap<DiskAccess, SimulationTimestampDiskWrite *> SimulationTimestampDiskWrite::pending_disk_writes;
+    std::unordered_map<int, SimulationTimestampDiskWrite *> SimulationTimestampDiskWrite::pending_disk_writes;
 
     /**
      * @brief Sets the endpoint of the calling object (SimulationTimestampDiskWriteFailure, SimulationTimestampDiskWriteTerminated, SimulationTimestampDiskWriteStart) with a SimulationTimestampDiskWriteStart object
      */
     void SimulationTimestampDiskWrite::setEndpoints() {
-        // find the SimulationTimestampDiskWrite object containing the same task
-        auto pending_disk_writes_itr = pending_disk_writes.find(DiskAccess(this->hostname, this->mount, this->counter));
+        // find the SimulationTimestampDiskWriteStart object with the same counter (which is unique)
+        auto pending_disk_writes_itr = pending_disk_writes.find(this->counter);
         if (pending_disk_writes_itr != pending_disk_writes.end()) {
             // set my endpoint to the SimulationTimestampDiskWriteStart
             this->endpoint = (*pending_disk_writes_itr).second;
@@ -918,7 +963,7 @@ namespace wrench {
         }
 #endif
 
-        pending_disk_writes.insert(std::make_pair(DiskAccess(this->hostname, this->mount, this->counter), this));
+        pending_disk_writes.insert(std::make_pair(this->counter, this));
     }
 
     /**
@@ -7,6 +7,8 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
+#include <climits>
 #include <vector>
 #include <wrench/workflow/DagOfTasks.h>
 #include <wrench/logging/TerminalOutput.h>
@@ -22,6 +24,7 @@ namespace wrench {
  * @param task: the task
  */
     void wrench::DagOfTasks::addVertex(const wrench::WorkflowTask *task) {
+        this->unfreeze();
         // Add a new vertex
         VertexProperties p = {task};
         boost::add_vertex(p, this->dag);
@@ -29,6 +32,9 @@ namespace wrench {
         this->task_list.push_back(task);
         // Set the task's vertex id in the task map
         this->task_map[task] = this->task_list.size() - 1;
+        // A new vertex has no edge, and can thus go at the end of the topological order
+        this->topological_order.push_back(this->next_topological_position++);
+        this->visit_marks.push_back(0);
     }
 
     /**
@@ -40,6 +46,7 @@ namespace wrench {
         if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
             throw std::invalid_argument("wrench::DagOfTasks::removeVertex(): Trying to remove a non-existing vertex");
         }
+        this->unfreeze();
         // Remove the corresponding task list item
         this->task_list.erase(this->task_list.begin() + this->task_map[task]);
         // Update subsequent task's vertex indices
@@ -52,6 +59,10 @@ namespace wrench {
 
         // Remove the vertex
         boost::remove_vertex(this->task_map[task], this->dag);
+
+        // Subsequent vertex indices were shifted down by one (removing a vertex never invalidates the topological order)
+        this->topological_order.erase(this->topological_order.begin() + (long) this->task_map[task]);
+        this->visit_marks.erase(this->visit_marks.begin() + (long) this->task_map[task]);
     }
 
 
@@ -69,6 +80,12 @@ namespace wrench {
         if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
             throw std::invalid_argument("wrench::DagOfTasks::removeVertex(): Trying to add an edge to a non-existing vertex");
         }
+        this->unfreeze();
+
+        // Update the topological order if need be (this throws if the edge would create a cycle)
+        if (this->topological_order_is_valid) {
+            this->reorder(this->task_map[src], this->task_map[dst]);
+        }
 
         // Add the edge
         boost::add_edge(this->task_map[src], this->task_map[dst], this->dag);
@@ -87,6 +104,7 @@ namespace wrench {
         if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
             throw std::invalid_argument("wrench::DagOfTasks::removeEdge(): Trying add an edge to a non-existing vertex");
         }
+        this->unfreeze();
 
         // Remove the edge
         boost::remove_edge(this->task_map[src], this->task_map[dst], this->dag);
@@ -112,19 +130,16 @@ namespace wrench {
         auto src_vertex = this->task_map[src];
         auto dst_vertex = this->task_map[dst];
 
-        auto indexmap = boost::get(boost::vertex_index, dag);
-        auto colormap = boost::make_vector_property_map<boost::default_color_type>(indexmap);
-
-        using vertex_descriptor = boost::graph_traits<DAG>::vertex_descriptor;
-        boost::queue<vertex_descriptor> Q;
-        custom_bfs_visitor vis(dst);
+        if (not this->topological_order_is_valid) {
+            return this->search(src_vertex, dst_vertex, true, ULONG_MAX, nullptr);
+        }
 
-        try {
-            boost::breadth_first_visit(dag, src_vertex, Q, vis, colormap);
-        } catch (std::runtime_error &) {
-            return true;
+        // A path can only go forward in the topological order, and
+        // cannot go through vertices that come after its destination
+        if (this->topological_order[src_vertex] > this->topological_order[dst_vertex]) {
+            return false;
         }
-        return false;
+        return this->search(src_vertex, dst_vertex, true, this->topological_order[dst_vertex], nullptr);
     }
 
     /**
@@ -161,12 +176,10 @@ namespace wrench {
             throw std::invalid_argument("wrench::DagOfTasks::getNumberOfChildren(): Non-existing vertex");
         }
         auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
-        long count = 0;
-        for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
-            count++;
+        if (this->frozen) {
+            return (long) (this->child_offsets[vertex + 1] - this->child_offsets[vertex]);
         }
-        return count;
+        return (long) boost::out_degree(vertex, this->dag);
     }
 
     /**
@@ -180,8 +193,15 @@ namespace wrench {
             throw std::invalid_argument("wrench::DagOfTasks::getChildren(): Non-existing vertex");
         }
         auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
         std::vector<WorkflowTask *> children;
+        if (this->frozen) {
+            children.reserve(this->child_offsets[vertex + 1] - this->child_offsets[vertex]);
+            for (auto i = this->child_offsets[vertex]; i < this->child_offsets[vertex + 1]; i++) {
+                children.push_back(this->child_tasks[i].get());
+            }
+            return children;
+        }
+        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
         for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
             // Discard the const qualifier
             children.push_back(const_cast<WorkflowTask*>(dag[target(*eo, dag)].task));
@@ -200,12 +220,10 @@ namespace wrench {
             throw std::invalid_argument("wrench::DagOfTasks::getNumberOfParents(): Non-existing vertex");
         }
         auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
-        long count = 0;
-        for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
-            count++;
+        if (this->frozen) {
+            return (long) (this->parent_offsets[vertex + 1] - this->parent_offsets[vertex]);
         }
-        return count;
+        return (long) boost::in_degree(vertex, this->dag);
     }
 
     /**
@@ -219,8 +237,15 @@ namespace wrench {
             throw std::invalid_argument("wrench::DagOfTasks::getParents(): Non-existing vertex");
         }
         auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
         std::vector<WorkflowTask *> parents;
+        if (this->frozen) {
+            parents.reserve(this->parent_offsets[vertex + 1] - this->parent_offsets[vertex]);
+            for (auto i = this->parent_offsets[vertex]; i < this->parent_offsets[vertex + 1]; i++) {
+                parents.push_back(this->parent_tasks[i].get());
+            }
+            return parents;
+        }
+        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
         for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
             // Discard the const qualifier
             parents.push_back(const_cast<WorkflowTask*>(dag[source(*ei, dag)].task));
@@ -228,4 +253,292 @@ namespace wrench {
         return parents;
     }
 
-}// namespace wrench
\ No newline at end of file
+    /**
+     * @brief Method to get the children of a task vertex without copying them (the DAG is frozen if need be)
+     * @param task: the task
+     * @return the children (a span that is invalidated by any modification of the DAG)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> wrench::DagOfTasks::getChildrenSpan(const WorkflowTask *task) {
+        // Find the vertex
+        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
+            throw std::invalid_argument("wrench::DagOfTasks::getChildrenSpan(): Non-existing vertex");
+        }
+        this->freeze();
+        auto vertex = this->task_map[task];
+        return {this->child_tasks.data() + this->child_offsets[vertex],
+                this->child_offsets[vertex + 1] - this->child_offsets[vertex]};
+    }
+
+    /**
+     * @brief Method to get the parents of a task vertex without copying them (the DAG is frozen if need be)
+     * @param task: the task
+     * @return the parents (a span that is invalidated by any modification of the DAG)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> wrench::DagOfTasks::getParentsSpan(const WorkflowTask *task) {
+        // Find the vertex
+        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
+            throw std::invalid_argument("wrench::DagOfTasks::getParentsSpan(): Non-existing vertex");
+        }
+        this->freeze();
+        auto vertex = this->task_map[task];
+        return {this->parent_tasks.data() + this->parent_offsets[vertex],
+                this->parent_offsets[vertex + 1] - this->parent_offsets[vertex]};
+    }
+
+    /**
+     * @brief Build the frozen, compressed-sparse-row, representation of the DAG (does nothing
+     *        if it is already built). Once frozen, the DAG answers all parent/child queries from contiguous
+     *        arrays, until it is modified.
+     */
+    void wrench::DagOfTasks::freeze() {
+        if (this->frozen) {
+            return;
+        }
+        auto num_vertices = this->task_list.size();
+        auto num_edges = boost::num_edges(this->dag);
+
+        this->child_offsets.assign(num_vertices + 1, 0);
+        this->parent_offsets.assign(num_vertices + 1, 0);
+        this->child_tasks.clear();
+        this->child_tasks.reserve(num_edges);
+        this->parent_tasks.clear();
+        this->parent_tasks.reserve(num_edges);
+
+        for (vertex_t v = 0; v < num_vertices; v++) {
+            boost::graph_traits<DAG>::out_edge_iterator eo, out_edge_end;
+            for (boost::tie(eo, out_edge_end) = boost::out_edges(v, this->dag); eo != out_edge_end; ++eo) {
+                // Discard the const qualifier
+                this->child_tasks.push_back(const_cast<WorkflowTask *>(this->dag[boost::target(*eo, this->dag)].task)->getSharedPtr());
+            }
+            this->child_offsets[v + 1] = this->child_tasks.size();
+
+            boost::graph_traits<DAG>::in_edge_iterator ei, in_edge_end;
+            for (boost::tie(ei, in_edge_end) = boost::in_edges(v, this->dag); ei != in_edge_end; ++ei) {
+                // Discard the const qualifier
+                this->parent_tasks.push_back(const_cast<WorkflowTask *>(this->dag[boost::source(*ei, this->dag)].task)->getSharedPtr());
+            }
+            this->parent_offsets[v + 1] = this->parent_tasks.size();
+        }
+        this->frozen = true;
+    }
+
+    /**
+     * @brief Drop the frozen representation of the DAG (does nothing if the DAG is not frozen)
+     */
+    void wrench::DagOfTasks::unfreeze() {
+        if (not this->frozen) {
+            return;
+        }
+        this->frozen = false;
+        this->child_offsets.clear();
+        this->child_tasks.clear();
+        this->parent_offsets.clear();
+        this->parent_tasks.clear();
+    }
+
+    /**
+     * @brief Determine whether the DAG is frozen
+     * @return true or false
+     */
+    bool wrench::DagOfTasks::isFrozen() const {
+        return this->frozen;
+    }
+
+    /**
+     * @brief Invalidate the topological order of the DAG, so that it is no longer maintained
+     *        as edges are added (which makes adding edges cheaper, but no longer detects cycles,
+     *        and makes doesPathExist() more expensive). It can be recomputed with computeTopologicalOrder().
+     */
+    void wrench::DagOfTasks::invalidateTopologicalOrder() {
+        this->topological_order_is_valid = false;
+    }
+
+    /**
+     * @brief Recompute the topological order of the DAG from scratch (in linear time), so that
+     *        it is maintained incrementally again as edges are added
+     * @return true if the graph is acyclic, false otherwise (in which case the
+     *         topological order remains invalid)
+     */
+    bool wrench::DagOfTasks::computeTopologicalOrder() {
+        auto num_vertices = this->task_list.size();
+
+        std::vector<vertex_t> sorted;
+        if (not this->sortTopologically(sorted)) {
+            return false;
+        }
+
+        for (unsigned long i = 0; i < num_vertices; i++) {
+            this->topological_order[sorted[i]] = i;
+        }
+        this->next_topological_position = num_vertices;
+        this->topological_order_is_valid = true;
+        return true;
+    }
+
+    /**
+     * @brief Get all tasks in a topological order (computed from scratch, in linear time)
+     * @return a vector of tasks
+     *
+     * @throw std::runtime_error if the graph has a cycle
+     */
+    std::vector<WorkflowTask *> wrench::DagOfTasks::getTasksInTopologicalOrder() {
+        std::vector<vertex_t> sorted;
+        if (not this->sortTopologically(sorted)) {
+            throw std::runtime_error("wrench::DagOfTasks::getTasksInTopologicalOrder(): The graph has a cycle");
+        }
+        std::vector<WorkflowTask *> tasks;
+        tasks.reserve(sorted.size());
+        for (auto const &v: sorted) {
+            // Discard the const qualifier
+            tasks.push_back(const_cast<WorkflowTask *>(this->task_list[v]));
+        }
+        return tasks;
+    }
+
+    /**
+     * @brief Helper method to sort all vertices topologically (Kahn's algorithm)
+     * @param sorted: the vector to fill with sorted vertices
+     * @return true if the graph is acyclic (in which case all vertices were sorted), false otherwise
+     */
+    bool wrench::DagOfTasks::sortTopologically(std::vector<vertex_t> &sorted) {
+        auto num_vertices = this->task_list.size();
+
+        std::vector<unsigned long> num_remaining_parents(num_vertices);
+        sorted.clear();
+        sorted.reserve(num_vertices);
+        for (vertex_t v = 0; v < num_vertices; v++) {
+            num_remaining_parents[v] = boost::in_degree(v, this->dag);
+            if (num_remaining_parents[v] == 0) {
+                sorted.push_back(v);
+            }
+        }
+        for (unsigned long i = 0; i < sorted.size(); i++) {
+            boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
+            for (boost::tie(eo, edge_end) = boost::out_edges(sorted[i], this->dag); eo != edge_end; ++eo) {
+                auto child = boost::target(*eo, this->dag);
+                if (--num_remaining_parents[child] == 0) {
+                    sorted.push_back(child);
+                }
+            }
+        }
+        return sorted.size() == num_vertices;
+    }
+
+    /**
+     * @brief Determine whether the topological order of the DAG is maintained
+     * @return true or false
+     */
+    bool wrench::DagOfTasks::isTopologicalOrderValid() const {
+        return this->topological_order_is_valid;
+    }
+
+    /**
+     * @brief Helper method to search the DAG (depth-first) from a vertex, only going through vertices
+     *        whose topological positions are within a bound
+     * @param from: the vertex from which to search
+     * @param target: the vertex to search for
+     * @param forward: true to follow out-edges (the bound is then an upper bound), false to follow in-edges
+     *        (the bound is then a lower bound)
+     * @param bound: the bound on the topological positions of the vertices to go through (ignored if
+     *        the topological order is not valid)
+     * @param visited: if not nullptr, a vector to which all visited vertices are appended
+     * @return true if the target was found, false otherwise
+     */
+    bool wrench::DagOfTasks::search(vertex_t from, vertex_t target, bool forward, unsigned long bound, std::vector<vertex_t> *visited) {
+        auto epoch = ++this->visit_epoch;
+        this->search_stack.clear();
+        this->search_stack.push_back(from);
+        this->visit_marks[from] = epoch;
+
+        while (not this->search_stack.empty()) {
+            auto v = this->search_stack.back();
+            this->search_stack.pop_back();
+            if (v == target) {
+                return true;
+            }
+            if (visited) {
+                visited->push_back(v);
+            }
+
+            auto visit = [this, epoch, forward, bound](vertex_t w) {
+                if (this->visit_marks[w] == epoch) {
+                    return;
+                }
+                if (this->topological_order_is_valid and
+                    (forward ? (this->topological_order[w] > bound) : (this->topological_order[w] < bound))) {
+                    return;
+                }
+                this->visit_marks[w] = epoch;
+                this->search_stack.push_back(w);
+            };
+
+            if (forward) {
+                boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
+                for (boost::tie(eo, edge_end) = boost::out_edges(v, this->dag); eo != edge_end; ++eo) {
+                    visit(boost::target(*eo, this->dag));
+                }
+            } else {
+                boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
+                for (boost::tie(ei, edge_end) = boost::in_edges(v, this->dag); ei != edge_end; ++ei) {
+                    visit(boost::source(*ei, this->dag));
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Helper method to update the topological order before an edge is added (Pearce-Kelly).
+     *        Only the vertices whose positions are between those of the edge's endpoints are
+     *        visited, and only those that must move are reordered, so that the common case of an edge
+     *        that agrees with the current order costs nothing.
+     * @param src_vertex: the source vertex of the edge
+     * @param dst_vertex: the destination vertex of the edge
+     *
+     * @throw std::runtime_error if the edge would create a cycle
+     */
+    void wrench::DagOfTasks::reorder(vertex_t src_vertex, vertex_t dst_vertex) {
+        auto lower_bound = this->topological_order[dst_vertex];
+        auto upper_bound = this->topological_order[src_vertex];
+        if (lower_bound > upper_bound) {
+            return;
+        }
+
+        // Find the vertices reachable from dst that would now have to come after src
+        std::vector<vertex_t> forward_vertices;
+        if (this->search(dst_vertex, src_vertex, true, upper_bound, &forward_vertices)) {
+            throw std::runtime_error("wrench::DagOfTasks::addEdge(): Adding an edge from " + this->task_list[src_vertex]->getID() +
+                                     " to " + this->task_list[dst_vertex]->getID() + " would create a cycle");
+        }
+        // Find the vertices that reach src and would now have to come before dst
+        std::vector<vertex_t> backward_vertices;
+        this->search(src_vertex, ULONG_MAX, false, lower_bound, &backward_vertices);
+
+        // Reassign the positions of these vertices: backward vertices first, then forward ones,
+        // each in their current relative order
+        auto by_position = [this](vertex_t a, vertex_t b) {
+            return this->topological_order[a] < this->topological_order[b];
+        };
+        std::sort(forward_vertices.begin(), forward_vertices.end(), by_position);
+        std::sort(backward_vertices.begin(), backward_vertices.end(), by_position);
+
+        std::vector<unsigned long> positions;
+        positions.reserve(forward_vertices.size() + backward_vertices.size());
+        for (auto const &v: backward_vertices) {
+            positions.push_back(this->topological_order[v]);
+        }
+        for (auto const &v: forward_vertices) {
+            positions.push_back(this->topological_order[v]);
+        }
+        std::sort(positions.begin(), positions.end());
+
+        unsigned long i = 0;
+        for (auto const &v: backward_vertices) {
+            this->topological_order[v] = positions[i++];
+        }
+        for (auto const &v: forward_vertices) {
+            this->topological_order[v] = positions[i++];
+        }
+    }
+
+}// namespace wrench
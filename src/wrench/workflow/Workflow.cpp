@@ -7,6 +7,8 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
+
 #include <wrench/workflow/WorkflowTask.h>
 #include <wrench/simulation/Simulation.h>
 #include <wrench/logging/TerminalOutput.h>
@@ -21,7 +23,17 @@ namespace wrench {
      *         by these tasks
      */
     void Workflow::clear() {
+        this->dag.unfreeze();
         this->tasks.clear();
+        this->tasks_sorted_by_id.clear();
+        this->tasks_sorted_by_id_are_stale = false;
+        this->entry_tasks.clear();
+        this->exit_tasks.clear();
+        this->top_level_buckets.clear();
+        this->bottom_level_buckets.clear();
+        this->ready_tasks.clear();
+        this->ready_tasks_by_cluster.clear();
+        this->cluster_members.clear();
         //        for (auto const &f: this->data_files) {
         //            //            std::cerr << "SIMULATION REMOVING FILE " << f->getID() << "\n";
         //            Simulation::removeFile(f);
@@ -58,9 +70,9 @@ namespace wrench {
         // Create the WorkflowTask object
         auto task = std::shared_ptr<WorkflowTask>(new WorkflowTask(id, flops, min_num_cores, max_num_cores,
                                                                    memory_requirement));
-        this->ready_tasks.insert(task);
         // Associate the workflow to the task
         task->workflow = this;
+        this->addReadyTask(task);
 
         task->toplevel = 0;// upon creation, a task is an exit task
 
@@ -68,6 +80,17 @@ namespace wrench {
         this->dag.addVertex(task.get());
 
         tasks[task->id] = task;// owner
+        this->tasks_sorted_by_id_are_stale = true;
+
+        // Upon creation, a task is both an entry and an exit task, at top and bottom level 0
+        this->entry_tasks[task->id] = task;
+        this->exit_tasks[task->id] = task;
+        if (this->top_level_buckets.empty()) {
+            this->top_level_buckets.resize(1);
+            this->bottom_level_buckets.resize(1);
+        }
+        this->top_level_buckets[0][task->id] = task;
+        this->bottom_level_buckets[0][task->id] = task;
 
         return task;
     }
@@ -78,17 +101,18 @@ namespace wrench {
      *
      */
     void Workflow::removeFile(const std::shared_ptr<DataFile> &file) {
-        if (this->task_output_files.find(file) != this->task_output_files.end()) {
+        auto output_it = this->task_output_files.find(file);
+        if (output_it != this->task_output_files.end()) {
             throw std::invalid_argument("Workflow::removeFile(): File " +
                                         file->getID() + " cannot be removed because it is output of task " +
-                                        this->task_output_files[file]->getID());
+                                        output_it->second->getID());
         }
 
-        if (this->task_input_files.find(file) != this->task_input_files.end() and
-            (not this->task_input_files[file].empty())) {
+        auto input_it = this->task_input_files.find(file);
+        if ((input_it != this->task_input_files.end()) and (not input_it->second.empty())) {
             throw std::invalid_argument("Workflow::removeFile(): File " +
                                         file->getID() + " cannot be removed because it is input to " +
-                                        std::to_string(this->task_input_files[file].size()) + " tasks");
+                                        std::to_string(input_it->second.size()) + " tasks");
         }
 
         this->task_output_files.erase(file);
@@ -113,16 +137,24 @@ namespace wrench {
             throw std::invalid_argument("Workflow::removeTask(): Task '" + task->id + "' does not exist");
         }
 
-        // Remove the task from the ready tasks, just in case
-        if (this->ready_tasks.find(task) != this->ready_tasks.end()) {
-            this->ready_tasks.erase(task);
+        // Remove the task from the ready tasks, just in case, and from its cluster
+        this->removeReadyTask(task);
+        if (not task->cluster_id.empty()) {
+            auto cluster = this->cluster_members.find(task->cluster_id);
+            cluster->second.erase(task->id);
+            if (cluster->second.empty()) {
+                this->cluster_members.erase(cluster);
+            }
         }
 
         // Fix all files
         for (auto &f: task->getInputFiles()) {
-            this->task_input_files[f].erase(task);
-            if (this->task_input_files[f].empty()) {
-                this->task_input_files.erase(f);
+            auto it = this->task_input_files.find(f);
+            if (it != this->task_input_files.end()) {
+                it->second.erase(task);
+                if (it->second.empty()) {
+                    this->task_input_files.erase(it);
+                }
             }
         }
         for (auto &f: task->getOutputFiles()) {
@@ -136,26 +168,49 @@ namespace wrench {
         // Get the parents
         auto parents = this->dag.getParents(task.get());
 
+        // The task no longer counts as an incomplete parent of its children
+        if (task->getState() != WorkflowTask::State::COMPLETED) {
+            for (auto const &child: children) {
+                child->num_incomplete_parents--;
+            }
+        }
+
         // Remove the task from the DAG
         this->dag.removeVertex(task.get());
 
-        // Remove the task from the master list
-        tasks.erase(tasks.find(task->id));
+        // Remove the task from the master list and the indices
+        tasks.erase(task->id);
+        this->tasks_sorted_by_id.clear();// so as not to keep the task alive
+        this->tasks_sorted_by_id_are_stale = true;
+        this->entry_tasks.erase(task->id);
+        this->exit_tasks.erase(task->id);
+        this->top_level_buckets[task->toplevel].erase(task->id);
+        this->bottom_level_buckets[task->bottomlevel].erase(task->id);
+        while ((not this->top_level_buckets.empty()) and this->top_level_buckets.back().empty()) {
+            this->top_level_buckets.pop_back();
+        }
+        while ((not this->bottom_level_buckets.empty()) and this->bottom_level_buckets.back().empty()) {
+            this->bottom_level_buckets.pop_back();
+        }
+        for (auto const &child: children) {
+            this->updateEntryExitStatus(child);
+        }
+        for (auto const &parent: parents) {
+            this->updateEntryExitStatus(parent);
+        }
 
         // Make the children ready, if the case
         for (auto const &child: children) {
             Workflow::updateReadiness(child);
         }
 
-        // Brute-force update of the top-level of all the children and the bottom-level
-        // of the parents of the removed task (if we're doing it dynamically)
-        if (this->update_top_bottom_levels_dynamically) {
-            for (auto const &child: children) {
-                child->updateTopLevel();
-            }
-            for (auto const &parent: parents) {
-                parent->updateBottomLevel();
-            }
+        // Update the top-level of all the children and the bottom-level
+        // of the parents of the removed task
+        for (auto const &child: children) {
+            this->topBottomLevelsNeedUpdate(nullptr, child);
+        }
+        for (auto const &parent: parents) {
+            this->topBottomLevelsNeedUpdate(parent, nullptr);
         }
     }
 
@@ -168,10 +223,11 @@ namespace wrench {
      *
      */
     std::shared_ptr<WorkflowTask> Workflow::getTaskByID(const std::string &id) {
-        if (tasks.find(id) == tasks.end()) {
+        auto it = this->tasks.find(id);
+        if (it == this->tasks.end()) {
             throw std::invalid_argument("Workflow::getTaskByID(): Unknown WorkflowTask ID " + id);
         }
-        return tasks[id];
+        return it->second;
     }
 
     /**
@@ -192,19 +248,23 @@ namespace wrench {
             return;
         }
 
-        if (this->dag.doesPathExist(dst.get(), src.get())) {
+        // In bulk mode, cycles are only detected once bulk mode is disabled
+        if ((not this->bulk_dependency_addition) and this->dag.doesPathExist(dst.get(), src.get())) {
             throw std::runtime_error("Workflow::addControlDependency(): Adding dependency between task " + src->getID() +
                                      " and " + dst->getID() + " would create a cycle in the workflow graph");
         }
 
-        if (redundant_dependencies || not this->dag.doesPathExist(src.get(), dst.get())) {
+        if (redundant_dependencies ? (not this->dag.doesEdgeExist(src.get(), dst.get()))
+                                   : (not this->dag.doesPathExist(src.get(), dst.get()))) {
             WRENCH_DEBUG("Adding control dependency %s-->%s", src->getID().c_str(), dst->getID().c_str());
             this->dag.addEdge(src.get(), dst.get());
-
-            if (this->update_top_bottom_levels_dynamically) {
-                dst->updateTopLevel();
-                src->updateBottomLevel();
+            if (src->getState() != WorkflowTask::State::COMPLETED) {
+                dst->num_incomplete_parents++;
             }
+            this->exit_tasks.erase(src->id);
+            this->entry_tasks.erase(dst->id);
+
+            this->topBottomLevelsNeedUpdate(src.get(), dst.get());
 
             if (src->getState() != WorkflowTask::State::COMPLETED) {
                 dst->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
@@ -225,7 +285,8 @@ namespace wrench {
 
         /*  Check that the two tasks don't have a data dependency; if so, just return */
         for (auto const &f: dst->getInputFiles()) {
-            if (this->task_output_files[f] == src) {
+            auto it = this->task_output_files.find(f);
+            if ((it != this->task_output_files.end()) and (it->second == src)) {
                 return;
             }
         }
@@ -233,11 +294,13 @@ namespace wrench {
         /* If there is an edge between the two tasks, remove it */
         if (this->dag.doesEdgeExist(src.get(), dst.get())) {
             this->dag.removeEdge(src.get(), dst.get());
-
-            if (this->update_top_bottom_levels_dynamically) {
-                dst->updateTopLevel();
-                src->updateBottomLevel();
+            if (src->getState() != WorkflowTask::State::COMPLETED) {
+                dst->num_incomplete_parents--;
             }
+            this->updateEntryExitStatus(src.get());
+            this->updateEntryExitStatus(dst.get());
+
+            this->topBottomLevelsNeedUpdate(src.get(), dst.get());
 
             /* Update state */
             Workflow::updateReadiness(dst.get());
@@ -250,14 +313,7 @@ namespace wrench {
      */
     void Workflow::updateReadiness(WorkflowTask *task) {
         if ((task->getState() == WorkflowTask::State::NOT_READY) and (task->getInternalState() == WorkflowTask::InternalState::TASK_NOT_READY)) {
-            bool ready = true;
-            for (auto const &p: task->getParents()) {
-                if (p->getState() != WorkflowTask::State::COMPLETED) {
-                    ready = false;
-                    break;
-                }
-            }
-            if (ready) {
+            if (task->num_incomplete_parents == 0) {
                 task->setInternalState(WorkflowTask::InternalState::TASK_READY);
                 task->setState(WorkflowTask::State::READY);
             }
@@ -312,38 +368,102 @@ namespace wrench {
         return vector_of_ready_tasks;
     }
 
+    /**
+     * @brief Get the set of ready tasks, without copying it. The returned reference
+     *        stays valid, and reflects task state changes, for the lifetime of the workflow.
+     *
+     * @return a set of tasks
+     */
+    const std::set<std::shared_ptr<WorkflowTask>> &Workflow::getReadyTaskSet() const {
+        return this->ready_tasks;
+    }
+
     /**
      * @brief Get a map of clusters composed of ready tasks
      *
      * @return map of workflow cluster tasks
      */
     std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> Workflow::getReadyClusters() const {
-        // TODO: Implement this more efficiently
-
         std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> task_map;
 
-        for (auto &it: this->tasks) {
-            std::shared_ptr<WorkflowTask> task = it.second;
+        for (auto const &ready_cluster: this->ready_tasks_by_cluster) {
+            auto const &first_ready_task = ready_cluster.second.begin()->second;
+            if (first_ready_task->getClusterID().empty()) {
+                task_map[ready_cluster.first] = {first_ready_task};
+                continue;
+            }
+            // A cluster comprises all its tasks, from its first ready task (in name order) on
+            auto const &members = this->cluster_members.at(ready_cluster.first);
+            auto &cluster = task_map[ready_cluster.first];
+            for (auto it = members.find(first_ready_task->getID()); it != members.end(); ++it) {
+                cluster.push_back(it->second);
+            }
+        }
+        return task_map;
+    }
 
-            if (task->getState() == WorkflowTask::State::READY) {
-                if (task->getClusterID().empty()) {
-                    task_map[task->getID()] = {task};
+    /**
+     * @brief Get the ready tasks, grouped by cluster ID (a ready task that does not belong
+     *        to a cluster is in its own group, keyed by the task's ID). The returned reference
+     *        stays valid, and reflects task state changes, for the lifetime of the workflow.
+     *
+     * @return a map of maps of tasks, indexed by cluster ID and by task ID
+     */
+    const std::map<std::string, std::map<std::string, std::shared_ptr<WorkflowTask>>> &Workflow::getReadyTasksByCluster() const {
+        return this->ready_tasks_by_cluster;
+    }
 
-                } else {
-                    if (task_map.find(task->getClusterID()) == task_map.end()) {
-                        task_map[task->getClusterID()] = {task};
-                    } else {
-                        // add to clustered task
-                        task_map[task->getClusterID()].push_back(task);
-                    }
-                }
-            } else {
-                if (task_map.find(task->getClusterID()) != task_map.end()) {
-                    task_map[task->getClusterID()].push_back(task);
-                }
+    /**
+     * @brief Helper method to add a task to the set of ready tasks
+     * @param task: a task
+     */
+    void Workflow::addReadyTask(const std::shared_ptr<WorkflowTask> &task) {
+        if (this->ready_tasks.insert(task).second) {
+            auto const &key = task->cluster_id.empty() ? task->id : task->cluster_id;
+            this->ready_tasks_by_cluster[key][task->id] = task;
+        }
+    }
+
+    /**
+     * @brief Helper method to remove a task from the set of ready tasks (if it is in it)
+     * @param task: a task
+     */
+    void Workflow::removeReadyTask(const std::shared_ptr<WorkflowTask> &task) {
+        if (this->ready_tasks.erase(task)) {
+            auto const &key = task->cluster_id.empty() ? task->id : task->cluster_id;
+            auto cluster = this->ready_tasks_by_cluster.find(key);
+            cluster->second.erase(task->id);
+            if (cluster->second.empty()) {
+                this->ready_tasks_by_cluster.erase(cluster);
             }
         }
-        return task_map;
+    }
+
+    /**
+     * @brief Helper method to change the cluster ID of a task, moving the task between clusters
+     * @param task: a task
+     * @param cluster_id: the new cluster ID (empty if none)
+     */
+    void Workflow::setTaskClusterID(WorkflowTask *task, const std::string &cluster_id) {
+        auto shared_task = task->getSharedPtr();
+        bool is_ready = (this->ready_tasks.find(shared_task) != this->ready_tasks.end());
+        if (is_ready) {
+            this->removeReadyTask(shared_task);
+        }
+        if (not task->cluster_id.empty()) {
+            auto cluster = this->cluster_members.find(task->cluster_id);
+            cluster->second.erase(task->id);
+            if (cluster->second.empty()) {
+                this->cluster_members.erase(cluster);
+            }
+        }
+        task->cluster_id = cluster_id;
+        if (not cluster_id.empty()) {
+            this->cluster_members[cluster_id][task->id] = shared_task;
+        }
+        if (is_ready) {
+            this->addReadyTask(shared_task);
+        }
     }
 
     /**
@@ -367,20 +487,51 @@ namespace wrench {
      * @return a copy of themap of tasks, indexed by ID
      */
     std::map<std::string, std::shared_ptr<WorkflowTask>> Workflow::getTaskMap() {
+        std::map<std::string, std::shared_ptr<WorkflowTask>> task_map;
+        for (auto const &t: this->getTasksSortedByID()) {
+            task_map.emplace_hint(task_map.end(), t->getID(), t);
+        }
+        return task_map;
+    }
+
+    /**
+     * @brief Get the hash map of all tasks in the workflow, for lookups by ID
+     *        (its iteration order is unspecified)
+     *
+     * @return a reference to the map of tasks, indexed by ID (invalidated when tasks are added or removed)
+     */
+    const std::unordered_map<std::string, std::shared_ptr<WorkflowTask>> &Workflow::getTaskIndex() const {
         return this->tasks;
     }
 
+    /**
+     * @brief Get the list of all tasks in the workflow, sorted by ID
+     *
+     * @return a reference to a vector of tasks (invalidated when tasks are added or removed)
+     */
+    const std::vector<std::shared_ptr<WorkflowTask>> &Workflow::getTasksSortedByID() const {
+        if (this->tasks_sorted_by_id_are_stale) {
+            this->tasks_sorted_by_id.clear();
+            this->tasks_sorted_by_id.reserve(this->tasks.size());
+            for (auto const &t: this->tasks) {
+                this->tasks_sorted_by_id.push_back(t.second);
+            }
+            std::sort(this->tasks_sorted_by_id.begin(), this->tasks_sorted_by_id.end(),
+                      [](const std::shared_ptr<WorkflowTask> &lhs, const std::shared_ptr<WorkflowTask> &rhs) {
+                          return lhs->getID() < rhs->getID();
+                      });
+            this->tasks_sorted_by_id_are_stale = false;
+        }
+        return this->tasks_sorted_by_id;
+    }
+
     /**
      * @brief Get the list of all tasks in the workflow
      *
-     * @return a vector of tasks
+     * @return a vector of tasks, sorted by ID
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasks() const {
-        std::vector<std::shared_ptr<WorkflowTask>> all_tasks;
-        for (auto const &t: this->tasks) {
-            all_tasks.push_back(t.second);
-        }
-        return all_tasks;
+        return this->getTasksSortedByID();
     }
 
     /**
@@ -452,6 +603,36 @@ namespace wrench {
         return this->dag.getNumberOfParents(task.get());
     }
 
+    /**
+     * @brief Get the parents of a task without copying them. The first call after the workflow
+     *        has been modified builds a compact representation of the workflow graph (in linear time), from which
+     *        all subsequent parent/child queries are answered until the next modification.
+     *
+     * @param task: a workflow task
+     *
+     * @return a span of tasks (invalidated by any modification of the workflow graph)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> Workflow::getTaskParentsSpan(const std::shared_ptr<WorkflowTask> &task) {
+        if (task == nullptr) {
+            throw std::invalid_argument("Workflow::getTaskParentsSpan(): Invalid arguments");
+        }
+        return this->dag.getParentsSpan(task.get());
+    }
+
+    /**
+     * @brief Get the children of a task without copying them (see getTaskParentsSpan())
+     *
+     * @param task: a workflow task
+     *
+     * @return a span of tasks (invalidated by any modification of the workflow graph)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> Workflow::getTaskChildrenSpan(const std::shared_ptr<WorkflowTask> &task) {
+        if (task == nullptr) {
+            throw std::invalid_argument("Workflow::getTaskChildrenSpan(): Invalid arguments");
+        }
+        return this->dag.getChildrenSpan(task.get());
+    }
+
     /**
      * @brief Retrieve the list of the input files of the workflow (i.e., those files
      *        that are input to some tasks but output from none)
@@ -562,13 +743,8 @@ namespace wrench {
      * @return a vector of tasks
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInTopLevelRange(int min, int max) const {
-        std::vector<std::shared_ptr<WorkflowTask>> to_return;
-        for (auto const &task: this->getTasks()) {
-            if ((task->getTopLevel() >= min) and (task->getTopLevel() <= max)) {
-                to_return.push_back(task);
-            }
-        }
-        return to_return;
+        this->refreshStaleTopBottomLevels();
+        return Workflow::getTasksInLevelBuckets(this->top_level_buckets, min, max);
     }
 
     /**
@@ -578,11 +754,33 @@ namespace wrench {
      * @return a vector of tasks
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInBottomLevelRange(int min, int max) const {
+        this->refreshStaleTopBottomLevels();
+        return Workflow::getTasksInLevelBuckets(this->bottom_level_buckets, min, max);
+    }
+
+    /**
+     * @brief Helper method to get all tasks in a range of level buckets
+     * @param buckets: the level buckets
+     * @param min: the low end of the range (inclusive)
+     * @param max: the high end of the range (inclusive)
+     * @return a vector of tasks, sorted by ID
+     */
+    std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInLevelBuckets(const std::vector<std::map<std::string, std::shared_ptr<WorkflowTask>>> &buckets,
+                                                                                int min, int max) {
         std::vector<std::shared_ptr<WorkflowTask>> to_return;
-        for (auto const &task: this->getTasks()) {
-            if ((task->getBottomLevel() >= min) and (task->getBottomLevel() <= max)) {
-                to_return.push_back(task);
+        int num_buckets = 0;
+        for (int level = std::max<int>(min, 0); (level <= max) and (level < (int) buckets.size()); level++) {
+            for (auto const &t: buckets[level]) {
+                to_return.push_back(t.second);
             }
+            num_buckets++;
+        }
+        // Each bucket is sorted by ID, so only a multi-bucket range needs sorting
+        if (num_buckets > 1) {
+            std::sort(to_return.begin(), to_return.end(),
+                      [](const std::shared_ptr<WorkflowTask> &t1, const std::shared_ptr<WorkflowTask> &t2) {
+                          return t1->getID() < t2->getID();
+                      });
         }
         return to_return;
     }
@@ -593,15 +791,7 @@ namespace wrench {
      * @return A map of tasks indexed by their IDs
      */
     std::map<std::string, std::shared_ptr<WorkflowTask>> Workflow::getEntryTaskMap() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::map<std::string, std::shared_ptr<WorkflowTask>> entry_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfParents() == 0) {
-                entry_tasks[task->getID()] = task;
-            }
-        }
-        return entry_tasks;
+        return this->entry_tasks;
     }
 
     /**
@@ -610,15 +800,12 @@ namespace wrench {
      * @return A vector of tasks
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getEntryTasks() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::vector<std::shared_ptr<WorkflowTask>> entry_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfParents() == 0) {
-                entry_tasks.push_back(task);
-            }
+        std::vector<std::shared_ptr<WorkflowTask>> to_return;
+        to_return.reserve(this->entry_tasks.size());
+        for (auto const &t: this->entry_tasks) {
+            to_return.push_back(t.second);
         }
-        return entry_tasks;
+        return to_return;
     }
 
     /**
@@ -627,15 +814,7 @@ namespace wrench {
      * @return A map of tasks indexed by their IDs
      */
     std::map<std::string, std::shared_ptr<WorkflowTask>> Workflow::getExitTaskMap() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::map<std::string, std::shared_ptr<WorkflowTask>> exit_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfChildren() == 0) {
-                exit_tasks[task->getID()] = task;
-            }
-        }
-        return exit_tasks;
+        return this->exit_tasks;
     }
 
     /**
@@ -644,15 +823,12 @@ namespace wrench {
     * @return A vector of tasks
     */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getExitTasks() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::vector<std::shared_ptr<WorkflowTask>> exit_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfChildren() == 0) {
-                exit_tasks.push_back(task);
-            }
+        std::vector<std::shared_ptr<WorkflowTask>> to_return;
+        to_return.reserve(this->exit_tasks.size());
+        for (auto const &t: this->exit_tasks) {
+            to_return.push_back(t.second);
         }
-        return exit_tasks;
+        return to_return;
     }
 
     /**
@@ -660,16 +836,9 @@ namespace wrench {
      * @return the number of levels
      */
     unsigned long Workflow::getNumLevels() const {
-        int max_top_level = 0;
-        for (auto const &t: this->tasks) {
-            auto task = t.second.get();
-            if (task->getNumberOfChildren() == 0) {
-                if (1 + task->getTopLevel() > max_top_level) {
-                    max_top_level = 1 + task->getTopLevel();
-                }
-            }
-        }
-        return max_top_level;
+        this->refreshStaleTopBottomLevels();
+        // The last top level bucket is never empty
+        return this->top_level_buckets.size();
     }
 
     /**
@@ -712,10 +881,11 @@ namespace wrench {
      * @return at task (or nullptr)
      */
     std::shared_ptr<WorkflowTask> Workflow::getTaskThatOutputs(const std::shared_ptr<DataFile> &file) {
-        if (this->task_output_files.find(file) == this->task_output_files.end()) {
+        auto it = this->task_output_files.find(file);
+        if (it == this->task_output_files.end()) {
             return nullptr;
         } else {
-            return this->task_output_files[file];
+            return it->second;
         }
     }
 
@@ -734,11 +904,11 @@ namespace wrench {
      * @return a vector of tasks
      */
     std::set<std::shared_ptr<WorkflowTask>> Workflow::getTasksThatInput(const std::shared_ptr<DataFile> &file) {
-        std::set<std::shared_ptr<WorkflowTask>> to_return;
-        if (this->task_input_files.find(file) != this->task_input_files.end()) {
-            to_return = this->task_input_files[file];
+        auto it = this->task_input_files.find(file);
+        if (it == this->task_input_files.end()) {
+            return {};
         }
-        return to_return;
+        return it->second;
     }
 
     /**
@@ -775,41 +945,186 @@ namespace wrench {
         this->update_top_bottom_levels_dynamically = enabled;
     }
 
+    /**
+     * @brief Enable or disable bulk dependency addition, which is useful when adding many control dependencies
+     *        at once (e.g., when loading a workflow). In bulk mode, addControlDependency() does not check
+     *        for cycles and does not update top/bottom levels. Instead, when bulk mode is disabled, the whole
+     *        workflow graph is checked for cycles once (in linear time) and, if dynamic top/bottom level updates
+     *        are enabled, all top/bottom levels are recomputed. Note that eliminating redundant dependencies
+     *        is expensive in bulk mode, so that it is best used with redundant_dependencies set to true.
+     *
+     * @param enabled: true if bulk mode is to be enabled, false otherwise
+     *
+     * @throw std::runtime_error if bulk mode is disabled while the workflow graph has a cycle (in which
+     *        case the workflow remains in bulk mode, so that offending dependencies can be removed)
+     */
+    void Workflow::enableBulkDependencyAddition(bool enabled) {
+        if (enabled == this->bulk_dependency_addition) {
+            return;
+        }
+        if (enabled) {
+            this->dag.invalidateTopologicalOrder();
+            this->bulk_dependency_addition = true;
+            return;
+        }
+        if (not this->dag.computeTopologicalOrder()) {
+            throw std::runtime_error("Workflow::enableBulkDependencyAddition(): The workflow graph has a cycle");
+        }
+        this->bulk_dependency_addition = false;
+        if (this->update_top_bottom_levels_dynamically) {
+            this->updateAllTopBottomLevels();
+        }
+    }
+
+    /**
+     * @brief Enable lazy top/bottom level updates. When enabled, workflow modifications do not update top/bottom
+     *        levels, but only mark them as stale, and all top/bottom levels are recomputed (in linear time) upon the
+     *        first subsequent top/bottom level query. This is useful when the workflow is modified many times
+     *        between queries (e.g., when loading a workflow), and takes precedence over dynamic updates.
+     * @param enabled: true if lazy updates are to be enabled, false otherwise (in which case stale top/bottom
+     *        levels are recomputed right away)
+     */
+    void Workflow::enableTopBottomLevelLazyUpdates(bool enabled) {
+        this->update_top_bottom_levels_lazily = enabled;
+        if ((not enabled) and this->top_bottom_levels_are_stale) {
+            this->updateAllTopBottomLevels();
+        }
+    }
+
+    /**
+     * @brief Helper method to update top/bottom levels (or to mark them as stale) after the workflow graph
+     *        has been modified
+     * @param src: a task whose bottom level may have changed (or nullptr if none)
+     * @param dst: a task whose top level may have changed (or nullptr if none)
+     */
+    void Workflow::topBottomLevelsNeedUpdate(WorkflowTask *src, WorkflowTask *dst) {
+        if (this->update_top_bottom_levels_lazily) {
+            this->top_bottom_levels_are_stale = true;
+            return;
+        }
+        if ((not this->update_top_bottom_levels_dynamically) or this->bulk_dependency_addition) {
+            return;
+        }
+        if (dst) {
+            dst->updateTopLevel();
+        }
+        if (src) {
+            src->updateBottomLevel();
+        }
+    }
+
     /**
      * @brief Update the top level of all tasks (in case dynamic top level updates
      * had been disabled)
      */
     void Workflow::updateAllTopBottomLevels() {
+        auto sorted_tasks = this->dag.getTasksInTopologicalOrder();
 
-        // Compute entry tasks
-        std::vector<std::shared_ptr<WorkflowTask>> entry_tasks;
-        for (auto const &t: this->tasks) {
-            if (t.second->getNumberOfParents() == 0) {
-                entry_tasks.push_back(t.second);
-            }
+        for (auto const &task: sorted_tasks) {
+            task->toplevel = 0;
+            task->bottomlevel = 0;
         }
-        // Compute exit tasks
-        std::vector<std::shared_ptr<WorkflowTask>> exit_tasks;
-        for (auto const &t: this->tasks) {
-            if (t.second->getNumberOfChildren() == 0) {
-                exit_tasks.push_back(t.second);
-            }
+
+        // Top levels, going down the topological order
+        for (auto const &task: sorted_tasks) {
+            auto toplevel = task->toplevel;
+            this->dag.forEachChild(task, [toplevel](WorkflowTask *child) {
+                child->toplevel = std::max<int>(child->toplevel, 1 + toplevel);
+            });
         }
 
-        // Reset all levels to -1 for memoization purposes
-        for (auto const &t: this->tasks) {
-            t.second->toplevel = -1;
-            t.second->bottomlevel = -1;
+        // Bottom levels, going up the topological order
+        for (auto it = sorted_tasks.rbegin(); it != sorted_tasks.rend(); ++it) {
+            auto task = *it;
+            this->dag.forEachChild(task, [task](WorkflowTask *child) {
+                task->bottomlevel = std::max<int>(task->bottomlevel, 1 + child->bottomlevel);
+            });
         }
 
-        // Update top levels recursively
-        for (auto const &et: exit_tasks) {
-            et->computeTopLevel();
+        this->rebuildLevelBuckets();
+        this->top_bottom_levels_are_stale = false;
+    }
+
+    /**
+     * @brief Helper method to recompute stale top/bottom levels (see enableTopBottomLevelLazyUpdates())
+     */
+    void Workflow::refreshStaleTopBottomLevels() const {
+        if (this->top_bottom_levels_are_stale) {
+            // Top/bottom levels are a cache, which can be refreshed even through a const workflow
+            const_cast<Workflow *>(this)->updateAllTopBottomLevels();
         }
+    }
 
-        // Update bottom levels recursively
-        for (auto const &et: entry_tasks) {
-            et->computeBottomLevel();
+    /**
+     * @brief Helper method to set the top level of a task, keeping the top level buckets up to date
+     * @param task: a task of the workflow
+     * @param level: the task's new top level
+     */
+    void Workflow::setTaskTopLevel(WorkflowTask *task, int level) {
+        if (level == task->toplevel) {
+            return;
+        }
+        auto node = this->top_level_buckets[task->toplevel].extract(task->id);
+        task->toplevel = level;
+        if ((int) this->top_level_buckets.size() <= level) {
+            this->top_level_buckets.resize(level + 1);
+        }
+        this->top_level_buckets[level].insert(std::move(node));
+        while (this->top_level_buckets.back().empty()) {
+            this->top_level_buckets.pop_back();
+        }
+    }
+
+    /**
+     * @brief Helper method to set the bottom level of a task, keeping the bottom level buckets up to date
+     * @param task: a task of the workflow
+     * @param level: the task's new bottom level
+     */
+    void Workflow::setTaskBottomLevel(WorkflowTask *task, int level) {
+        if (level == task->bottomlevel) {
+            return;
+        }
+        auto node = this->bottom_level_buckets[task->bottomlevel].extract(task->id);
+        task->bottomlevel = level;
+        if ((int) this->bottom_level_buckets.size() <= level) {
+            this->bottom_level_buckets.resize(level + 1);
+        }
+        this->bottom_level_buckets[level].insert(std::move(node));
+        while (this->bottom_level_buckets.back().empty()) {
+            this->bottom_level_buckets.pop_back();
+        }
+    }
+
+    /**
+     * @brief Helper method to rebuild the top/bottom level buckets from scratch
+     */
+    void Workflow::rebuildLevelBuckets() {
+        this->top_level_buckets.clear();
+        this->bottom_level_buckets.clear();
+        for (auto const &t: this->tasks) {
+            auto task = t.second.get();
+            if ((int) this->top_level_buckets.size() <= task->toplevel) {
+                this->top_level_buckets.resize(task->toplevel + 1);
+            }
+            this->top_level_buckets[task->toplevel][t.first] = t.second;
+            if ((int) this->bottom_level_buckets.size() <= task->bottomlevel) {
+                this->bottom_level_buckets.resize(task->bottomlevel + 1);
+            }
+            this->bottom_level_buckets[task->bottomlevel][t.first] = t.second;
+        }
+    }
+
+    /**
+     * @brief Helper method to update whether a task is an entry and/or an exit task, after
+     *        some of its dependencies have been removed
+     * @param task: a task of the workflow
+     */
+    void Workflow::updateEntryExitStatus(WorkflowTask *task) {
+        if (this->dag.getNumberOfParents(task) == 0) {
+            this->entry_tasks[task->id] = task->getSharedPtr();
+        }
+        if (this->dag.getNumberOfChildren(task) == 0) {
+            this->exit_tasks[task->id] = task->getSharedPtr();
         }
     }
 
@@ -0,0 +1,454 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <wrench/workflow/WorkflowSnapshot.h>
+#include <wrench/workflow/Workflow.h>
+#include <wrench/workflow/WorkflowTask.h>
+#include <wrench/simulation/Simulation.h>
+#include <wrench/logging/TerminalOutput.h>
+
+WRENCH_LOG_CATEGORY(wrench_core_workflow_snapshot, "Log category for WorkflowSnapshot");
+
+namespace wrench {
+
+    /* Byte-order mark, to detect snapshots written on a machine with a different endianness */
+    static constexpr uint32_t SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+
+    /* Parallel model kinds */
+    static constexpr uint8_t SNAPSHOT_CONSTANT_EFFICIENCY_MODEL = 0;
+    static constexpr uint8_t SNAPSHOT_AMDAHL_MODEL = 1;
+
+    /**
+     * @brief A helper class to serialize values into a byte buffer
+     */
+    class SnapshotWriter {
+    public:
+        /**
+         * @brief Append a value
+         * @param value: the value
+         */
+        template<class T>
+        void write(T value) {
+            auto offset = this->buffer.size();
+            this->buffer.resize(offset + sizeof(T));
+            memcpy(this->buffer.data() + offset, &value, sizeof(T));
+        }
+
+        /**
+         * @brief Append a string
+         * @param value: the string
+         */
+        void writeString(const std::string &value) {
+            this->write<uint32_t>((uint32_t) value.size());
+            this->buffer.insert(this->buffer.end(), value.begin(), value.end());
+        }
+
+        /** @brief The bytes written so far */
+        std::vector<char> buffer;
+    };
+
+    /**
+     * @brief A helper class to deserialize values from a byte buffer
+     */
+    class SnapshotReader {
+    public:
+        /**
+         * @brief Constructor
+         * @param data: the bytes to read
+         * @param size: the number of bytes
+         */
+        SnapshotReader(const char *data, size_t size) : data(data), size(size) {}
+
+        /**
+         * @brief Read a value
+         * @return the value
+         */
+        template<class T>
+        T read() {
+            this->check(sizeof(T));
+            T value;
+            memcpy(&value, this->data + this->position, sizeof(T));
+            this->position += sizeof(T);
+            return value;
+        }
+
+        /**
+         * @brief Read a string
+         * @return the string
+         */
+        std::string readString() {
+            auto length = this->read<uint32_t>();
+            this->check(length);
+            std::string value(this->data + this->position, length);
+            this->position += length;
+            return value;
+        }
+
+        /**
+         * @brief Skip bytes
+         * @param num_bytes: the number of bytes to skip
+         */
+        void skip(size_t num_bytes) {
+            this->check(num_bytes);
+            this->position += num_bytes;
+        }
+
+        /**
+         * @brief Read an index
+         * @param bound: the (exclusive) upper bound of the index
+         * @return the index
+         */
+        size_t readIndex(size_t bound) {
+            auto index = this->read<uint64_t>();
+            if (index >= bound) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot (invalid index)");
+            }
+            return (size_t) index;
+        }
+
+    private:
+        void check(size_t num_bytes) const {
+            if (num_bytes > this->size - this->position) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot (truncated)");
+            }
+        }
+
+        const char *data;
+        size_t size;
+        size_t position = 0;
+    };
+
+    /**
+     * @brief A helper class to memory-map a file (read-only) for the lifetime of the object
+     */
+    class SnapshotMapping {
+    public:
+        /**
+         * @brief Constructor
+         * @param file_path: the path of the file
+         */
+        explicit SnapshotMapping(const std::string &file_path) {
+            int fd = ::open(file_path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st {};
+            if ((::fstat(fd, &st) == 0) and (st.st_size > 0)) {
+                void *address = ::mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (address != MAP_FAILED) {
+                    this->data = static_cast<const char *>(address);
+                    this->size = (size_t) st.st_size;
+                }
+            }
+            ::close(fd);
+        }
+
+        ~SnapshotMapping() {
+            if (this->data) {
+                ::munmap(const_cast<char *>(this->data), this->size);
+            }
+        }
+
+        SnapshotMapping(const SnapshotMapping &) = delete;
+        SnapshotMapping &operator=(const SnapshotMapping &) = delete;
+
+        /** @brief The mapped bytes (nullptr if the file could not be mapped) */
+        const char *data = nullptr;
+        /** @brief The number of mapped bytes */
+        size_t size = 0;
+    };
+
+    /**
+     * @brief Save a snapshot of a workflow's structure to a file. Only the files that are input or output
+     *        of tasks are saved. The file is replaced atomically, so that concurrent simulators never see
+     *        a partially written snapshot.
+     *
+     * @param workflow: the workflow
+     * @param snapshot_path: the path of the snapshot file
+     * @param key: the key with which the snapshot is tagged
+     *
+     * @throw std::invalid_argument if the workflow cannot be saved (e.g., it has a task with a custom parallel model)
+     * @throw std::runtime_error if the snapshot file cannot be written
+     */
+    void WorkflowSnapshot::save(const std::shared_ptr<Workflow> &workflow, const std::string &snapshot_path, const std::string &key) {
+        if (workflow == nullptr) {
+            throw std::invalid_argument("WorkflowSnapshot::save(): Invalid arguments");
+        }
+
+        SnapshotWriter writer;
+        writer.buffer.insert(writer.buffer.end(), MAGIC, MAGIC + strlen(MAGIC));
+        writer.write<uint32_t>(FORMAT_VERSION);
+        writer.write<uint32_t>(SNAPSHOT_BYTE_ORDER_MARK);
+        writer.writeString(key);
+
+        auto tasks = workflow->getTasks();
+
+        // Files (those that are input or output of tasks)
+        std::map<std::string, std::shared_ptr<DataFile>> files;
+        for (auto const &task: tasks) {
+            for (auto const &f: task->getInputFiles()) {
+                files[f->getID()] = f;
+            }
+            for (auto const &f: task->getOutputFiles()) {
+                files[f->getID()] = f;
+            }
+        }
+        std::map<std::shared_ptr<DataFile>, uint64_t> file_indices;
+        writer.write<uint64_t>(files.size());
+        for (auto const &item: files) {
+            auto index = file_indices.size();
+            file_indices[item.second] = index;
+            writer.writeString(item.first);
+            writer.write<uint64_t>(item.second->getSize());
+        }
+
+        // Tasks
+        std::map<WorkflowTask *, uint64_t> task_indices;
+        writer.write<uint64_t>(tasks.size());
+        for (auto const &task: tasks) {
+            auto index = task_indices.size();
+            task_indices[task.get()] = index;
+            writer.writeString(task->getID());
+            writer.writeString(task->getClusterID());
+            writer.write<double>(task->getFlops());
+            writer.write<uint64_t>(task->getMinNumCores());
+            writer.write<uint64_t>(task->getMaxNumCores());
+            writer.write<uint64_t>(task->getMemoryRequirement());
+            writer.write<uint64_t>(task->getPriority());
+            writer.write<uint64_t>(task->getBytesRead());
+            writer.write<uint64_t>(task->getBytesWritten());
+            auto model = task->getParallelModel();
+            if (auto amdahl = std::dynamic_pointer_cast<AmdahlParallelModel>(model)) {
+                writer.write<uint8_t>(SNAPSHOT_AMDAHL_MODEL);
+                writer.write<double>(amdahl->getAlpha());
+            } else if (auto constant = std::dynamic_pointer_cast<ConstantEfficiencyParallelModel>(model)) {
+                writer.write<uint8_t>(SNAPSHOT_CONSTANT_EFFICIENCY_MODEL);
+                writer.write<double>(constant->getEfficiency());
+            } else {
+                throw std::invalid_argument("WorkflowSnapshot::save(): Task " + task->getID() +
+                                            " has a custom parallel model, which cannot be saved");
+            }
+            auto input_files = task->getInputFiles();
+            writer.write<uint64_t>(input_files.size());
+            for (auto const &f: input_files) {
+                writer.write<uint64_t>(file_indices.at(f));
+            }
+            auto output_files = task->getOutputFiles();
+            writer.write<uint64_t>(output_files.size());
+            for (auto const &f: output_files) {
+                writer.write<uint64_t>(file_indices.at(f));
+            }
+        }
+
+        // Task dependencies, in CSR form
+        std::vector<uint64_t> child_offsets = {0};
+        std::vector<uint64_t> children;
+        for (auto const &task: tasks) {
+            for (auto const &child: task->getChildrenSpan()) {
+                children.push_back(task_indices.at(child.get()));
+            }
+            child_offsets.push_back(children.size());
+        }
+        writer.write<uint64_t>(children.size());
+        for (auto const &offset: child_offsets) {
+            writer.write<uint64_t>(offset);
+        }
+        for (auto const &child: children) {
+            writer.write<uint64_t>(child);
+        }
+
+        // Write to a temporary file, and rename it
+        auto temp_path = snapshot_path + ".tmp." + std::to_string(::getpid());
+        std::ofstream stream(temp_path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (not stream.is_open()) {
+            throw std::runtime_error("WorkflowSnapshot::save(): cannot open file " + temp_path + " for writing");
+        }
+        stream.write(writer.buffer.data(), (std::streamsize) writer.buffer.size());
+        stream.close();
+        if ((not stream) or (std::rename(temp_path.c_str(), snapshot_path.c_str()) != 0)) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("WorkflowSnapshot::save(): error while writing file " + snapshot_path);
+        }
+        WRENCH_INFO("Saved a snapshot of a workflow with %zu tasks to %s", tasks.size(), snapshot_path.c_str());
+    }
+
+    /**
+     * @brief Load a workflow from a snapshot file. Files that do not already exist in the simulation are created.
+     *
+     * @param snapshot_path: the path of the snapshot file
+     * @param key: the key with which the snapshot should be tagged
+     * @return a workflow, or nullptr if there is no snapshot file, or if it is stale (i.e., it is tagged with
+     *         a different key or was written in a different format)
+     *
+     * @throw std::invalid_argument if the snapshot file is corrupted
+     */
+    std::shared_ptr<Workflow> WorkflowSnapshot::load(const std::string &snapshot_path, const std::string &key) {
+        SnapshotMapping mapping(snapshot_path);
+        if (not mapping.data) {
+            return nullptr;
+        }
+        SnapshotReader reader(mapping.data, mapping.size);
+
+        // Check that the snapshot is in the current format and for the right key
+        auto magic_length = strlen(MAGIC);
+        if ((mapping.size < magic_length) or (strncmp(mapping.data, MAGIC, magic_length) != 0)) {
+            return nullptr;
+        }
+        reader.skip(magic_length);
+        if ((reader.read<uint32_t>() != FORMAT_VERSION) or
+            (reader.read<uint32_t>() != SNAPSHOT_BYTE_ORDER_MARK) or
+            (reader.readString() != key)) {
+            WRENCH_INFO("Ignoring stale workflow snapshot %s", snapshot_path.c_str());
+            return nullptr;
+        }
+
+        // Files
+        auto num_files = reader.read<uint64_t>();
+        std::vector<std::shared_ptr<DataFile>> files;
+        for (uint64_t i = 0; i < num_files; i++) {
+            auto id = reader.readString();
+            auto size = reader.read<uint64_t>();
+            auto file = Simulation::getFileByIDOrNull(id);
+            files.push_back(file ? file : Simulation::addFile(id, size));
+        }
+
+        // Tasks (their files are added once all dependencies have been added, so that files
+        // do not induce dependencies that the original workflow did not have)
+        auto workflow = Workflow::createWorkflow();
+        workflow->enableTopBottomLevelDynamicUpdates(false);
+        auto num_tasks = reader.read<uint64_t>();
+        std::vector<std::shared_ptr<WorkflowTask>> tasks;
+        std::vector<std::vector<size_t>> input_files(num_tasks), output_files(num_tasks);
+        for (uint64_t i = 0; i < num_tasks; i++) {
+            auto id = reader.readString();
+            auto cluster_id = reader.readString();
+            auto flops = reader.read<double>();
+            auto min_num_cores = reader.read<uint64_t>();
+            auto max_num_cores = reader.read<uint64_t>();
+            auto memory_requirement = reader.read<uint64_t>();
+            auto task = workflow->addTask(id, flops, min_num_cores, max_num_cores, memory_requirement);
+            if (not cluster_id.empty()) {
+                task->setClusterID(cluster_id);
+            }
+            task->setPriority(reader.read<uint64_t>());
+            task->setBytesRead(reader.read<uint64_t>());
+            task->setBytesWritten(reader.read<uint64_t>());
+            auto model_kind = reader.read<uint8_t>();
+            auto model_parameter = reader.read<double>();
+            if (model_kind == SNAPSHOT_AMDAHL_MODEL) {
+                task->setParallelModel(ParallelModel::AMDAHL(model_parameter));
+            } else {
+                task->setParallelModel(ParallelModel::CONSTANTEFFICIENCY(model_parameter));
+            }
+            auto num_input_files = reader.read<uint64_t>();
+            for (uint64_t j = 0; j < num_input_files; j++) {
+                input_files[i].push_back(reader.readIndex(files.size()));
+            }
+            auto num_output_files = reader.read<uint64_t>();
+            for (uint64_t j = 0; j < num_output_files; j++) {
+                output_files[i].push_back(reader.readIndex(files.size()));
+            }
+            tasks.push_back(task);
+        }
+
+        // Task dependencies
+        auto num_dependencies = reader.read<uint64_t>();
+        std::vector<uint64_t> child_offsets;
+        for (uint64_t i = 0; i <= num_tasks; i++) {
+            child_offsets.push_back(reader.read<uint64_t>());
+            if ((child_offsets.back() > num_dependencies) or (i and (child_offsets[i] < child_offsets[i - 1]))) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot (invalid offset)");
+            }
+        }
+        workflow->enableBulkDependencyAddition(true);
+        for (uint64_t i = 0; i < num_tasks; i++) {
+            for (uint64_t j = child_offsets[i]; j < child_offsets[i + 1]; j++) {
+                workflow->addControlDependency(tasks[i], tasks[reader.readIndex(tasks.size())], true);
+            }
+        }
+        try {
+            workflow->enableBulkDependencyAddition(false);
+        } catch (std::runtime_error &) {
+            throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot (cyclic task dependencies)");
+        }
+
+        for (uint64_t i = 0; i < num_tasks; i++) {
+            for (auto const &f: input_files[i]) {
+                tasks[i]->addInputFile(files[f]);
+            }
+            for (auto const &f: output_files[i]) {
+                tasks[i]->addOutputFile(files[f]);
+            }
+        }
+
+        workflow->enableTopBottomLevelDynamicUpdates(true);
+        workflow->updateAllTopBottomLevels();
+
+        WRENCH_INFO("Loaded a workflow with %zu tasks from snapshot %s", tasks.size(), snapshot_path.c_str());
+        return workflow;
+    }
+
+    /**
+     * @brief Compute a key that identifies the content of a source file (e.g., a WfCommons JSON file), to tag
+     *        the snapshot of the workflow created from that file
+     *
+     * @param source_path: the path of the source file
+     * @param salt: a string that is hashed along with the file's content (e.g., a description of the options
+     *              with which the workflow was created from the file)
+     * @return a key
+     *
+     * @throw std::invalid_argument if the source file cannot be read
+     */
+    std::string WorkflowSnapshot::computeSourceKey(const std::string &source_path, const std::string &salt) {
+        std::ifstream stream(source_path, std::ios::in | std::ios::binary);
+        if (not stream.is_open()) {
+            throw std::invalid_argument("WorkflowSnapshot::computeSourceKey(): cannot open file " + source_path);
+        }
+
+        // 64-bit FNV-1a hash of the file's content, followed by a 0 byte and the salt
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        auto hash_bytes = [&hash](const char *bytes, size_t num_bytes) {
+            for (size_t i = 0; i < num_bytes; i++) {
+                hash ^= (unsigned char) bytes[i];
+                hash *= 0x100000001b3ULL;
+            }
+        };
+        uint64_t num_bytes = 0;
+        std::vector<char> chunk(1 << 20);
+        while (stream) {
+            stream.read(chunk.data(), (std::streamsize) chunk.size());
+            hash_bytes(chunk.data(), (size_t) stream.gcount());
+            num_bytes += (uint64_t) stream.gcount();
+        }
+        if (stream.bad()) {
+            throw std::invalid_argument("WorkflowSnapshot::computeSourceKey(): error while reading file " + source_path);
+        }
+        hash_bytes("", 1);
+        hash_bytes(salt.c_str(), salt.size());
+
+        std::ostringstream key;
+        key << std::hex << std::setw(16) << std::setfill('0') << hash << "-" << std::dec << num_bytes;
+        return key.str();
+    }
+
+}// namespace wrench
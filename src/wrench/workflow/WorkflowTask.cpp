@@ -13,6 +13,7 @@
 #include <wrench/workflow/Workflow.h>
 #include <wrench/services/compute/cloud/CloudComputeService.h>
 
+#include <deque>
 #include <utility>
 
 WRENCH_LOG_CATEGORY(wrench_core_workflow_task, "Log category for WorkflowTask");
@@ -71,8 +72,9 @@ namespace wrench {
         this->workflow->task_input_files[file].insert(this->getSharedPtr());
 
         // Add control dependency
-        if (this->workflow->task_output_files.find(file) != this->workflow->task_output_files.end()) {
-            workflow->addControlDependency(this->workflow->task_output_files[file], this->getSharedPtr());
+        auto producer = this->workflow->task_output_files.find(file);
+        if (producer != this->workflow->task_output_files.end()) {
+            workflow->addControlDependency(producer->second, this->getSharedPtr());
         }
     }
 
@@ -101,8 +103,11 @@ namespace wrench {
         this->output_files[file->getID()] = file;
         this->workflow->task_output_files[file] = this->getSharedPtr();
 
-        for (auto const &x: this->workflow->getTasksThatInput(file)) {
-            workflow->addControlDependency(this->getSharedPtr(), x);
+        auto consumers = this->workflow->task_input_files.find(file);
+        if (consumers != this->workflow->task_input_files.end()) {
+            for (auto const &x: consumers->second) {
+                workflow->addControlDependency(this->getSharedPtr(), x);
+            }
         }
     }
 
@@ -232,6 +237,44 @@ namespace wrench {
         return this->getWorkflow()->getTaskParents(this->getSharedPtr());
     }
 
+    /**
+     * @brief Get the children of a task without copying them (see Workflow::getTaskParentsSpan())
+     *
+     * @return a span of workflow tasks (invalidated by any modification of the workflow graph)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> WorkflowTask::getChildrenSpan() {
+        return this->workflow->dag.getChildrenSpan(this);
+    }
+
+    /**
+     * @brief Get the parents of a task without copying them (see Workflow::getTaskParentsSpan())
+     *
+     * @return a span of workflow tasks (invalidated by any modification of the workflow graph)
+     */
+    Span<const std::shared_ptr<WorkflowTask>> WorkflowTask::getParentsSpan() {
+        return this->workflow->dag.getParentsSpan(this);
+    }
+
+    /**
+     * @brief Apply a function to each child of a task, without copying the children. Unlike
+     *        getChildrenSpan(), this doesn't build the compact representation of the workflow graph,
+     *        and so remains cheap when the workflow is modified between calls
+     *
+     * @param function: a function that takes a WorkflowTask pointer
+     */
+    void WorkflowTask::forEachChild(const std::function<void(WorkflowTask *)> &function) {
+        this->workflow->dag.forEachChild(this, function);
+    }
+
+    /**
+     * @brief Get the number of parents of a task that are not completed
+     *
+     * @return a number of parents
+     */
+    unsigned long WorkflowTask::getNumberOfIncompleteParents() const {
+        return this->num_incomplete_parents;
+    }
+
     /**
      * @brief Get the state of the task
      *
@@ -340,15 +383,26 @@ namespace wrench {
      */
     void WorkflowTask::setState(WorkflowTask::State state) {
         if (this->visible_state == WorkflowTask::State::READY) {
-            this->workflow->ready_tasks.erase(this->getSharedPtr());
+            this->workflow->removeReadyTask(this->getSharedPtr());
         }
         if (this->visible_state == WorkflowTask::State::READY and state == WorkflowTask::State::NOT_READY) {
             this->ready_date = -1.0;
         }
+        // Keep the children's counts of incomplete parents up to date
+        if ((this->visible_state == WorkflowTask::State::COMPLETED) != (state == WorkflowTask::State::COMPLETED)) {
+            bool completed = (state == WorkflowTask::State::COMPLETED);
+            this->workflow->dag.forEachChild(this, [completed](WorkflowTask *child) {
+                if (completed) {
+                    child->num_incomplete_parents--;
+                } else {
+                    child->num_incomplete_parents++;
+                }
+            });
+        }
         this->visible_state = state;
         if (state == WorkflowTask::State::READY) {
             this->ready_date = Simulation::getCurrentSimulatedDate();
-            this->workflow->ready_tasks.insert(this->getSharedPtr());
+            this->workflow->addReadyTask(this->getSharedPtr());
         }
     }
 
@@ -383,7 +437,11 @@ namespace wrench {
      * @param c_id: cluster c_id the task belongs to
      */
     void WorkflowTask::setClusterID(const std::string &c_id) {
-        this->cluster_id = c_id;
+        if (this->workflow) {
+            this->workflow->setTaskClusterID(this, c_id);
+        } else {
+            this->cluster_id = c_id;
+        }
     }
 
     /**
@@ -725,91 +783,66 @@ namespace wrench {
     }
 
     /**
-     * @brief Update the task's top level (looking only at the parents, and updating children)
+     * @brief Update the task's top level (looking only at the parents), and the top levels of the descendants
+     *        whose top levels change as a result. This is done iteratively, and only the tasks whose top levels change
+     *        have their children revisited.
      * @return the task's updated top level
      */
     unsigned long WorkflowTask::updateTopLevel() {
-        std::vector<std::shared_ptr<WorkflowTask>> parents = this->workflow->getTaskParents(this->getSharedPtr());
-        if (parents.empty()) {
-            this->toplevel = 0;
-        } else {
-            int max_toplevel = 0;
-            for (const auto &parent: parents) {
-                max_toplevel = (max_toplevel < parent->toplevel ? parent->toplevel : max_toplevel);
+        auto dag = &this->workflow->dag;
+        std::deque<WorkflowTask *> to_update = {this};
+        while (not to_update.empty()) {
+            auto task = to_update.front();
+            to_update.pop_front();
+            int toplevel = 0;
+            dag->forEachParent(task, [&toplevel](WorkflowTask *parent) {
+                toplevel = std::max<int>(toplevel, 1 + parent->toplevel);
+            });
+            if ((task == this) or (toplevel != task->toplevel)) {
+                this->workflow->setTaskTopLevel(task, toplevel);
+                dag->forEachChild(task, [&to_update](WorkflowTask *child) {
+                    to_update.push_back(child);
+                });
             }
-            this->toplevel = 1 + max_toplevel;
-        }
-        std::vector<std::shared_ptr<WorkflowTask>> children = this->workflow->getTaskChildren(this->getSharedPtr());
-        for (const auto &child: children) {
-            child->updateTopLevel();
         }
         return this->toplevel;
     }
 
     /**
-     * @brief Update the task's bottom level (looking only at the children, and updating parents)
+     * @brief Update the task's bottom level (looking only at the children), and the bottom levels of the ancestors
+     *        whose bottom levels change as a result (see updateTopLevel())
      * @return the task's updated bottom level
      */
     unsigned long WorkflowTask::updateBottomLevel() {
-        std::vector<std::shared_ptr<WorkflowTask>> children = this->workflow->getTaskChildren(this->getSharedPtr());
-        if (children.empty()) {
-            this->bottomlevel = 0;
-        } else {
-            int max_bottomlevel = 0;
-            for (const auto &child: children) {
-                max_bottomlevel = (max_bottomlevel < child->bottomlevel ? child->bottomlevel : max_bottomlevel);
+        auto dag = &this->workflow->dag;
+        std::deque<WorkflowTask *> to_update = {this};
+        while (not to_update.empty()) {
+            auto task = to_update.front();
+            to_update.pop_front();
+            int bottomlevel = 0;
+            dag->forEachChild(task, [&bottomlevel](WorkflowTask *child) {
+                bottomlevel = std::max<int>(bottomlevel, 1 + child->bottomlevel);
+            });
+            if ((task == this) or (bottomlevel != task->bottomlevel)) {
+                this->workflow->setTaskBottomLevel(task, bottomlevel);
+                dag->forEachParent(task, [&to_update](WorkflowTask *parent) {
+                    to_update.push_back(parent);
+                });
             }
-            this->bottomlevel = 1 + max_bottomlevel;
-        }
-        std::vector<std::shared_ptr<WorkflowTask>> parents = this->workflow->getTaskParents(this->getSharedPtr());
-        for (const auto &parent: parents) {
-            parent->updateBottomLevel();
         }
         return this->bottomlevel;
     }
 
 
-    /**
-     * @brief Update the task's top level recursively (to be used by the updateAllTopBottomLevels method)
-     */
-    void WorkflowTask::computeBottomLevel() {
-
-        this->bottomlevel = 0;
-        // Compute children if needed
-        int max_child_bottom_level = -1;
-        for (const auto &child: this->getChildren()) {
-            if (child->bottomlevel == -1) {
-                child->computeBottomLevel();
-            }
-            max_child_bottom_level = std::max<int>(max_child_bottom_level, child->bottomlevel);
-        }
-        this->bottomlevel = 1 + max_child_bottom_level;
-    }
-
-    /**
-     * @brief Update the task's bottom level recursively (to be used by the updateAllTopBottomLevels method)
-     */
-    void WorkflowTask::computeTopLevel() {
-
-        this->toplevel = 0;
-        // Compute parents if needed
-        int max_parent_top_level = -1;
-        for (const auto &parent: this->getParents()) {
-            if (parent->toplevel == -1) {
-                parent->computeTopLevel();
-            }
-            max_parent_top_level = std::max<int>(max_parent_top_level, parent->toplevel);
-        }
-        this->toplevel = 1 + max_parent_top_level;
-    }
-
-
     /**
  * @brief Returns the task's top level (max number of hops on a reverse path up to an entry task. Entry
  *        tasks have a top-level of 0)
  * @return
  */
     int WorkflowTask::getTopLevel() const {
+        if (this->workflow->top_bottom_levels_are_stale) {
+            this->workflow->updateAllTopBottomLevels();
+        }
         return this->toplevel;
     }
 
@@ -819,6 +852,9 @@ namespace wrench {
  * @return
  */
     int WorkflowTask::getBottomLevel() const {
+        if (this->workflow->top_bottom_levels_are_stale) {
+            this->workflow->updateAllTopBottomLevels();
+        }
         return this->bottomlevel;
     }
 
@@ -922,18 +958,12 @@ namespace wrench {
      */
     void WorkflowTask::updateReadiness() {
         if (this->getState() == WorkflowTask::State::NOT_READY) {
-            for (auto const &parent: this->getParents()) {
-                if (parent->getState() != WorkflowTask::State::COMPLETED) {
-                    return;
-                }
+            if (this->num_incomplete_parents == 0) {
+                this->setState(WorkflowTask::State::READY);
             }
-            this->setState(WorkflowTask::State::READY);
         } else if (this->getState() == WorkflowTask::State::READY) {
-            for (auto const &parent: this->getParents()) {
-                if (parent->getState() != WorkflowTask::State::COMPLETED) {
-                    this->setState(WorkflowTask::State::NOT_READY);
-                    return;
-                }
+            if (this->num_incomplete_parents > 0) {
+                this->setState(WorkflowTask::State::NOT_READY);
             }
         } else {
             // do nothing
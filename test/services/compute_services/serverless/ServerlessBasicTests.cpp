@@ -15,6 +15,7 @@
 #include "../../../include/UniqueTmpPathPrefix.h"
 #include "wrench/failure_causes/OperationTimeout.h"
 #include "wrench/services/compute/serverless/schedulers/RandomServerlessScheduler.h"
+#include "wrench/services/compute/serverless/schedulers/DeadlineAwareServerlessScheduler.h"
 
 #define GFLOP (1000.0 * 1000.0 * 1000.0)
 #define MB (1000000ULL)
@@ -31,6 +32,10 @@ public:
     void do_FunctionInvocationTest_test();
     void do_FunctionTimeoutTest_test();
     void do_FunctionErrorTest_test();
+    void do_FunctionDeadlineTest_test();
+    void do_DeadlineOrderingTest_test(const std::string& scheduler_name);
+    void do_HeadStorageImageEvictionTest_test();
+    void do_SnapshotColdStartTest_test(bool lazy_restore);
 
 protected:
     ~ServerlessBasicTest() override {
@@ -59,6 +64,10 @@ protected:
                 <prop id="size" value="5000GiB"/>
                 <prop id="mount" value="/"/>
             </disk>
+            <disk id="small_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="250MB"/>
+                <prop id="mount" value="/small"/>
+            </disk>
        </host>
         <host id="ServerlessComputeNode1" speed="50Gf" core="10">
             <prop id="ram" value="64GB" />
@@ -555,4 +564,495 @@ void ServerlessBasicTest::do_FunctionErrorTest_test() {
     for (int i = 0; i < argc; i++)
         free(argv[i]);
     free(argv);
-}
\ No newline at end of file
+}
+
+
+/**********************************************************************/
+/**  FUNCTION DEADLINE TEST                                          **/
+/**********************************************************************/
+
+class ServerlessBasicTestFunctionDeadlineController : public wrench::ExecutionController {
+public:
+    ServerlessBasicTestFunctionDeadlineController(ServerlessBasicTest* test,
+                                                  const std::string& hostname,
+                                                  const std::shared_ptr<wrench::ServerlessComputeService>
+                                                  & compute_service,
+                                                  const std::shared_ptr<wrench::StorageService>& storage_service) :
+        wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+        this->compute_service = compute_service;
+        this->storage_service = storage_service;
+    }
+
+private:
+    ServerlessBasicTest* test;
+    std::shared_ptr<wrench::ServerlessComputeService> compute_service;
+    std::shared_ptr<wrench::StorageService> storage_service;
+
+    int main() override {
+        auto function_manager = this->createFunctionManager();
+        std::function lambda = [](const std::shared_ptr<wrench::FunctionInput>& input,
+                                  const std::shared_ptr<wrench::StorageService>& service) -> std::shared_ptr<wrench::FunctionOutput> {
+            wrench::Simulation::sleep(5);
+            return std::make_shared<MyFunctionOutput>("DONE");
+        };
+
+        auto image_file = wrench::Simulation::addFile("image_file", 100 * MB);
+        auto image_location = wrench::FileLocation::LOCATION(this->storage_service, image_file);
+        wrench::StorageService::createFileAtLocation(image_location);
+
+        auto function1 = wrench::FunctionManager::createFunction("Function 1", lambda, image_location);
+        auto registered_function1 = function_manager->registerFunction(function1, this->compute_service, 10, 2000 * MB, 8000 * MB, 10 * MB, 1 * MB);
+
+        auto input = std::make_shared<MyFunctionInput>(1, 2);
+
+        // An invocation without a deadline, one with a deadline that cannot be met (the image
+        // download alone takes longer), and one with a deadline that can be met
+        auto no_deadline = function_manager->invokeFunction(registered_function1, this->compute_service, input);
+        auto tight_deadline = function_manager->invokeFunction(registered_function1, this->compute_service, input, 1.0);
+        auto loose_deadline = function_manager->invokeFunction(registered_function1, this->compute_service, input, 1000.0);
+
+        if (no_deadline->hasDeadline() or (not tight_deadline->hasDeadline()) or (not loose_deadline->hasDeadline())) {
+            throw std::runtime_error("Unexpected invocation deadline status");
+        }
+        if (std::abs(loose_deadline->getDeadline() - (loose_deadline->getSubmitDate() + 1000.0)) > 0.001) {
+            throw std::runtime_error("Unexpected invocation deadline");
+        }
+
+        function_manager->wait_all({no_deadline, tight_deadline, loose_deadline});
+
+        if (no_deadline->hasMissedDeadline() or (not tight_deadline->hasMissedDeadline()) or loose_deadline->hasMissedDeadline()) {
+            throw std::runtime_error("Unexpected missed-deadline status");
+        }
+        if (this->compute_service->getNumCompletedInvocationsWithDeadlineZeroTime() != 2) {
+            throw std::runtime_error("There should be 2 completed invocations with a deadline");
+        }
+        if (this->compute_service->getNumSLOViolationsZeroTime() != 1) {
+            throw std::runtime_error("There should be 1 SLO violation");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ServerlessBasicTest, FunctionDeadline) {
+    DO_TEST_WITH_FORK(do_FunctionDeadlineTest_test);
+}
+
+void ServerlessBasicTest::do_FunctionDeadlineTest_test() {
+    int argc = 1;
+    auto argv = (char**)calloc(argc, sizeof(char*));
+    argv[0] = strdup("unit_test");
+    // argv[1] = strdup("--wrench-full-log");
+
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(this->platform_file_path);
+
+    auto storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(
+        "UserHost", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "50MB"}}, {}));
+
+    std::vector<std::string> batch_nodes = {"ServerlessComputeNode1"};
+    auto serverless_provider = simulation->add(new wrench::ServerlessComputeService(
+        "ServerlessHeadNode", batch_nodes, "/",
+        std::make_shared<wrench::DeadlineAwareServerlessScheduler>(wrench::DeadlineAwareServerlessScheduler::LEAST_SLACK_FIRST),
+        {}, {}));
+
+    std::string user_host = "UserHost";
+    auto wms = simulation->add(
+        new ServerlessBasicTestFunctionDeadlineController(this, user_host, serverless_provider, storage_service));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  DEADLINE ORDERING TEST                                          **/
+/**********************************************************************/
+
+class ServerlessBasicTestDeadlineOrderingController : public wrench::ExecutionController {
+public:
+    ServerlessBasicTestDeadlineOrderingController(ServerlessBasicTest* test,
+                                                  const std::string& hostname,
+                                                  const std::shared_ptr<wrench::ServerlessComputeService>
+                                                  & compute_service,
+                                                  const std::shared_ptr<wrench::StorageService>& storage_service,
+                                                  bool deadline_aware) :
+        wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+        this->compute_service = compute_service;
+        this->storage_service = storage_service;
+        this->deadline_aware = deadline_aware;
+    }
+
+private:
+    ServerlessBasicTest* test;
+    std::shared_ptr<wrench::ServerlessComputeService> compute_service;
+    std::shared_ptr<wrench::StorageService> storage_service;
+    bool deadline_aware;
+
+    int main() override {
+        auto function_manager = this->createFunctionManager();
+
+        auto image_file = wrench::Simulation::addFile("image_file", 100 * MB);
+        auto image_location = wrench::FileLocation::LOCATION(this->storage_service, image_file);
+        wrench::StorageService::createFileAtLocation(image_location);
+
+        // Functions that run for 5, 20, and 200 seconds (all with the same image)
+        std::vector<std::shared_ptr<wrench::RegisteredFunction>> registered_functions;
+        for (double duration : {5.0, 20.0, 200.0}) {
+            std::function lambda = [duration](const std::shared_ptr<wrench::FunctionInput>& input,
+                                              const std::shared_ptr<wrench::StorageService>& service) -> std::shared_ptr<wrench::FunctionOutput> {
+                wrench::Simulation::sleep(duration);
+                return std::make_shared<MyFunctionOutput>("DONE");
+            };
+            auto function = wrench::FunctionManager::createFunction("Function " + std::to_string((int)duration), lambda, image_location);
+            registered_functions.push_back(
+                function_manager->registerFunction(function, this->compute_service, 1000, 10 * MB, 100 * MB, 10 * MB, 1 * MB));
+        }
+        auto short_function = registered_functions.at(0);
+        auto medium_function = registered_functions.at(1);
+        auto long_function = registered_functions.at(2);
+
+        auto input = std::make_shared<MyFunctionInput>(1, 2);
+
+        // A first invocation to get the image into RAM at the compute node, and a second one
+        // to measure the runtime of a "warm" invocation (which is also the runtime estimate)
+        auto cold_invocation = function_manager->invokeFunction(short_function, this->compute_service, input);
+        function_manager->wait_one(cold_invocation);
+        auto warm_invocation = function_manager->invokeFunction(short_function, this->compute_service, input);
+        function_manager->wait_one(warm_invocation);
+        double warm_runtime = warm_invocation->getEndDate() - warm_invocation->getSubmitDate();
+
+        // Occupy 9 of the 10 cores for a long time, and the 10th core for a little while
+        std::vector<std::shared_ptr<wrench::Invocation>> blockers;
+        for (int i = 0; i < 9; i++) {
+            blockers.push_back(function_manager->invokeFunction(long_function, this->compute_service, input));
+        }
+        blockers.push_back(function_manager->invokeFunction(medium_function, this->compute_service, input));
+        wrench::Simulation::sleep(1);
+
+        // Invocations arrive with decreasing deadlines while all cores are busy, and will then
+        // run one at a time on the 10th core. Each deadline can be met only if invocations run in
+        // EDF order, i.e., in reverse arrival order.
+        const int num_invocations = 4;
+        double core_available_date = warm_runtime + 15.0; // upper bound, relative to now
+        std::vector<std::shared_ptr<wrench::Invocation>> invocations;
+        for (int i = 0; i < num_invocations; i++) {
+            double deadline = core_available_date + (num_invocations - i) * warm_runtime + warm_runtime / 2;
+            invocations.push_back(function_manager->invokeFunction(short_function, this->compute_service, input, deadline));
+        }
+
+        function_manager->wait_all(invocations);
+        function_manager->wait_all(blockers);
+
+        for (int i = 1; i < num_invocations; i++) {
+            bool completed_before_previous = invocations.at(i)->getEndDate() < invocations.at(i - 1)->getEndDate();
+            if (this->deadline_aware and (not completed_before_previous)) {
+                throw std::runtime_error("Invocations should complete in reverse arrival order (invocation " +
+                                         std::to_string(i) + " completed at " + std::to_string(invocations.at(i)->getEndDate()) +
+                                         ", invocation " + std::to_string(i - 1) + " completed at " +
+                                         std::to_string(invocations.at(i - 1)->getEndDate()) + ")");
+            }
+            if ((not this->deadline_aware) and completed_before_previous) {
+                throw std::runtime_error("Invocations should complete in arrival order (invocation " +
+                                         std::to_string(i) + " completed at " + std::to_string(invocations.at(i)->getEndDate()) +
+                                         ", invocation " + std::to_string(i - 1) + " completed at " +
+                                         std::to_string(invocations.at(i - 1)->getEndDate()) + ")");
+            }
+        }
+
+        if (this->compute_service->getNumCompletedInvocationsWithDeadlineZeroTime() != num_invocations) {
+            throw std::runtime_error("There should be " + std::to_string(num_invocations) +
+                                     " completed invocations with a deadline");
+        }
+        auto num_slo_violations = this->compute_service->getNumSLOViolationsZeroTime();
+        if (this->deadline_aware and (num_slo_violations != 0)) {
+            throw std::runtime_error("There should be no SLO violation (got " + std::to_string(num_slo_violations) + ")");
+        }
+        if ((not this->deadline_aware) and
+            ((num_slo_violations == 0) or (not invocations.at(num_invocations - 1)->hasMissedDeadline()))) {
+            throw std::runtime_error("The last invocation to arrive should have missed its deadline (got " +
+                                     std::to_string(num_slo_violations) + " SLO violations)");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ServerlessBasicTest, DeadlineOrderingEDF) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_DeadlineOrderingTest_test, "EDF");
+}
+
+TEST_F(ServerlessBasicTest, DeadlineOrderingLSF) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_DeadlineOrderingTest_test, "LSF");
+}
+
+TEST_F(ServerlessBasicTest, DeadlineOrderingFCFS) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_DeadlineOrderingTest_test, "FCFS");
+}
+
+void ServerlessBasicTest::do_DeadlineOrderingTest_test(const std::string& scheduler_name) {
+    int argc = 1;
+    auto argv = (char**)calloc(argc, sizeof(char*));
+    argv[0] = strdup("unit_test");
+    // argv[1] = strdup("--wrench-full-log");
+
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(this->platform_file_path);
+
+    auto storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(
+        "UserHost", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "50MB"}}, {}));
+
+    std::shared_ptr<wrench::ServerlessScheduler> scheduler;
+    if (scheduler_name == "EDF") {
+        scheduler = std::make_shared<wrench::DeadlineAwareServerlessScheduler>(wrench::DeadlineAwareServerlessScheduler::EARLIEST_DEADLINE_FIRST);
+    }
+    else if (scheduler_name == "LSF") {
+        scheduler = std::make_shared<wrench::DeadlineAwareServerlessScheduler>(wrench::DeadlineAwareServerlessScheduler::LEAST_SLACK_FIRST);
+    }
+    else {
+        scheduler = std::make_shared<wrench::FCFSServerlessScheduler>();
+    }
+
+    std::vector<std::string> batch_nodes = {"ServerlessComputeNode1"};
+    auto serverless_provider = simulation->add(new wrench::ServerlessComputeService(
+        "ServerlessHeadNode", batch_nodes, "/", scheduler, {}, {}));
+
+    std::string user_host = "UserHost";
+    auto wms = simulation->add(
+        new ServerlessBasicTestDeadlineOrderingController(this, user_host, serverless_provider, storage_service,
+                                                          scheduler_name != "FCFS"));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  HEAD STORAGE IMAGE EVICTION TEST                                **/
+/**********************************************************************/
+
+class ServerlessBasicTestHeadStorageImageEvictionController : public wrench::ExecutionController {
+public:
+    ServerlessBasicTestHeadStorageImageEvictionController(ServerlessBasicTest* test,
+                                                          const std::string& hostname,
+                                                          const std::shared_ptr<wrench::ServerlessComputeService>
+                                                          & compute_service,
+                                                          const std::shared_ptr<wrench::StorageService>& storage_service) :
+        wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+        this->compute_service = compute_service;
+        this->storage_service = storage_service;
+    }
+
+private:
+    ServerlessBasicTest* test;
+    std::shared_ptr<wrench::ServerlessComputeService> compute_service;
+    std::shared_ptr<wrench::StorageService> storage_service;
+
+    int main() override {
+        auto function_manager = this->createFunctionManager();
+        std::function lambda = [](const std::shared_ptr<wrench::FunctionInput>& input,
+                                  const std::shared_ptr<wrench::StorageService>& service) -> std::shared_ptr<wrench::FunctionOutput> {
+            wrench::Simulation::sleep(5);
+            return std::make_shared<MyFunctionOutput>("DONE");
+        };
+
+        // Three functions with 100MB images, while the head node storage can only hold two images
+        std::vector<std::shared_ptr<wrench::RegisteredFunction>> registered_functions;
+        for (int i = 0; i < 3; i++) {
+            auto image_file = wrench::Simulation::addFile("image_file_" + std::to_string(i), 100 * MB);
+            auto image_location = wrench::FileLocation::LOCATION(this->storage_service, image_file);
+            wrench::StorageService::createFileAtLocation(image_location);
+            auto function = wrench::FunctionManager::createFunction("Function " + std::to_string(i), lambda, image_location);
+            registered_functions.push_back(function_manager->registerFunction(function, this->compute_service, 10, 2000 * MB, 8000 * MB, 10 * MB, 1 * MB));
+        }
+
+        auto input = std::make_shared<MyFunctionInput>(1, 2);
+
+        // Invoke the functions one after the other: the third one can only run if an image is evicted
+        for (const auto& registered_function : registered_functions) {
+            auto invocation = function_manager->invokeFunction(registered_function, this->compute_service, input);
+            function_manager->wait_one(invocation);
+            if (not invocation->hasSucceeded()) {
+                throw std::runtime_error("Invocation should have succeeded");
+            }
+        }
+
+        if (this->compute_service->getNumHeadStorageImageEvictionsZeroTime() != 1) {
+            throw std::runtime_error("There should have been exactly 1 image eviction on the head node (got " +
+                                     std::to_string(this->compute_service->getNumHeadStorageImageEvictionsZeroTime()) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ServerlessBasicTest, HeadStorageImageEviction) {
+    DO_TEST_WITH_FORK(do_HeadStorageImageEvictionTest_test);
+}
+
+void ServerlessBasicTest::do_HeadStorageImageEvictionTest_test() {
+    int argc = 1;
+    auto argv = (char**)calloc(argc, sizeof(char*));
+    argv[0] = strdup("unit_test");
+    // argv[1] = strdup("--wrench-full-log");
+
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(this->platform_file_path);
+
+    auto storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(
+        "UserHost", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "50MB"}}, {}));
+
+    std::vector<std::string> batch_nodes = {"ServerlessComputeNode1"};
+    auto serverless_provider = simulation->add(new wrench::ServerlessComputeService(
+        "ServerlessHeadNode", batch_nodes, "/small",
+        std::make_shared<wrench::RandomServerlessScheduler>(), {}, {}));
+
+    std::string user_host = "UserHost";
+    auto wms = simulation->add(
+        new ServerlessBasicTestHeadStorageImageEvictionController(this, user_host, serverless_provider, storage_service));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  SNAPSHOT COLD START TEST                                        **/
+/**********************************************************************/
+
+class ServerlessBasicTestSnapshotColdStartController : public wrench::ExecutionController {
+public:
+    ServerlessBasicTestSnapshotColdStartController(ServerlessBasicTest* test,
+                                                   const std::string& hostname,
+                                                   const std::shared_ptr<wrench::ServerlessComputeService>
+                                                   & compute_service,
+                                                   const std::shared_ptr<wrench::StorageService>& storage_service,
+                                                   bool lazy_restore) :
+        wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+        this->compute_service = compute_service;
+        this->storage_service = storage_service;
+        this->lazy_restore = lazy_restore;
+    }
+
+private:
+    ServerlessBasicTest* test;
+    std::shared_ptr<wrench::ServerlessComputeService> compute_service;
+    std::shared_ptr<wrench::StorageService> storage_service;
+    bool lazy_restore;
+
+    int main() override {
+        auto function_manager = this->createFunctionManager();
+        std::function lambda = [](const std::shared_ptr<wrench::FunctionInput>& input,
+                                  const std::shared_ptr<wrench::StorageService>& service) -> std::shared_ptr<wrench::FunctionOutput> {
+            wrench::Simulation::sleep(5);
+            return std::make_shared<MyFunctionOutput>("DONE");
+        };
+
+        auto image_file = wrench::Simulation::addFile("image_file", 100 * MB);
+        auto image_location = wrench::FileLocation::LOCATION(this->storage_service, image_file);
+        wrench::StorageService::createFileAtLocation(image_location);
+
+        // A function with a 100MB snapshot (i.e., 1 second to read from the compute node's disk)
+        auto function1 = wrench::FunctionManager::createFunction("Function 1", lambda, image_location, 100 * MB);
+        auto registered_function1 = function_manager->registerFunction(function1, this->compute_service, 100, 2000 * MB, 8000 * MB, 10 * MB, 1 * MB);
+
+        auto input = std::make_shared<MyFunctionInput>(1, 2);
+
+        // The first invocation pays the container startup overhead (and writes the snapshot)
+        auto cold = function_manager->invokeFunction(registered_function1, this->compute_service, input);
+        function_manager->wait_one(cold);
+        // The second invocation restores the snapshot
+        auto restored = function_manager->invokeFunction(registered_function1, this->compute_service, input);
+        function_manager->wait_one(restored);
+
+        if ((not cold->hasSucceeded()) or (not restored->hasSucceeded())) {
+            throw std::runtime_error("Invocations should have succeeded");
+        }
+        if (this->compute_service->getNumSnapshotRestoresZeroTime() != 1) {
+            throw std::runtime_error("There should have been exactly 1 snapshot restore");
+        }
+
+        double cold_duration = cold->getEndDate() - cold->getStartDate();
+        double restored_duration = restored->getEndDate() - restored->getStartDate();
+        double expected_restored_duration = 5 + (this->lazy_restore ? 0.5 : 1.0);
+        if (cold_duration < 10 + 5) {
+            throw std::runtime_error("Unexpected cold start invocation duration: " + std::to_string(cold_duration));
+        }
+        if (std::abs(restored_duration - expected_restored_duration) > 0.2) {
+            throw std::runtime_error("Unexpected restored invocation duration: " + std::to_string(restored_duration) +
+                                     " (expected " + std::to_string(expected_restored_duration) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ServerlessBasicTest, SnapshotColdStart) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_SnapshotColdStartTest_test, false);
+}
+
+TEST_F(ServerlessBasicTest, SnapshotColdStartLazyRestore) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_SnapshotColdStartTest_test, true);
+}
+
+void ServerlessBasicTest::do_SnapshotColdStartTest_test(bool lazy_restore) {
+    int argc = 1;
+    auto argv = (char**)calloc(argc, sizeof(char*));
+    argv[0] = strdup("unit_test");
+    // argv[1] = strdup("--wrench-full-log");
+
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(this->platform_file_path);
+
+    auto storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(
+        "UserHost", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "50MB"}}, {}));
+
+    std::vector<std::string> batch_nodes = {"ServerlessComputeNode1"};
+
+    // Invalid cold start model
+    ASSERT_THROW(new wrench::ServerlessComputeService(
+                     "ServerlessHeadNode", batch_nodes, "/", std::make_shared<wrench::RandomServerlessScheduler>(),
+                     {{wrench::ServerlessComputeServiceProperty::COLD_START_MODEL, "bogus"}}, {}),
+                 std::invalid_argument);
+
+    auto serverless_provider = simulation->add(new wrench::ServerlessComputeService(
+        "ServerlessHeadNode", batch_nodes, "/",
+        std::make_shared<wrench::RandomServerlessScheduler>(),
+        {
+            {wrench::ServerlessComputeServiceProperty::CONTAINER_STARTUP_OVERHEAD, "10"},
+            {wrench::ServerlessComputeServiceProperty::COLD_START_MODEL, "snapshot"},
+            {wrench::ServerlessComputeServiceProperty::SNAPSHOT_LAZY_RESTORE, lazy_restore ? "true" : "false"},
+            {wrench::ServerlessComputeServiceProperty::SNAPSHOT_WORKING_SET_FRACTION, "0.5"},
+        }, {}));
+
+    std::string user_host = "UserHost";
+    auto wms = simulation->add(
+        new ServerlessBasicTestSnapshotColdStartController(this, user_host, serverless_provider, storage_service, lazy_restore));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../../../include/TestWithFork.h"
+#include "../../../include/UniqueTmpPathPrefix.h"
+#include "wrench/services/compute/serverless/schedulers/FCFSServerlessScheduler.h"
+
+#define MB (1000000ULL)
+
+WRENCH_LOG_CATEGORY(serverless_front_end_tests,
+                    "Log category for ServerlessFrontEndTest tests");
+
+class ServerlessFrontEndTest : public ::testing::Test {
+public:
+    void do_FrontEnd_test(wrench::ServerlessFrontEnd::ShardingPolicy policy, double spillover_threshold);
+
+protected:
+    ~ServerlessFrontEndTest() override {
+        wrench::Simulation::removeAllFiles();
+    }
+
+    ServerlessFrontEndTest() {
+        // Create a platform file with two "regions", each with a head node and a compute node
+        std::string xml = R"(<?xml version='1.0'?>
+<!DOCTYPE platform SYSTEM "https://simgrid.org/simgrid.dtd">
+<platform version="4.1">
+    <zone id="AS0" routing="Full">
+
+        <host id="UserHost" speed="10Gf" core="1">
+            <disk id="hard_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="5000GiB"/>
+                <prop id="mount" value="/"/>
+            </disk>
+        </host>
+
+        <host id="HeadNode1" speed="10Gf" core="1">
+            <prop id="ram" value="16GB" />
+            <disk id="hard_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="5000GiB"/>
+                <prop id="mount" value="/"/>
+            </disk>
+        </host>
+        <host id="ComputeNode1" speed="50Gf" core="2">
+            <prop id="ram" value="64GB" />
+            <disk id="hard_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="5000GiB"/>
+                <prop id="mount" value="/"/>
+            </disk>
+        </host>
+
+        <host id="HeadNode2" speed="10Gf" core="1">
+            <prop id="ram" value="16GB" />
+            <disk id="hard_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="5000GiB"/>
+                <prop id="mount" value="/"/>
+            </disk>
+        </host>
+        <host id="ComputeNode2" speed="50Gf" core="2">
+            <prop id="ram" value="64GB" />
+            <disk id="hard_drive" read_bw="100MBps" write_bw="100MBps">
+                <prop id="size" value="5000GiB"/>
+                <prop id="mount" value="/"/>
+            </disk>
+        </host>
+
+        <link id="wide_area" bandwidth="20MBps" latency="20us"/>
+        <link id="local_area" bandwidth="100Gbps" latency="1ns"/>
+
+        <route src="UserHost" dst="HeadNode1"> <link_ctn id="wide_area"/></route>
+        <route src="UserHost" dst="HeadNode2"> <link_ctn id="wide_area"/></route>
+        <route src="UserHost" dst="ComputeNode1"> <link_ctn id="wide_area"/></route>
+        <route src="UserHost" dst="ComputeNode2"> <link_ctn id="wide_area"/></route>
+        <route src="HeadNode1" dst="ComputeNode1"> <link_ctn id="local_area"/></route>
+        <route src="HeadNode2" dst="ComputeNode2"> <link_ctn id="local_area"/></route>
+        <route src="HeadNode1" dst="HeadNode2"> <link_ctn id="wide_area"/></route>
+        <route src="HeadNode1" dst="ComputeNode2"> <link_ctn id="wide_area"/></route>
+        <route src="HeadNode2" dst="ComputeNode1"> <link_ctn id="wide_area"/></route>
+        <route src="ComputeNode1" dst="ComputeNode2"> <link_ctn id="wide_area"/></route>
+
+    </zone>
+</platform>)";
+
+        FILE* platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+};
+
+/**********************************************************************/
+/**  FRONT END TEST                                                  **/
+/**********************************************************************/
+
+class ServerlessFrontEndTestController : public wrench::ExecutionController {
+public:
+    ServerlessFrontEndTestController(ServerlessFrontEndTest* test,
+                                     const std::string& hostname,
+                                     const std::shared_ptr<wrench::ServerlessFrontEnd>& front_end,
+                                     const std::shared_ptr<wrench::StorageService>& storage_service,
+                                     double spillover_threshold) :
+        wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+        this->front_end = front_end;
+        this->storage_service = storage_service;
+        this->spillover_threshold = spillover_threshold;
+    }
+
+private:
+    ServerlessFrontEndTest* test;
+    std::shared_ptr<wrench::ServerlessFrontEnd> front_end;
+    std::shared_ptr<wrench::StorageService> storage_service;
+    double spillover_threshold;
+
+    int main() override {
+        auto function_manager = this->createFunctionManager();
+        std::function lambda = [](const std::shared_ptr<wrench::FunctionInput>& input,
+                                  const std::shared_ptr<wrench::StorageService>& service) -> std::shared_ptr<wrench::FunctionOutput> {
+            wrench::Simulation::sleep(10);
+            return nullptr;
+        };
+
+        auto image_file = wrench::Simulation::addFile("image_file", 100 * MB);
+        auto image_location = wrench::FileLocation::LOCATION(this->storage_service, image_file);
+        wrench::StorageService::createFileAtLocation(image_location);
+
+        auto function1 = wrench::FunctionManager::createFunction("Function 1", lambda, image_location);
+        auto registered_function1 = function_manager->registerFunction(function1, this->front_end, 100, 2000 * MB,
+                                                                       8000 * MB, 10 * MB, 1 * MB);
+
+        // The returned registered function is that of the home shard
+        if (this->front_end->getHomeShard(function1)->getNumOutstandingInvocationsZeroTime() != 0) {
+            throw std::runtime_error("The home shard should not have outstanding invocations yet");
+        }
+
+        std::vector<std::shared_ptr<wrench::Invocation>> invocations;
+        for (int i = 0; i < 8; i++) {
+            invocations.push_back(function_manager->invokeFunction(registered_function1, this->front_end, nullptr));
+        }
+
+        function_manager->wait_all(invocations);
+
+        for (const auto& invocation : invocations) {
+            if (not invocation->hasSucceeded()) {
+                throw std::runtime_error("All invocations should have succeeded");
+            }
+        }
+
+        // Check where invocations went
+        auto per_shard = this->front_end->getNumInvocationsPerShard();
+        unsigned long total = 0;
+        for (const auto& [shard, count] : per_shard) {
+            total += count;
+            if (shard->getNumOutstandingInvocationsZeroTime() != 0) {
+                throw std::runtime_error("No shard should have outstanding invocations");
+            }
+        }
+        if (total != 8) {
+            throw std::runtime_error("The front-end should have sent 8 invocations");
+        }
+
+        switch (this->front_end->getShardingPolicy()) {
+            case wrench::ServerlessFrontEnd::CONSISTENT_HASHING: {
+                auto home_count = per_shard[this->front_end->getHomeShard(function1)];
+                if (this->spillover_threshold > 100.0) {
+                    // No spillover: everything went to the home shard
+                    if ((home_count != 8) or (this->front_end->getNumSpillovers() != 0)) {
+                        throw std::runtime_error("All invocations should have gone to the home shard");
+                    }
+                } else {
+                    // Spillover once the home shard has one outstanding invocation per core
+                    if ((home_count == 8) or (this->front_end->getNumSpillovers() == 0)) {
+                        throw std::runtime_error("Some invocations should have been spilled over");
+                    }
+                }
+                break;
+            }
+            case wrench::ServerlessFrontEnd::LEAST_LOADED: {
+                // Invocations alternate between the two identical shards
+                for (const auto& [shard, count] : per_shard) {
+                    if (count != 4) {
+                        throw std::runtime_error("Each shard should have received 4 invocations (got " +
+                                                 std::to_string(count) + ")");
+                    }
+                }
+                break;
+            }
+            case wrench::ServerlessFrontEnd::POWER_OF_TWO_CHOICES: {
+                // The picks are random, but a shard with one outstanding invocation per core spills
+                // over to the other shard while that one is below the threshold, so each shard gets
+                // at least as many invocations as it has cores
+                for (const auto& [shard, count] : per_shard) {
+                    if ((count < 2) or (count > 6)) {
+                        throw std::runtime_error("Each shard should have received between 2 and 6 invocations (got " +
+                                                 std::to_string(count) + ")");
+                    }
+                }
+                break;
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ServerlessFrontEndTest, ConsistentHashing) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_FrontEnd_test, wrench::ServerlessFrontEnd::CONSISTENT_HASHING, 1000.0);
+}
+
+TEST_F(ServerlessFrontEndTest, ConsistentHashingWithSpillover) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_FrontEnd_test, wrench::ServerlessFrontEnd::CONSISTENT_HASHING, 1.0);
+}
+
+TEST_F(ServerlessFrontEndTest, LeastLoaded) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_FrontEnd_test, wrench::ServerlessFrontEnd::LEAST_LOADED, 1.0);
+}
+
+TEST_F(ServerlessFrontEndTest, PowerOfTwoChoices) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_FrontEnd_test, wrench::ServerlessFrontEnd::POWER_OF_TWO_CHOICES, 1.0);
+}
+
+void ServerlessFrontEndTest::do_FrontEnd_test(wrench::ServerlessFrontEnd::ShardingPolicy policy,
+                                              double spillover_threshold) {
+    int argc = 1;
+    auto argv = (char**)calloc(argc, sizeof(char*));
+    argv[0] = strdup("unit_test");
+    // argv[1] = strdup("--wrench-full-log");
+
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(this->platform_file_path);
+
+    auto storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(
+        "UserHost", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "50MB"}}, {}));
+
+    auto shard1 = simulation->add(new wrench::ServerlessComputeService(
+        "HeadNode1", {"ComputeNode1"}, "/", std::make_shared<wrench::FCFSServerlessScheduler>(), {}, {}));
+    auto shard2 = simulation->add(new wrench::ServerlessComputeService(
+        "HeadNode2", {"ComputeNode2"}, "/", std::make_shared<wrench::FCFSServerlessScheduler>(), {}, {}));
+
+    auto front_end = std::make_shared<wrench::ServerlessFrontEnd>(
+        std::vector<std::shared_ptr<wrench::ServerlessComputeService>>{shard1, shard2}, policy, spillover_threshold);
+
+    ASSERT_THROW(wrench::ServerlessFrontEnd({}, policy), std::invalid_argument);
+
+    std::string user_host = "UserHost";
+    simulation->add(new ServerlessFrontEndTestController(this, user_host, front_end, storage_service, spillover_threshold));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
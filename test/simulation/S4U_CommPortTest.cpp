@@ -23,6 +23,8 @@ public:
     void do_AsynchronousCommunication_test();
     void do_NetworkTimeout_test();
     void do_NullCommPort_test();
+    void do_CommPortPoolGrowth_test();
+    void do_MixedPayloadMessageOrdering_test();
 
 protected:
     S4U_CommPortTest() {
@@ -441,4 +443,175 @@ void S4U_CommPortTest::do_NullCommPort_test() {
     for (int i = 0; i < argc; i++)
         free(argv[i]);
     free(argv);
-}
\ No newline at end of file
+}
+
+/**********************************************************************/
+/**  COMMPORT POOL GROWTH TEST                                       **/
+/**********************************************************************/
+
+class CommPortPoolGrowthTestWMS : public wrench::ExecutionController {
+
+public:
+    CommPortPoolGrowthTestWMS(S4U_CommPortTest *test,
+                              const std::string &hostname) : wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+    S4U_CommPortTest *test;
+
+    int main() override {
+
+        auto initial_pool_size = wrench::S4U_CommPort::getCommPortPoolSize();
+
+        // Use many more commports than there are in the initial pool
+        std::vector<wrench::S4U_CommPort *> commports;
+        for (unsigned long i = 0; i < 5 * initial_pool_size; i++) {
+            commports.push_back(wrench::S4U_CommPort::getTemporaryCommPort());
+        }
+
+        if (wrench::S4U_CommPort::getCommPortPoolSize() < 5 * initial_pool_size) {
+            throw std::runtime_error("The commport pool should have grown");
+        }
+        if (wrench::S4U_CommPort::getNumCommPortPoolGrowths() == 0) {
+            throw std::runtime_error("The number of commport pool growths should be > 0");
+        }
+        if (wrench::S4U_CommPort::getMaxNumUsedCommPorts() < 5 * initial_pool_size) {
+            throw std::runtime_error("Unexpected commport high-water mark");
+        }
+
+        for (auto const &commport: commports) {
+            wrench::S4U_CommPort::retireTemporaryCommPort(commport);
+        }
+
+        // Retired commports are reused, without growing the pool
+        auto pool_size = wrench::S4U_CommPort::getCommPortPoolSize();
+        auto num_growths = wrench::S4U_CommPort::getNumCommPortPoolGrowths();
+        auto commport = wrench::S4U_CommPort::getTemporaryCommPort();
+        wrench::S4U_CommPort::retireTemporaryCommPort(commport);
+        if ((wrench::S4U_CommPort::getCommPortPoolSize() != pool_size) or
+            (wrench::S4U_CommPort::getNumCommPortPoolGrowths() != num_growths)) {
+            throw std::runtime_error("The commport pool should not have grown");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(S4U_CommPortTest, CommPortPoolGrowth) {
+    DO_TEST_WITH_FORK(do_CommPortPoolGrowth_test);
+}
+
+void S4U_CommPortTest::do_CommPortPoolGrowth_test() {
+
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+
+    int argc = 2;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    argv[1] = strdup("--wrench-commport-pool-size=10");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Create the WMSs
+    this->wms1 = simulation->add(new CommPortPoolGrowthTestWMS(this, "Host1"));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  MIXED PAYLOAD MESSAGE ORDERING TEST                             **/
+/**********************************************************************/
+
+class MixedPayloadMessageOrderingTestWMS : public wrench::ExecutionController {
+
+public:
+    MixedPayloadMessageOrderingTestWMS(S4U_CommPortTest *test,
+                                       const std::string &hostname) : wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+    S4U_CommPortTest *test;
+
+    int main() override {
+
+        if (this == this->test->wms1.get()) {
+            /** SENDER **/
+            // A zero-payload message (message queue), and then a 10-byte message (mailbox),
+            // which takes 10 seconds to transfer
+            this->test->wms2->commport->dputMessage(new wrench::SimulationMessage(0));
+            this->test->wms2->commport->dputMessage(new wrench::SimulationMessage(10));
+            // Another zero-payload message, sent once the 10-byte message has been transferred
+            wrench::Simulation::sleep(15);
+            this->test->wms2->commport->dputMessage(new wrench::SimulationMessage(0));
+
+        } else {
+            /** RECEIVER **/
+            auto msg = this->commport->getMessage<wrench::SimulationMessage>();
+            if (msg->payload != 0) {
+                throw std::runtime_error("The first message should be the zero-payload message");
+            }
+
+            // Both the 10-byte message and the second zero-payload message are available after that
+            wrench::Simulation::sleep(20);
+
+            // The 10-byte message, which was received first, should be returned first
+            msg = this->commport->getMessage<wrench::SimulationMessage>();
+            if (msg->payload != 10) {
+                throw std::runtime_error("The second message should be the 10-byte message (got a " +
+                                         std::to_string(msg->payload) + "-byte message)");
+            }
+            msg = this->commport->getMessage<wrench::SimulationMessage>();
+            if (msg->payload != 0) {
+                throw std::runtime_error("The third message should be the zero-payload message");
+            }
+            if (wrench::Simulation::getCurrentSimulatedDate() != 20) {
+                throw std::runtime_error("Available messages should be returned without waiting (date: " +
+                                         std::to_string(wrench::Simulation::getCurrentSimulatedDate()) + ")");
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(S4U_CommPortTest, MixedPayloadMessageOrdering) {
+    DO_TEST_WITH_FORK(do_MixedPayloadMessageOrdering_test);
+}
+
+void S4U_CommPortTest::do_MixedPayloadMessageOrdering_test() {
+
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Create the WMSs
+    this->wms1 = simulation->add(new MixedPayloadMessageOrderingTestWMS(this, "Host1"));
+    this->wms2 = simulation->add(new MixedPayloadMessageOrderingTestWMS(this, "Host2"));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+#include <wrench/simulation/SimulationMessageHandlerTable.h>
+#include <wrench/execution_controller/ExecutionControllerMessage.h>
+#include <wrench/managers/function_manager/FunctionManagerMessage.h>
+#include <wrench/services/storage/xrootd/XRootDMessage.h>
+#include <cstdint>
+#include <set>
+
+#include "../include/TestWithFork.h"
+
+class SimulationMessageTest : public ::testing::Test {
+
+public:
+    void do_MessageKinds_test();
+    void do_HandlerTable_test();
+    void do_MessagePool_test();
+};
+
+// A message type that doesn't set a kind, as a message type defined outside WRENCH would
+class SimulationMessageTestKindlessMessage : public wrench::ServiceMessage {
+public:
+    SimulationMessageTestKindlessMessage() : wrench::ServiceMessage(0) {}
+};
+
+// A message type too large to be allocated from the message pools
+class SimulationMessageTestLargeMessage : public wrench::ServiceMessage {
+public:
+    SimulationMessageTestLargeMessage() : wrench::ServiceMessage(0) {}
+    char padding[4096] = {};
+};
+
+
+/**********************************************************************/
+/**  MESSAGE KINDS TEST                                              **/
+/**********************************************************************/
+
+TEST_F(SimulationMessageTest, MessageKinds) {
+    DO_TEST_WITH_FORK(do_MessageKinds_test);
+}
+
+void SimulationMessageTest::do_MessageKinds_test() {
+    auto alarm_1 = std::make_shared<wrench::ExecutionControllerAlarmTimerMessage>("one", 0);
+    auto alarm_2 = std::make_shared<wrench::ExecutionControllerAlarmTimerMessage>("two", 0);
+    auto stop = std::make_shared<wrench::ServiceStopDaemonMessage>(nullptr, false, wrench::ComputeService::TERMINATION_NONE, 0);
+    auto kindless = std::make_shared<SimulationMessageTestKindlessMessage>();
+
+    // Kinds are set at construction, are per type, and don't depend on the static type of the pointer
+    ASSERT_EQ(alarm_1->getKind(), wrench::SimulationMessage::getKindOf<wrench::ExecutionControllerAlarmTimerMessage>());
+    ASSERT_EQ(alarm_1->getKind(), alarm_2->getKind());
+    ASSERT_EQ(std::static_pointer_cast<wrench::SimulationMessage>(stop)->getKind(),
+              wrench::SimulationMessage::getKindOf<wrench::ServiceStopDaemonMessage>());
+    ASSERT_NE(alarm_1->getKind(), stop->getKind());
+    ASSERT_NE(alarm_1->getKind(), wrench::SimulationMessage::UNKNOWN_KIND);
+
+    // A message type derived from another concrete message type has its own kind
+    auto ripple = std::make_shared<wrench::XRootD::RippleDelete>(nullptr, 0, 1);
+    auto advanced_ripple = std::make_shared<wrench::XRootD::AdvancedRippleDelete>(nullptr, 0, 1, std::vector<std::stack<wrench::XRootD::Node *>>());
+    auto advanced_ripple_copy = std::make_shared<wrench::XRootD::AdvancedRippleDelete>(ripple.get(), std::vector<std::stack<wrench::XRootD::Node *>>());
+    ASSERT_EQ(ripple->getKind(), wrench::SimulationMessage::getKindOf<wrench::XRootD::RippleDelete>());
+    ASSERT_EQ(advanced_ripple->getKind(), wrench::SimulationMessage::getKindOf<wrench::XRootD::AdvancedRippleDelete>());
+    ASSERT_NE(ripple->getKind(), advanced_ripple->getKind());
+    ASSERT_EQ(advanced_ripple_copy->getKind(), advanced_ripple->getKind());
+
+    // A message type that doesn't set a kind has the unknown kind
+    ASSERT_EQ(kindless->getKind(), wrench::SimulationMessage::UNKNOWN_KIND);
+}
+
+
+/**********************************************************************/
+/**  HANDLER TABLE TEST                                              **/
+/**********************************************************************/
+
+TEST_F(SimulationMessageTest, HandlerTable) {
+    DO_TEST_WITH_FORK(do_HandlerTable_test);
+}
+
+void SimulationMessageTest::do_HandlerTable_test() {
+    std::vector<std::string> calls;
+    wrench::SimulationMessageHandlerTable<> table;
+    table.add<wrench::ExecutionControllerAlarmTimerMessage>(
+            [&calls](const std::shared_ptr<wrench::ExecutionControllerAlarmTimerMessage> &msg) {
+                calls.push_back("alarm:" + msg->message);
+                return true;
+            });
+    table.add<wrench::ServiceMessage>(
+            [&calls](const std::shared_ptr<wrench::ServiceMessage> &) {
+                calls.push_back("service");
+                return false;
+            });
+
+    bool handled;
+    std::shared_ptr<wrench::SimulationMessage> msg;
+
+    // Dispatch twice to go through both the resolution and the cached handler
+    for (int i = 0; i < 2; i++) {
+        msg = std::make_shared<wrench::ExecutionControllerAlarmTimerMessage>("ring", 0);
+        ASSERT_TRUE(table.dispatch(msg, handled));
+        ASSERT_TRUE(handled);
+
+        msg = std::make_shared<wrench::ServiceStopDaemonMessage>(nullptr, false, wrench::ComputeService::TERMINATION_NONE, 0);
+        ASSERT_FALSE(table.dispatch(msg, handled));
+        ASSERT_TRUE(handled);
+
+        // A message without a kind is still dispatched to the first matching handler
+        msg = std::make_shared<SimulationMessageTestKindlessMessage>();
+        ASSERT_FALSE(table.dispatch(msg, handled));
+        ASSERT_TRUE(handled);
+
+        // A message with no matching handler
+        msg = std::make_shared<wrench::FunctionManagerWakeupMessage>();
+        ASSERT_FALSE(table.dispatch(msg, handled));
+        ASSERT_FALSE(handled);
+    }
+
+    std::vector<std::string> expected = {"alarm:ring", "service", "service", "alarm:ring", "service", "service"};
+    ASSERT_EQ(calls, expected);
+}
+
+
+/**********************************************************************/
+/**  MESSAGE POOL TEST                                               **/
+/**********************************************************************/
+
+TEST_F(SimulationMessageTest, MessagePool) {
+    DO_TEST_WITH_FORK(do_MessagePool_test);
+}
+
+void SimulationMessageTest::do_MessagePool_test() {
+    const int num_messages = 200;// more than fit in one pool slab
+
+    // Live messages never share memory, whatever their sizes
+    std::vector<wrench::SimulationMessage *> messages;
+    std::set<void *> addresses;
+    for (int i = 0; i < num_messages; i++) {
+        messages.push_back(new wrench::ExecutionControllerAlarmTimerMessage("alarm", 0));
+        messages.push_back(new wrench::ServiceStopDaemonMessage(nullptr, false, wrench::ComputeService::TERMINATION_NONE, 0));
+        messages.push_back(new SimulationMessageTestLargeMessage());
+    }
+    for (auto const &msg: messages) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(msg) % alignof(std::max_align_t), 0);
+        addresses.insert(msg);
+    }
+    ASSERT_EQ(addresses.size(), messages.size());
+
+    // Messages are deleted through a base class pointer, as message receivers do
+    for (auto const &msg: messages) {
+        delete msg;
+    }
+    messages.clear();
+
+    auto msg = new wrench::ExecutionControllerAlarmTimerMessage("alarm", 0);
+    auto address = static_cast<void *>(msg);
+    delete msg;
+    auto large_msg = new SimulationMessageTestLargeMessage();
+    large_msg->padding[sizeof(large_msg->padding) - 1] = 'x';
+    delete large_msg;
+
+#ifndef MESSAGE_MANAGER
+    // The memory of a deleted message is reused for the next message of the same size
+    msg = new wrench::ExecutionControllerAlarmTimerMessage("alarm", 0);
+    ASSERT_EQ(static_cast<void *>(msg), address);
+    ASSERT_EQ(msg->message, "alarm");
+    delete msg;
+
+    // Once the pools have grown, allocating as many messages again only reuses pooled memory
+    for (int i = 0; i < num_messages; i++) {
+        messages.push_back(new wrench::ExecutionControllerAlarmTimerMessage("alarm", 0));
+        messages.push_back(new wrench::ServiceStopDaemonMessage(nullptr, false, wrench::ComputeService::TERMINATION_NONE, 0));
+    }
+    for (auto const &m: messages) {
+        ASSERT_TRUE(addresses.find(m) != addresses.end());
+        delete m;
+    }
+#else
+    // With the message manager enabled, messages are allocated on the heap, so that memory
+    // checkers see every one of them: allocation and deletion must still work
+    msg = new wrench::ExecutionControllerAlarmTimerMessage("alarm", 0);
+    ASSERT_EQ(msg->message, "alarm");
+    delete msg;
+    (void) address;
+#endif
+}
@@ -17,6 +17,8 @@
 #include "../../include/UniqueTmpPathPrefix.h"
 
 #include <fstream>
+#include <sstream>
+#include <iomanip>
 
 #include <algorithm>
 
@@ -1587,8 +1589,18 @@ void SimulationDumpJSONTest::do_SimulationDumpUnifiedJSON_test() {
     EXPECT_NO_THROW(simulation->getOutput().dumpUnifiedJSON(workflow, unified_json_file_path, true, true, true, false, false));
 
     std::ifstream json_file = std::ifstream(unified_json_file_path);
-    nlohmann::json result_json;
-    json_file >> result_json;
+    std::stringstream json_file_content;
+    json_file_content << json_file.rdbuf();
+    nlohmann::json result_json = nlohmann::json::parse(json_file_content.str());
+
+    // With no sections, the document is null
+    EXPECT_NO_THROW(simulation->getOutput().dumpUnifiedJSON(workflow, unified_json_file_path, false, false, false, false, false));
+    std::ifstream empty_json_file = std::ifstream(unified_json_file_path);
+    std::stringstream empty_json_file_content;
+    empty_json_file_content << empty_json_file.rdbuf();
+    std::ostringstream expected_empty_file_content;
+    expected_empty_file_content << std::setw(4) << nlohmann::json() << std::endl;
+    EXPECT_EQ(empty_json_file_content.str(), expected_empty_file_content.str());
 
     std::sort(result_json["platform"]["edges"].begin(), result_json["platform"]["edges"].end(), compareEdges);
     std::sort(expected_json5["platform"]["edges"].begin(), expected_json5["platform"]["edges"].end(), compareEdges);
@@ -1611,6 +1623,57 @@ void SimulationDumpJSONTest::do_SimulationDumpUnifiedJSON_test() {
 
     EXPECT_TRUE(result_json == expected_json5);
 
+    // The document is written piece by piece, but must be byte-identical to a dump of the whole document,
+    // built as it was before (task records are in task ID order, most recent execution first)
+    auto task_record = [](const std::shared_ptr<wrench::WorkflowTask> &task, const std::string &hostname,
+                          unsigned long num_cores, double start, double end) {
+        nlohmann::json no_files;
+        return nlohmann::json({{"task_id", task->getID()},
+                               {"color", task->getColor()},
+                               {"execution_host", {{"hostname", hostname}, {"flop_rate", wrench::Simulation::getHostFlopRate(hostname)}, {"memory_manager_service", wrench::Simulation::getHostMemoryCapacity(hostname)}, {"cores", wrench::Simulation::getHostNumCores(hostname)}}},
+                               {"num_cores_allocated", num_cores},
+                               {"whole_task", {{"start", start}, {"end", end}}},
+                               {"read", no_files},
+                               {"compute", {{"start", -1.0}, {"end", -1.0}}},
+                               {"write", no_files},
+                               {"failed", -1.0},
+                               {"terminated", -1.0}});
+    };
+    auto check_file_content = [](const std::string &file_path, const nlohmann::json &document) {
+        std::ifstream file = std::ifstream(file_path);
+        std::stringstream file_content;
+        file_content << file.rdbuf();
+        std::ostringstream expected_file_content;
+        expected_file_content << std::setw(4) << document << std::endl;
+        return file_content.str() == expected_file_content.str();
+    };
+
+    nlohmann::json task_json;
+    task_json.push_back(task_record(t1, "host2", 10, 2.0, 3.0));
+    task_json.push_back(task_record(t1, "host1", 8, 1.0, 2.0));
+    task_json.push_back(task_record(t2, "host2", 20, 3.0, 4.0));
+    nlohmann::json expected_document;
+    expected_document["workflow_execution"]["tasks"] = task_json;
+    EXPECT_NO_THROW(simulation->getOutput().dumpUnifiedJSON(workflow, unified_json_file_path, false, true, false, false, false));
+    EXPECT_TRUE(check_file_content(unified_json_file_path, expected_document));
+
+    // With enough tasks for their records to be serialized in several chunks
+    for (int i = 0; i < 2500; i++) {
+        char task_id[16];
+        snprintf(task_id, sizeof(task_id), "task_%04d", i);
+        auto task = workflow->addTask(task_id, 1, 1, 1, 0);
+        task->setStartDate(i);
+        task->setEndDate(i + 1);
+        task->setExecutionHost("host1");
+        task->setNumCoresAllocated(1);
+        task_json.push_back(task_record(task, "host1", 1, i, i + 1));
+    }
+    expected_document["workflow_execution"]["tasks"] = task_json;
+    EXPECT_NO_THROW(simulation->getOutput().dumpUnifiedJSON(workflow, unified_json_file_path, false, true, false, false, false));
+    EXPECT_TRUE(check_file_content(unified_json_file_path, expected_document));
+    EXPECT_NO_THROW(simulation->getOutput().dumpWorkflowExecutionJSON(workflow, execution_data_json_file_path));
+    EXPECT_TRUE(check_file_content(execution_data_json_file_path, expected_document));
+
 
     for (int i = 0; i < argc; i++)
         free(argv[i]);
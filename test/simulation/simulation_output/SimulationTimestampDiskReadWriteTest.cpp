@@ -21,6 +21,7 @@ public:
     std::shared_ptr<wrench::DataFile> file_1;
 
     void do_SimulationTimestampDiskReadWriteBasic_test();
+    void do_SimulationTimestampDiskReadWriteLocalCopy_test();
 
 protected:
     ~SimulationTimestampDiskReadWriteTest() {
@@ -175,3 +176,81 @@ void SimulationTimestampDiskReadWriteTest::do_SimulationTimestampDiskReadWriteBa
         free(argv[i]);
     free(argv);
 }
+
+/**********************************************************************/
+/**            SimulationTimestampDiskReadWriteTestLocalCopy         **/
+/**********************************************************************/
+
+/*
+ * Testing that the disk reads and writes of a local file copy are recorded
+ * as such, with each completion matched to its start
+ */
+class SimulationTimestampDiskReadWriteLocalCopyTestWMS : public wrench::ExecutionController {
+public:
+    SimulationTimestampDiskReadWriteLocalCopyTestWMS(SimulationTimestampDiskReadWriteTest *test,
+                                                     std::string &hostname) : wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    SimulationTimestampDiskReadWriteTest *test;
+
+    int main() override {
+
+        wrench::StorageService::copyFile(
+                wrench::FileLocation::LOCATION(this->test->storage_service_1, this->test->file_1),
+                wrench::FileLocation::LOCATION(this->test->storage_service_1, "/copy/", this->test->file_1));
+
+        return 0;
+    }
+};
+
+TEST_F(SimulationTimestampDiskReadWriteTest, SimulationTimestampDiskReadWriteLocalCopyTest) {
+    DO_TEST_WITH_FORK(do_SimulationTimestampDiskReadWriteLocalCopy_test);
+}
+
+void SimulationTimestampDiskReadWriteTest::do_SimulationTimestampDiskReadWriteLocalCopy_test() {
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::string host1 = "Host1";
+
+    ASSERT_NO_THROW(storage_service_1 = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(host1, {"/"},
+                                                                                                                 {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "10"}})));
+
+    ASSERT_NO_THROW(simulation->add(new SimulationTimestampDiskReadWriteLocalCopyTestWMS(this, host1)));
+
+    ASSERT_NO_THROW(storage_service_1->createFile(file_1, "/"));
+
+    simulation->getOutput().enableDiskTimestamps(true);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    // The 100-byte file is copied in 10-byte chunks, each read and then written
+    auto read_starts = simulation->getOutput().getTrace<wrench::SimulationTimestampDiskReadStart>();
+    auto read_completions = simulation->getOutput().getTrace<wrench::SimulationTimestampDiskReadCompletion>();
+    auto write_starts = simulation->getOutput().getTrace<wrench::SimulationTimestampDiskWriteStart>();
+    auto write_completions = simulation->getOutput().getTrace<wrench::SimulationTimestampDiskWriteCompletion>();
+    ASSERT_EQ(10, read_starts.size());
+    ASSERT_EQ(10, read_completions.size());
+    ASSERT_EQ(10, write_starts.size());
+    ASSERT_EQ(10, write_completions.size());
+
+    for (unsigned long i = 0; i < write_completions.size(); i++) {
+        auto start = write_completions.at(i)->getContent()->getEndpoint();
+        ASSERT_TRUE(dynamic_cast<wrench::SimulationTimestampDiskWriteStart *>(start) != nullptr);
+        ASSERT_EQ(start->getCounter(), write_completions.at(i)->getContent()->getCounter());
+        ASSERT_EQ(start, write_starts.at(i)->getContent());
+        ASSERT_EQ(read_completions.at(i)->getContent()->getEndpoint(), read_starts.at(i)->getContent());
+    }
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
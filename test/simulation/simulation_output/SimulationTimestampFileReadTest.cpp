@@ -247,6 +247,31 @@ void SimulationTimestampFileReadTest::do_SimulationTimestampFileReadBasic_test()
     }
 
 
+    // overlapping reads of the same file from the same location are matched using correlation handles
+    auto location = wrench::FileLocation::LOCATION(this->storage_service, file_1);
+    int first_handle = simulation->getOutput().addTimestampFileReadStart(100.0, file_1, location, this->storage_service, task1);
+    int second_handle = simulation->getOutput().addTimestampFileReadStart(101.0, file_1, location, this->storage_service, task1);
+    ASSERT_NE(first_handle, second_handle);
+    simulation->getOutput().addTimestampFileReadCompletion(102.0, file_1, location, this->storage_service, task1, second_handle);
+    simulation->getOutput().addTimestampFileReadCompletion(103.0, file_1, location, this->storage_service, task1, first_handle);
+
+    completion_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampFileReadCompletion>();
+    ASSERT_EQ(expected_completion_timestamps + 2, completion_timestamps.size());
+    ASSERT_DOUBLE_EQ(101.0, completion_timestamps[4]->getContent()->getEndpoint()->getDate());
+    ASSERT_DOUBLE_EQ(100.0, completion_timestamps[5]->getContent()->getEndpoint()->getDate());
+
+    // without correlation handles, reads are matched based on the file, location, and service
+    auto other_location = wrench::FileLocation::LOCATION(this->storage_service, file_2);
+    simulation->getOutput().addTimestampFileReadStart(104.0, file_1, location, this->storage_service, task1);
+    simulation->getOutput().addTimestampFileReadStart(105.0, file_2, other_location, this->storage_service, task1);
+    simulation->getOutput().addTimestampFileReadCompletion(106.0, file_2, other_location, this->storage_service, task1);
+    simulation->getOutput().addTimestampFileReadCompletion(107.0, file_1, location, this->storage_service, task1);
+
+    completion_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampFileReadCompletion>();
+    ASSERT_EQ(expected_completion_timestamps + 4, completion_timestamps.size());
+    ASSERT_DOUBLE_EQ(105.0, completion_timestamps[6]->getContent()->getEndpoint()->getDate());
+    ASSERT_DOUBLE_EQ(104.0, completion_timestamps[7]->getContent()->getEndpoint()->getDate());
+
     // test constructors for invalid arguments
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
     ASSERT_THROW(simulation->getOutput().addTimestampFileReadStart(0.0,
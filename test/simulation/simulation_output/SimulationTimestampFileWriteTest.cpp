@@ -250,6 +250,33 @@ void SimulationTimestampFileWriteTest::do_SimulationTimestampFileWriteBasic_test
         ASSERT_EQ(fc.first->getTask(), fc.second->getTask());
     }
 
+    // overlapping writes of the same file to the same location are matched using correlation handles
+    auto location = wrench::FileLocation::LOCATION(this->storage_service, file_1);
+    int first_handle = simulation->getOutput().addTimestampFileWriteStart(100.0, file_1, location, this->storage_service, task);
+    int second_handle = simulation->getOutput().addTimestampFileWriteStart(101.0, file_1, location, this->storage_service, task);
+    ASSERT_NE(first_handle, second_handle);
+    simulation->getOutput().addTimestampFileWriteCompletion(102.0, file_1, location, this->storage_service, task, second_handle);
+    simulation->getOutput().addTimestampFileWriteCompletion(103.0, file_1, location, this->storage_service, task, first_handle);
+
+    completion_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampFileWriteCompletion>();
+    ASSERT_EQ(expected_completion_timestamps + 2, completion_timestamps.size());
+    ASSERT_DOUBLE_EQ(101.0, completion_timestamps[4]->getContent()->getEndpoint()->getDate());
+    ASSERT_DOUBLE_EQ(100.0, completion_timestamps[5]->getContent()->getEndpoint()->getDate());
+
+    // without correlation handles, writes are matched based on the file, location, and service
+    auto other_location = wrench::FileLocation::LOCATION(this->storage_service, file_2);
+    simulation->getOutput().addTimestampFileWriteStart(104.0, file_1, location, this->storage_service, task);
+    simulation->getOutput().addTimestampFileWriteStart(105.0, file_2, other_location, this->storage_service, task);
+    simulation->getOutput().addTimestampFileWriteFailure(106.0, file_2, other_location, this->storage_service, task);
+    simulation->getOutput().addTimestampFileWriteCompletion(107.0, file_1, location, this->storage_service, task);
+
+    failure_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampFileWriteFailure>();
+    completion_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampFileWriteCompletion>();
+    ASSERT_EQ(1, failure_timestamps.size());
+    ASSERT_DOUBLE_EQ(105.0, failure_timestamps[0]->getContent()->getEndpoint()->getDate());
+    ASSERT_EQ(expected_completion_timestamps + 3, completion_timestamps.size());
+    ASSERT_DOUBLE_EQ(104.0, completion_timestamps[6]->getContent()->getEndpoint()->getDate());
+
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
     // test constructors for invalid arguments
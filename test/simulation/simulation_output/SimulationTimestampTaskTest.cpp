@@ -31,6 +31,10 @@ public:
     void do_SimulationTimestampTaskBasic_test();
     void do_SimulationTimestampTaskMultiple_test();
     void do_SimulationTimestampTaskTerminateAndFail_test();
+    void do_SimulationTimestampTaskStreaming_test(wrench::SimulationTimestampStream::Format format);
+    void do_SimulationTimestampTaskStreamingToggle_test();
+
+    std::string stream_file_path = UNIQUE_TMP_PATH_PREFIX + "timestamps.out";
 
 
 protected:
@@ -235,6 +239,13 @@ void SimulationTimestampTaskTest::do_SimulationTimestampTaskBasic_test() {
     ASSERT_GT(task2_start_timestamp, task1_start_timestamp);
     ASSERT_GT(task2_completion_timestamp, task1_completion_timestamp);
 
+    // The date column should match the dates of the timestamps, in trace order
+    auto &start_dates = simulation->getOutput().getTraceDates<wrench::SimulationTimestampTaskStart>();
+    ASSERT_EQ(start_dates.size(), timestamp_start_trace.size());
+    for (unsigned long i = 0; i < start_dates.size(); i++) {
+        ASSERT_DOUBLE_EQ(start_dates[i], timestamp_start_trace[i]->getDate());
+    }
+
     // expected timeline: task2_end...failed_task_start...failed_task_failed
     auto timestamp_failure_trace = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskFailure>();
     //    for (auto const &ts : timestamp_start_trace) {
@@ -294,6 +305,199 @@ void SimulationTimestampTaskTest::do_SimulationTimestampTaskBasic_test() {
     free(argv);
 }
 
+/**********************************************************************/
+/**            SimulationTimestampTaskStreamingTest                  **/
+/**********************************************************************/
+
+/*
+ * Testing that task timestamps are written to a file, and not kept in
+ * memory, when timestamp streaming is enabled
+ */
+TEST_F(SimulationTimestampTaskTest, SimulationTimestampTaskStreamingJSONLinesTest) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_SimulationTimestampTaskStreaming_test, wrench::SimulationTimestampStream::JSON_LINES);
+}
+
+TEST_F(SimulationTimestampTaskTest, SimulationTimestampTaskStreamingBinaryTest) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_SimulationTimestampTaskStreaming_test, wrench::SimulationTimestampStream::BINARY);
+}
+
+void SimulationTimestampTaskTest::do_SimulationTimestampTaskStreaming_test(wrench::SimulationTimestampStream::Format format) {
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 2;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    argv[1] = strdup("--wrench-default-control-message-size=1024");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::string wms_host = wrench::Simulation::getHostnameList()[1];
+    std::string execution_host = wrench::Simulation::getHostnameList()[0];
+
+    ASSERT_NO_THROW(compute_service = simulation->add(new wrench::BareMetalComputeService(wms_host,
+                                                                                          {std::make_pair(
+                                                                                                  execution_host,
+                                                                                                  std::make_tuple(wrench::ComputeService::ALL_CORES,
+                                                                                                                  wrench::ComputeService::ALL_RAM))},
+                                                                                          {})));
+
+    ASSERT_NO_THROW(storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(wms_host, {"/"})));
+
+    ASSERT_NO_THROW(simulation->add(new SimulationTimestampTaskBasicTestWMS(this, wms_host)));
+
+    file_registry_service = simulation->add(new wrench::FileRegistryService(wms_host));
+
+    small_input_file = wrench::Simulation::addFile("small_input_file", 10);
+    large_input_file = wrench::Simulation::addFile("large_input_file", 1000000);
+
+    ASSERT_NO_THROW(storage_service->createFile(large_input_file));
+    ASSERT_NO_THROW(storage_service->createFile(small_input_file));
+
+    simulation->getOutput().enableWorkflowTaskTimestamps(true);
+
+    ASSERT_THROW(simulation->getOutput().enableTimestampStreaming("/bogus/path/timestamps.out", format), std::invalid_argument);
+    simulation->getOutput().enableTimestampStreaming(stream_file_path, format);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    simulation->getOutput().disableTimestampStreaming();
+
+    // Nothing was kept in memory
+    ASSERT_TRUE(simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>().empty());
+    ASSERT_TRUE(simulation->getOutput().getTrace<wrench::SimulationTimestampTaskCompletion>().empty());
+    ASSERT_TRUE(simulation->getOutput().getTrace<wrench::SimulationTimestampTaskFailure>().empty());
+    ASSERT_TRUE(simulation->getOutput().getTraceDates<wrench::SimulationTimestampTaskStart>().empty());
+
+    // Read the timestamps back
+    wrench::SimulationTimestampStreamReader reader(stream_file_path);
+    ASSERT_EQ(reader.getFormat(), format);
+    std::vector<nlohmann::json> records;
+    for (auto const &record: reader) {
+        records.push_back(record);
+    }
+    ASSERT_EQ(records.size(), 6);
+
+    std::vector<std::pair<std::string, std::string>> expected = {
+            {"SimulationTimestampTaskStart", "task1"},
+            {"SimulationTimestampTaskCompletion", "task1"},
+            {"SimulationTimestampTaskStart", "task2"},
+            {"SimulationTimestampTaskCompletion", "task2"},
+            {"SimulationTimestampTaskStart", "failed_task"},
+            {"SimulationTimestampTaskFailure", "failed_task"}};
+    for (unsigned long i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(records.at(i)["type"], expected.at(i).first);
+        ASSERT_EQ(records.at(i)["task"], expected.at(i).second);
+    }
+    ASSERT_DOUBLE_EQ(records.at(0)["date"].get<double>(), this->task1->getStartDate());
+    ASSERT_LT(std::abs(records.at(1)["date"].get<double>() - this->task1->getEndDate()), 0.001);
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**            SimulationTimestampTaskStreamingToggleTest            **/
+/**********************************************************************/
+
+/*
+ * Testing that start/end timestamps remain matched when timestamp streaming
+ * is enabled, and then disabled, while tasks are running
+ */
+class SimulationTimestampTaskStreamingToggleTestWMS : public wrench::ExecutionController {
+public:
+    SimulationTimestampTaskStreamingToggleTestWMS(SimulationTimestampTaskTest *test,
+                                                  std::string &hostname) : wrench::ExecutionController(hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    SimulationTimestampTaskTest *test;
+
+    int main() override {
+
+        auto job_manager = this->createJobManager();
+
+        // task1 starts before streaming is enabled, and completes after
+        this->test->task1 = this->test->workflow->addTask("task1", 10.0, 1, 1, 0);
+        auto job1 = job_manager->createStandardJob(this->test->task1);
+        job_manager->submitJob(job1, this->test->compute_service);
+        wrench::Simulation::sleep(1.0);
+        this->getSimulation()->getOutput().enableTimestampStreaming(this->test->stream_file_path, wrench::SimulationTimestampStream::JSON_LINES);
+        this->waitForAndProcessNextEvent();
+
+        // task2 starts before streaming is disabled, and completes after
+        this->test->task2 = this->test->workflow->addTask("task2", 10.0, 1, 1, 0);
+        auto job2 = job_manager->createStandardJob(this->test->task2);
+        job_manager->submitJob(job2, this->test->compute_service);
+        wrench::Simulation::sleep(1.0);
+        this->getSimulation()->getOutput().disableTimestampStreaming();
+        this->waitForAndProcessNextEvent();
+
+        return 0;
+    }
+};
+
+TEST_F(SimulationTimestampTaskTest, SimulationTimestampTaskStreamingToggleTest) {
+    DO_TEST_WITH_FORK(do_SimulationTimestampTaskStreamingToggle_test);
+}
+
+void SimulationTimestampTaskTest::do_SimulationTimestampTaskStreamingToggle_test() {
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::string wms_host = wrench::Simulation::getHostnameList()[1];
+    std::string execution_host = wrench::Simulation::getHostnameList()[0];
+
+    ASSERT_NO_THROW(compute_service = simulation->add(new wrench::BareMetalComputeService(wms_host,
+                                                                                          {std::make_pair(
+                                                                                                  execution_host,
+                                                                                                  std::make_tuple(wrench::ComputeService::ALL_CORES,
+                                                                                                                  wrench::ComputeService::ALL_RAM))},
+                                                                                          {})));
+
+    ASSERT_NO_THROW(simulation->add(new SimulationTimestampTaskStreamingToggleTestWMS(this, wms_host)));
+
+    simulation->getOutput().enableWorkflowTaskTimestamps(true);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    // Both start timestamps, and both completion timestamps, are in memory, and they are matched
+    auto starts = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>();
+    auto completions = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskCompletion>();
+    ASSERT_EQ(starts.size(), 2);
+    ASSERT_EQ(completions.size(), 2);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(starts.at(i)->getContent()->getTask(), (i == 0 ? this->task1 : this->task2));
+        ASSERT_EQ(starts.at(i)->getContent()->getEndpoint(), completions.at(i)->getContent());
+        ASSERT_EQ(completions.at(i)->getContent()->getEndpoint(), starts.at(i)->getContent());
+    }
+
+    // The dump, which follows endpoints, works
+    ASSERT_NO_THROW(simulation->getOutput().dumpWorkflowExecutionJSON(workflow, UNIQUE_TMP_PATH_PREFIX + "execution.json", false));
+
+    // Only task2's start timestamp was streamed
+    wrench::SimulationTimestampStreamReader reader(stream_file_path);
+    std::vector<nlohmann::json> records;
+    for (auto const &record: reader) {
+        records.push_back(record);
+    }
+    ASSERT_EQ(records.size(), 1);
+    ASSERT_EQ(records.at(0)["type"], "SimulationTimestampTaskStart");
+    ASSERT_EQ(records.at(0)["task"], "task2");
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
 /**********************************************************************/
 /**            SimulationTimestampTaskTestMultiple                   **/
 /**********************************************************************/
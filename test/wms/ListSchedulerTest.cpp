@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2025. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <gtest/gtest.h>
+
+#include "../include/TestWithFork.h"
+#include "../include/UniqueTmpPathPrefix.h"
+
+WRENCH_LOG_CATEGORY(list_scheduler_test, "Log category for ListSchedulerTest");
+
+
+class ListSchedulerTest : public ::testing::Test {
+
+public:
+    std::shared_ptr<wrench::Workflow> workflow;
+    std::shared_ptr<wrench::WorkflowTask> task0, task1, task2, task3, task4;
+    std::shared_ptr<wrench::BareMetalComputeService> compute_service;
+    std::shared_ptr<wrench::StorageService> storage_service;
+
+    void do_ForkJoin_test(bool dynamic_level_updates);
+
+protected:
+    ListSchedulerTest() {
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"https://simgrid.org/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"StorageHost\" speed=\"1f\" core=\"1\"> "
+                          "          <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "             <prop id=\"size\" value=\"1000GB\"/>"
+                          "             <prop id=\"mount\" value=\"/\"/>"
+                          "          </disk>"
+                          "       </host>"
+                          "       <host id=\"FastHost\" speed=\"10f\" core=\"2\"/> "
+                          "       <host id=\"SlowHost\" speed=\"1f\" core=\"2\"/> "
+                          "       <link id=\"1\" bandwidth=\"100MBps\" latency=\"1us\"/>"
+                          "       <link id=\"2\" bandwidth=\"100MBps\" latency=\"1us\"/>"
+                          "       <link id=\"3\" bandwidth=\"100MBps\" latency=\"1us\"/>"
+                          "       <route src=\"StorageHost\" dst=\"FastHost\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"StorageHost\" dst=\"SlowHost\"> <link_ctn id=\"2\"/> </route>"
+                          "       <route src=\"FastHost\" dst=\"SlowHost\"> <link_ctn id=\"3\"/> </route>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+    }
+
+    void createForkJoinWorkflow(bool dynamic_level_updates) {
+        // Create a fork-join workflow: task0 -> {task1, task2, task3} -> task4
+        workflow = wrench::Workflow::createWorkflow();
+        workflow->enableTopBottomLevelDynamicUpdates(dynamic_level_updates);
+        auto input_file = wrench::Simulation::addFile("input_file", 1000);
+        auto output_file = wrench::Simulation::addFile("output_file", 1000);
+        task0 = workflow->addTask("task0", 100.0, 1, 1, 0);
+        task0->addInputFile(input_file);
+        task4 = workflow->addTask("task4", 100.0, 1, 1, 0);
+        task4->addOutputFile(output_file);
+        int i = 1;
+        for (auto const &task: {&task1, &task2, &task3}) {
+            auto f1 = wrench::Simulation::addFile("file_in_" + std::to_string(i), 1000);
+            auto f2 = wrench::Simulation::addFile("file_out_" + std::to_string(i), 1000);
+            *task = workflow->addTask("task" + std::to_string(i), 10.0 * i, 1, 1, 0);
+            task0->addOutputFile(f1);
+            (*task)->addInputFile(f1);
+            (*task)->addOutputFile(f2);
+            task4->addInputFile(f2);
+            i++;
+        }
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+};
+
+
+/**********************************************************************/
+/**  FORK-JOIN TEST                                                  **/
+/**********************************************************************/
+
+class ListSchedulerForkJoinTestWMS : public wrench::ExecutionController {
+
+public:
+    ListSchedulerForkJoinTestWMS(ListSchedulerTest *test,
+                                 const std::string &hostname) : wrench::ExecutionController(hostname, "test"), test(test) {
+    }
+
+private:
+    ListSchedulerTest *test;
+
+    int main() override {
+        auto job_manager = this->createJobManager();
+        auto workflow = this->test->workflow;
+
+        wrench::ListScheduler scheduler(workflow, job_manager, {this->test->compute_service}, this->test->storage_service);
+
+        // Ranks decrease along every path, and longer siblings have higher ranks
+        if ((scheduler.getUpwardRank(this->test->task0) <= scheduler.getUpwardRank(this->test->task3)) or
+            (scheduler.getUpwardRank(this->test->task3) <= scheduler.getUpwardRank(this->test->task2)) or
+            (scheduler.getUpwardRank(this->test->task2) <= scheduler.getUpwardRank(this->test->task1)) or
+            (scheduler.getUpwardRank(this->test->task1) <= scheduler.getUpwardRank(this->test->task4))) {
+            throw std::runtime_error("Unexpected upward ranks");
+        }
+
+        while (not workflow->isDone()) {
+            scheduler.scheduleReadyTasks();
+            auto event = this->waitForNextEvent();
+            if (auto completed = std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                scheduler.processJobCompletion(completed->standard_job);
+            } else {
+                throw std::runtime_error("Unexpected event: " + event->toString());
+            }
+        }
+
+        if (scheduler.getNumQueuedTasks() != 0) {
+            throw std::runtime_error("The ready queue should be empty");
+        }
+
+        // The sequential tasks, and the longest of the parallel tasks, should run on the fast host
+        for (auto const &task: {this->test->task0, this->test->task3, this->test->task4}) {
+            if (task->getExecutionHost() != "FastHost") {
+                throw std::runtime_error("Task " + task->getID() + " should have run on FastHost");
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ListSchedulerTest, ForkJoin) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_ForkJoin_test, true);
+}
+
+TEST_F(ListSchedulerTest, ForkJoinWithStaleLevels) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_ForkJoin_test, false);
+}
+
+void ListSchedulerTest::do_ForkJoin_test(bool dynamic_level_updates) {
+    createForkJoinWorkflow(dynamic_level_updates);
+
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/"})));
+
+    // Create a Compute Service
+    ASSERT_NO_THROW(compute_service = simulation->add(
+                            new wrench::BareMetalComputeService("StorageHost", {"FastHost", "SlowHost"}, "", {}, {})));
+
+    // Create a WMS
+    ASSERT_NO_THROW(simulation->add(new ListSchedulerForkJoinTestWMS(this, "StorageHost")));
+
+    // Stage the input file
+    for (auto const &f: workflow->getInputFiles()) {
+        ASSERT_NO_THROW(storage_service->createFile(f));
+    }
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    ASSERT_TRUE(workflow->isDone());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -28,3 +28,38 @@ TEST(DataFileTest, FileStructure) {
     workflow->clear();
     wrench::Simulation::removeAllFiles();
 }
+
+TEST(DataFileTest, FileRegistry) {
+    auto f1 = wrench::Simulation::addFile("file-b", 100);
+    auto f2 = wrench::Simulation::addFile("file-a", 200);
+    ASSERT_THROW(wrench::Simulation::addFile("file-a", 300), std::invalid_argument);
+    ASSERT_EQ(wrench::Simulation::getNumFiles(), 2);
+    ASSERT_EQ(wrench::Simulation::getFileByID("file-a"), f2);
+
+    // The file map is ordered by file ID
+    ASSERT_EQ(wrench::Simulation::getFileMap().size(), 2);
+    ASSERT_EQ(wrench::Simulation::getFileMap().begin()->second, f2);
+
+    // Removed files can no longer be found, and their IDs can be reused
+    wrench::Simulation::removeFile(f1);
+    ASSERT_THROW(wrench::Simulation::removeFile(f1), std::invalid_argument);
+    ASSERT_EQ(wrench::Simulation::getFileByIDOrNull("file-b"), nullptr);
+    ASSERT_THROW(wrench::Simulation::getFileByID("file-b"), std::invalid_argument);
+    ASSERT_EQ(wrench::Simulation::getFileMap().size(), 1);
+    auto f3 = wrench::Simulation::addFile("file-b", 300);
+    ASSERT_EQ(wrench::Simulation::getFileByID("file-b"), f3);
+    ASSERT_EQ(wrench::Simulation::getFileMap().size(), 2);
+
+    // Scratch files are not registered
+    auto scratch1 = wrench::Simulation::addScratchFile(400);
+    auto scratch2 = wrench::Simulation::addScratchFile(500);
+    ASSERT_NE(scratch1->getID(), scratch2->getID());
+    ASSERT_EQ(scratch1->getSize(), 400);
+    ASSERT_EQ(wrench::Simulation::getFileByIDOrNull(scratch1->getID()), nullptr);
+    ASSERT_EQ(wrench::Simulation::getNumFiles(), 2);
+    ASSERT_EQ(wrench::Simulation::getFileMap().size(), 2);
+
+    wrench::Simulation::removeAllFiles();
+    ASSERT_EQ(wrench::Simulation::getNumFiles(), 0);
+    ASSERT_TRUE(wrench::Simulation::getFileMap().empty());
+}
@@ -8,9 +8,13 @@
  */
 
 #include <gtest/gtest.h>
+#include <fstream>
+#include <nlohmann/json.hpp>
 
 #include <wrench/data_file/DataFile.h>
 #include <wrench/workflow/Workflow.h>
+#include <wrench/workflow/WorkflowSnapshot.h>
+#include <wrench/simulation/Simulation.h>
 #include "../include/UniqueTmpPathPrefix.h"
 #include <wrench/tools/wfcommons/WfCommonsWorkflowParser.h>
 
@@ -54,3 +58,103 @@ TEST_F(WorkflowLoadFromJSONTest, LoadValidJSON) {
 
     ASSERT_LT(workflow->getCompletionDate(), 0.0);
 }
+
+TEST_F(WorkflowLoadFromJSONTest, LoadValidJSONInAnyKeyOrder) {
+
+    // nlohmann::json sorts keys, so that the workflow execution comes before the specification
+    std::ifstream file(this->json_file_path);
+    auto json_string = nlohmann::json::parse(file).dump();
+
+    std::shared_ptr<wrench::Workflow> workflow;
+    ASSERT_NO_THROW(
+            workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(json_string, "1f", false));
+    ASSERT_EQ(workflow->getNumberOfTasks(), 52);
+    ASSERT_EQ(workflow->getTaskByID("individuals_ID0000001")->getPriority(), 20);
+    ASSERT_EQ(workflow->getTaskByID("individuals_ID0000001")->getInputFiles().size(), 2);
+    ASSERT_EQ(workflow->getNumLevels(), 3);
+    ASSERT_EQ(workflow->getTasksInTopLevelRange(2, 2).size(), 28);
+
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString("{\"schemaVersion\": \"1.4\"}", "1f"),
+                 std::invalid_argument);
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString("{\"schemaVersion\": \"1.5\"}", "1f"),
+                 std::invalid_argument);
+}
+
+TEST_F(WorkflowLoadFromJSONTest, LoadWithSnapshot) {
+
+    std::string snapshot_path = UNIQUE_TMP_PATH_PREFIX + "workflow_snapshot.bin";
+    std::remove(snapshot_path.c_str());
+
+    // No snapshot: the JSON file is parsed, and the snapshot created
+    std::shared_ptr<wrench::Workflow> parsed;
+    ASSERT_NO_THROW(parsed = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONWithSnapshot(
+                            this->json_file_path, snapshot_path, "1f"));
+    ASSERT_TRUE(std::ifstream(snapshot_path).good());
+
+    // Snapshot: the workflow is loaded from it
+    std::shared_ptr<wrench::Workflow> loaded;
+    ASSERT_NO_THROW(loaded = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONWithSnapshot(
+                            this->json_file_path, snapshot_path, "1f"));
+    ASSERT_EQ(loaded->getNumberOfTasks(), 52);
+    ASSERT_EQ(loaded->getNumLevels(), 3);
+    ASSERT_EQ(loaded->getTasksInTopLevelRange(2, 2).size(), 28);
+    for (auto const &task: parsed->getTasks()) {
+        auto loaded_task = loaded->getTaskByID(task->getID());
+        ASSERT_DOUBLE_EQ(loaded_task->getFlops(), task->getFlops());
+        ASSERT_EQ(loaded_task->getPriority(), task->getPriority());
+        ASSERT_EQ(loaded_task->getMemoryRequirement(), task->getMemoryRequirement());
+        ASSERT_EQ(loaded_task->getNumberOfParents(), task->getNumberOfParents());
+        ASSERT_EQ(loaded_task->getNumberOfChildren(), task->getNumberOfChildren());
+        ASSERT_EQ(loaded_task->getInputFiles().size(), task->getInputFiles().size());
+        ASSERT_EQ(loaded_task->getOutputFiles().size(), task->getOutputFiles().size());
+    }
+
+    // Different arguments: the snapshot is stale, and is re-created
+    std::shared_ptr<wrench::Workflow> reparsed;
+    ASSERT_NO_THROW(reparsed = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONWithSnapshot(
+                            this->json_file_path, snapshot_path, "1f", true));
+    ASSERT_EQ(wrench::WorkflowSnapshot::load(snapshot_path, "bogus key"), nullptr);
+
+    // Corrupted snapshot
+    wrench::WorkflowSnapshot::save(reparsed, snapshot_path, "key");
+    std::ifstream in(snapshot_path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(snapshot_path, std::ios::binary | std::ios::trunc) << content.substr(0, content.size() / 2);
+    ASSERT_THROW(wrench::WorkflowSnapshot::load(snapshot_path, "key"), std::invalid_argument);
+
+    std::remove(snapshot_path.c_str());
+}
+
+TEST_F(WorkflowLoadFromJSONTest, LoadJSONWithMissingKeys) {
+
+    std::ifstream file(this->json_file_path);
+    auto json = nlohmann::json::parse(file);
+    std::string file_id = json["workflow"]["specification"]["files"][0]["id"];
+
+    auto without_schema_version = json;
+    without_schema_version.erase("schemaVersion");
+    auto without_execution = json;
+    without_execution["workflow"].erase("execution");
+    auto without_tasks = json;
+    without_tasks["workflow"]["specification"].erase("tasks");
+
+    // Missing keys are only detected at the end of the document, once files have been
+    // added to the simulation: these files must have been removed
+    wrench::Simulation::removeAllFiles();
+    for (auto const &bad_json: {without_schema_version, without_execution, without_tasks}) {
+        ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(bad_json.dump(), "1f"),
+                     std::invalid_argument);
+        ASSERT_EQ(wrench::Simulation::getNumFiles(), 0);
+        ASSERT_EQ(wrench::Simulation::getFileByIDOrNull(file_id), nullptr);
+    }
+
+    // Files that were already known are left alone
+    auto known_file = wrench::Simulation::addFile(file_id, 100);
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(without_execution.dump(), "1f"),
+                 std::invalid_argument);
+    ASSERT_EQ(wrench::Simulation::getNumFiles(), 1);
+    ASSERT_EQ(wrench::Simulation::getFileByIDOrNull(file_id), known_file);
+
+    wrench::Simulation::removeAllFiles();
+}
@@ -116,6 +116,10 @@ TEST_F(WorkflowTest, WorkflowStructure) {
     ASSERT_EQ(4, task_map.size());
     auto tasks = workflow->getTasks();
     ASSERT_EQ(4, tasks.size());
+    ASSERT_TRUE(tasks == workflow->getTasksSortedByID());
+    ASSERT_TRUE((tasks == std::vector<std::shared_ptr<wrench::WorkflowTask>>{t1, t2, t3, t4}));
+    ASSERT_EQ(4, workflow->getTaskIndex().size());
+    ASSERT_EQ(t3, workflow->getTaskIndex().at("task1-test-03"));
     auto etask_map = workflow->getEntryTaskMap();
     ASSERT_EQ(1, etask_map.size());
     auto etasks = workflow->getEntryTasks();
@@ -176,6 +180,8 @@ TEST_F(WorkflowTest, WorkflowStructure) {
     ASSERT_EQ(0, workflow->getTaskChildren(t2).size());
 
     ASSERT_EQ(3, workflow->getTasks().size());
+    ASSERT_TRUE((workflow->getTasksSortedByID() == std::vector<std::shared_ptr<wrench::WorkflowTask>>{t1, t2, t3}));
+    ASSERT_EQ(0, workflow->getTaskIndex().count("task1-test-04"));
 
     workflow->removeTask(t1);
 }
@@ -204,6 +210,30 @@ TEST_F(WorkflowTest, ControlDependency) {
     ASSERT_EQ(new_task->getTopLevel(), new_task_top_level + 1);
 }
 
+TEST_F(WorkflowTest, RemoveControlDependencyWithoutSharedFiles) {
+    // Two tasks that share no file, the consumer reading a workflow input file and a file of its own
+    auto producer = workflow->addTask("producer", 1.0, 1, 1, 0);
+    auto consumer = workflow->addTask("consumer", 1.0, 1, 1, 0);
+    auto consumer_file = wrench::Simulation::addFile("consumer-file", 1);
+    producer->addInputFile(f1);
+    consumer->addInputFile(f1);
+    consumer->addInputFile(consumer_file);
+
+    workflow->addControlDependency(producer, consumer);
+    ASSERT_TRUE(workflow->pathExists(producer, consumer));
+    workflow->removeControlDependency(producer, consumer);
+    ASSERT_FALSE(workflow->pathExists(producer, consumer));
+    ASSERT_EQ(consumer->getState(), wrench::WorkflowTask::State::READY);
+
+    // Looking for a data dependency must not have made the consumer's input files outputs of some task
+    for (auto const &f: consumer->getInputFiles()) {
+        ASSERT_EQ(workflow->getTaskThatOutputs(f), nullptr);
+        ASSERT_FALSE(workflow->isFileOutputOfSomeTask(f));
+    }
+    auto input_files = workflow->getInputFiles();
+    ASSERT_TRUE(std::find(input_files.begin(), input_files.end(), consumer_file) != input_files.end());
+}
+
 void doTopBottomLevelsTest(bool dynamic_updates) {
     // Create a test workflow
     auto wf = wrench::Workflow::createWorkflow();
@@ -452,3 +482,234 @@ TEST_F(WorkflowTest, LowLevelDagOfTasksTest) {
     ASSERT_NO_THROW(dag.getParents((wrench::WorkflowTask *) 1));
     ASSERT_THROW(dag.getParents((wrench::WorkflowTask *) 3), std::invalid_argument);
 }
+
+TEST_F(WorkflowTest, IncrementalCycleDetection) {
+    auto workflow = wrench::Workflow::createWorkflow();
+
+    // Tasks are created in the reverse order of their dependencies, so that
+    // every dependency goes against the current topological order
+    auto c = workflow->addTask("c", 1, 1, 1, 0);
+    auto b = workflow->addTask("b", 1, 1, 1, 0);
+    auto a = workflow->addTask("a", 1, 1, 1, 0);
+    auto d = workflow->addTask("d", 1, 1, 1, 0);
+
+    ASSERT_NO_THROW(workflow->addControlDependency(b, c));
+    ASSERT_NO_THROW(workflow->addControlDependency(a, b));
+    ASSERT_NO_THROW(workflow->addControlDependency(c, d));
+    ASSERT_TRUE(workflow->pathExists(a, d));
+    ASSERT_FALSE(workflow->pathExists(d, a));
+
+    ASSERT_THROW(workflow->addControlDependency(d, a), std::runtime_error);
+    ASSERT_THROW(workflow->addControlDependency(c, b), std::runtime_error);
+
+    // Redundant dependency
+    workflow->addControlDependency(a, d);
+    ASSERT_EQ(1, workflow->getTaskNumberOfParents(d));
+    ASSERT_EQ(3, d->getTopLevel());
+
+    // Bulk mode
+    auto e = workflow->addTask("e", 1, 1, 1, 0);
+    workflow->enableBulkDependencyAddition(true);
+    ASSERT_NO_THROW(workflow->addControlDependency(e, a, true));
+    ASSERT_NO_THROW(workflow->addControlDependency(e, a, true));
+    ASSERT_EQ(1, workflow->getTaskNumberOfParents(a));
+    ASSERT_NO_THROW(workflow->enableBulkDependencyAddition(false));
+    ASSERT_EQ(4, d->getTopLevel());
+    ASSERT_EQ(4, e->getBottomLevel());
+
+    workflow->enableBulkDependencyAddition(true);
+    ASSERT_NO_THROW(workflow->addControlDependency(d, e, true));
+    ASSERT_THROW(workflow->enableBulkDependencyAddition(false), std::runtime_error);
+    workflow->removeControlDependency(d, e);
+    ASSERT_NO_THROW(workflow->enableBulkDependencyAddition(false));
+    ASSERT_THROW(workflow->addControlDependency(d, e), std::runtime_error);
+
+    workflow->clear();
+}
+
+TEST_F(WorkflowTest, ParentChildSpans) {
+    auto children = workflow->getTaskChildrenSpan(t1);
+    ASSERT_EQ(2, children.size());
+    ASSERT_EQ(t2, children[0]);
+    ASSERT_EQ(t3, children[1]);
+    ASSERT_THROW(children.at(2), std::out_of_range);
+
+    auto parents = workflow->getTaskParentsSpan(t4);
+    ASSERT_EQ(2, parents.size());
+    for (auto const &parent: parents) {
+        ASSERT_EQ(1, workflow->getTaskNumberOfChildren(parent));
+    }
+    ASSERT_TRUE(workflow->getTaskParentsSpan(t1).empty());
+    ASSERT_THROW(workflow->getTaskParentsSpan(nullptr), std::invalid_argument);
+
+    // Modifying the graph invalidates spans, and new ones reflect the modification
+    auto t5 = workflow->addTask("task1-test-05", 1, 1, 1, 0);
+    workflow->addControlDependency(t4, t5);
+    ASSERT_EQ(1, workflow->getTaskChildrenSpan(t4).size());
+    ASSERT_EQ(t4, workflow->getTaskParentsSpan(t5)[0]);
+    ASSERT_EQ(workflow->getTaskChildren(t1).size(), workflow->getTaskChildrenSpan(t1).size());
+
+    // Children can also be visited, frozen or not, while the graph is being modified
+    auto t6 = workflow->addTask("task1-test-06", 1, 1, 1, 0);
+    workflow->addControlDependency(t4, t6);
+    std::vector<wrench::WorkflowTask *> visited;
+    t4->forEachChild([&visited](wrench::WorkflowTask *child) { visited.push_back(child); });
+    ASSERT_EQ(2, visited.size());
+    ASSERT_TRUE(std::find(visited.begin(), visited.end(), t5.get()) != visited.end());
+    ASSERT_TRUE(std::find(visited.begin(), visited.end(), t6.get()) != visited.end());
+    visited.clear();
+    ASSERT_EQ(2, workflow->getTaskChildrenSpan(t4).size());
+    t4->forEachChild([&visited](wrench::WorkflowTask *child) { visited.push_back(child); });
+    ASSERT_EQ(2, visited.size());
+}
+
+TEST_F(WorkflowTest, IncompleteParentCounts) {
+    ASSERT_EQ(0, t1->getNumberOfIncompleteParents());
+    ASSERT_EQ(1, t2->getNumberOfIncompleteParents());
+    ASSERT_EQ(2, t4->getNumberOfIncompleteParents());
+
+    ASSERT_EQ(2, t1->getChildrenSpan().size());
+    ASSERT_EQ(2, t4->getParentsSpan().size());
+
+    t1->setState(wrench::WorkflowTask::State::COMPLETED);
+    ASSERT_EQ(0, t2->getNumberOfIncompleteParents());
+    ASSERT_EQ(0, t3->getNumberOfIncompleteParents());
+    t2->setState(wrench::WorkflowTask::State::COMPLETED);
+    ASSERT_EQ(1, t4->getNumberOfIncompleteParents());
+
+    // A task that is no longer completed counts again
+    t2->setState(wrench::WorkflowTask::State::NOT_READY);
+    ASSERT_EQ(2, t4->getNumberOfIncompleteParents());
+
+    // Dependency removal and addition
+    workflow->removeControlDependency(t3, t4);
+    ASSERT_EQ(2, t4->getNumberOfIncompleteParents());// t3 -> t4 is also a data dependency
+    auto t5 = workflow->addTask("task1-test-05", 1, 1, 1, 0);
+    workflow->addControlDependency(t1, t5);
+    ASSERT_EQ(0, t5->getNumberOfIncompleteParents());
+    workflow->addControlDependency(t5, t4);
+    ASSERT_EQ(3, t4->getNumberOfIncompleteParents());
+
+    // Task removal
+    workflow->removeTask(t5);
+    ASSERT_EQ(2, t4->getNumberOfIncompleteParents());
+}
+
+TEST_F(WorkflowTest, TopBottomLevelsLazy) {
+    auto workflow = wrench::Workflow::createWorkflow();
+    workflow->enableTopBottomLevelLazyUpdates(true);
+
+    // A deep chain (levels are computed iteratively, upon the first query)
+    const int chain_length = 50000;
+    std::shared_ptr<wrench::WorkflowTask> previous = nullptr;
+    std::shared_ptr<wrench::WorkflowTask> first = nullptr;
+    for (int i = 0; i < chain_length; i++) {
+        auto task = workflow->addTask("chain-" + std::to_string(i), 1, 1, 1, 0);
+        if (previous) {
+            workflow->addControlDependency(previous, task);
+        } else {
+            first = task;
+        }
+        previous = task;
+    }
+    ASSERT_EQ(chain_length - 1, previous->getTopLevel());
+    ASSERT_EQ(chain_length - 1, first->getBottomLevel());
+    ASSERT_EQ(chain_length, workflow->getNumLevels());
+
+    // Modifications after a query mark levels as stale again
+    auto extra = workflow->addTask("extra", 1, 1, 1, 0);
+    workflow->addControlDependency(previous, extra);
+    ASSERT_EQ(chain_length, extra->getTopLevel());
+    ASSERT_EQ(chain_length, first->getBottomLevel());
+
+    // Back to dynamic updates
+    workflow->enableTopBottomLevelLazyUpdates(false);
+    workflow->removeTask(extra);
+    ASSERT_EQ(chain_length - 1, first->getBottomLevel());
+
+    workflow->clear();
+}
+
+TEST_F(WorkflowTest, EntryExitAndLevelIndices) {
+    ASSERT_EQ(1, workflow->getEntryTasks().size());
+    ASSERT_EQ(t1, workflow->getEntryTasks()[0]);
+    ASSERT_EQ(1, workflow->getExitTaskMap().size());
+    ASSERT_EQ(t4, workflow->getExitTaskMap()["task1-test-04"]);
+
+    // Tasks in a level range are sorted by ID, regardless of their levels
+    auto t0 = workflow->addTask("task1-test-00", 1, 1, 1, 0);
+    workflow->addControlDependency(t4, t0);
+    auto tasks = workflow->getTasksInTopLevelRange(-5, 100);
+    ASSERT_EQ(5, tasks.size());
+    ASSERT_EQ(t0, tasks[0]);
+    ASSERT_EQ(t1, tasks[1]);
+    ASSERT_EQ(t2, tasks[2]);
+    ASSERT_EQ(t3, tasks[3]);
+    ASSERT_EQ(t4, tasks[4]);
+    tasks = workflow->getTasksInBottomLevelRange(0, 1);
+    ASSERT_EQ(2, tasks.size());
+    ASSERT_EQ(t0, tasks[0]);
+    ASSERT_EQ(t4, tasks[1]);
+    workflow->removeTask(t0);
+    ASSERT_EQ(2, workflow->getTasksInBottomLevelRange(1, 1).size());
+    ASSERT_TRUE(workflow->getTasksInBottomLevelRange(3, 5).empty());
+
+    // Adding a task and dependencies
+    auto t5 = workflow->addTask("task1-test-05", 1, 1, 1, 0);
+    ASSERT_EQ(2, workflow->getEntryTasks().size());
+    ASSERT_EQ(2, workflow->getExitTasks().size());
+    workflow->addControlDependency(t4, t5);
+    ASSERT_EQ(1, workflow->getEntryTasks().size());
+    ASSERT_EQ(t5, workflow->getExitTasks()[0]);
+    ASSERT_EQ(4, workflow->getNumLevels());
+    ASSERT_EQ(t5, workflow->getTasksInTopLevelRange(3, 3)[0]);
+    ASSERT_EQ(t1, workflow->getTasksInBottomLevelRange(3, 3)[0]);
+
+    // Removing a dependency and a task
+    workflow->removeControlDependency(t4, t5);
+    ASSERT_EQ(2, workflow->getEntryTasks().size());
+    ASSERT_EQ(2, workflow->getExitTasks().size());
+    ASSERT_EQ(3, workflow->getNumLevels());
+    workflow->removeTask(t4);
+    ASSERT_EQ(3, workflow->getExitTasks().size());
+    ASSERT_EQ(2, workflow->getNumLevels());
+    ASSERT_EQ(2, workflow->getTasksInTopLevelRange(1, 1).size());
+    ASSERT_EQ(4, workflow->getTasksInBottomLevelRange(0, 1).size());
+}
+
+TEST_F(WorkflowTest, ReadyClusters) {
+    ASSERT_EQ(1, workflow->getReadyTaskSet().size());
+    ASSERT_EQ(1, workflow->getReadyTasksByCluster().count("task1-test-01"));
+
+    // Clustering tasks moves the ready ones between groups
+    t1->setClusterID("cluster-01");
+    t2->setClusterID("cluster-01");
+    t3->setClusterID("cluster-02");
+    auto const &by_cluster = workflow->getReadyTasksByCluster();
+    ASSERT_EQ(1, by_cluster.size());
+    ASSERT_EQ(t1, by_cluster.at("cluster-01").at("task1-test-01"));
+
+    // A ready cluster includes its not-ready tasks, a cluster without ready tasks is not ready
+    auto t5 = workflow->addTask("task1-test-05", 1, 1, 1, 0);
+    auto clusters = workflow->getReadyClusters();
+    ASSERT_EQ(2, clusters.size());
+    ASSERT_EQ(2, clusters["cluster-01"].size());
+    ASSERT_EQ(t1, clusters["cluster-01"][0]);
+    ASSERT_EQ(t2, clusters["cluster-01"][1]);
+    ASSERT_EQ(1, clusters["task1-test-05"].size());
+    ASSERT_EQ(2, by_cluster.size());
+
+    // Tasks leaving the ready set leave their cluster
+    workflow->addControlDependency(t4, t5);
+    ASSERT_EQ(1, by_cluster.size());
+    t1->setClusterID("");
+    ASSERT_EQ(1, by_cluster.count("task1-test-01"));
+    ASSERT_EQ(1, workflow->getReadyClusters().size());
+
+    // Tasks entering the ready set join their cluster
+    workflow->removeTask(t1);
+    ASSERT_EQ(2, by_cluster.size());
+    ASSERT_EQ(t2, by_cluster.at("cluster-01").at("task1-test-02"));
+    ASSERT_EQ(t3, by_cluster.at("cluster-02").at("task1-test-03"));
+    ASSERT_EQ(2, workflow->getReadyTaskSet().size());
+}
@@ -12,6 +12,7 @@
 #include <wrench/util/UnitParser.h>
 
 #include <iostream>
+#include <map>
 #include <vector>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -21,239 +22,590 @@ WRENCH_LOG_CATEGORY(wfcommons_workflow_parser, "Log category for WfCommonsWorkfl
 
 
 namespace wrench {
+
     /**
-     * Documentation in .h file
+     * @brief A SAX handler that builds a workflow while a WfFormat JSON document is being parsed, so
+     *        that the document is never held in memory as a whole: only the element (a file, a task,
+     *        a machine) being read is. What cannot be processed when it is read (task dependencies,
+     *        and task/file associations or task executions that refer to parts of the document that come
+     *        later) is kept in compact records, and processed once the whole document has been read.
      */
-    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSON(const std::string& filename,
-                                                                              const std::string& reference_flop_rate,
-                                                                              bool ignore_machine_specs,
-                                                                              bool redundant_dependencies,
-                                                                              bool ignore_cycle_creating_dependencies,
-                                                                              unsigned long min_cores_per_task,
-                                                                              unsigned long max_cores_per_task,
-                                                                              bool enforce_num_cores,
-                                                                              bool ignore_avg_cpu,
-                                                                              bool show_warnings) {
-        std::ifstream file;
-        // handle exceptions when opening the json file
-        file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-        try {
-            file.open(filename);
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            return WfCommonsWorkflowParser::createWorkflowFromJSONString(
-                buffer.str(), reference_flop_rate, ignore_machine_specs,
-                redundant_dependencies,
-                ignore_cycle_creating_dependencies,
-                min_cores_per_task,
-                max_cores_per_task,
-                enforce_num_cores,
-                ignore_avg_cpu,
-                show_warnings);
-        }
-        catch (const std::ifstream::failure& e) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file (" + std::string(e.what()) + ")");
+    class WfCommonsJSONStreamParser {
+
+    public:
+        /** @brief JSON integer type */
+        using number_integer_t = nlohmann::json::number_integer_t;
+        /** @brief JSON unsigned integer type */
+        using number_unsigned_t = nlohmann::json::number_unsigned_t;
+        /** @brief JSON floating point type */
+        using number_float_t = nlohmann::json::number_float_t;
+        /** @brief JSON string type */
+        using string_t = nlohmann::json::string_t;
+        /** @brief JSON binary type */
+        using binary_t = nlohmann::json::binary_t;
+
+        /**
+         * @brief Constructor (see WfCommonsWorkflowParser::createWorkflowFromJSON() for the arguments)
+         */
+        WfCommonsJSONStreamParser(double flop_rate,
+                                  bool ignore_machine_specs,
+                                  bool redundant_dependencies,
+                                  bool ignore_cycle_creating_dependencies,
+                                  unsigned long min_cores_per_task,
+                                  unsigned long max_cores_per_task,
+                                  bool enforce_num_cores,
+                                  bool ignore_avg_cpu,
+                                  bool show_warnings) : flop_rate(flop_rate),
+                                                        ignore_machine_specs(ignore_machine_specs),
+                                                        redundant_dependencies(redundant_dependencies),
+                                                        ignore_cycle_creating_dependencies(ignore_cycle_creating_dependencies),
+                                                        min_cores_per_task(min_cores_per_task),
+                                                        max_cores_per_task(max_cores_per_task),
+                                                        enforce_num_cores(enforce_num_cores),
+                                                        ignore_avg_cpu(ignore_avg_cpu),
+                                                        show_warnings(show_warnings) {
+            // Create a new workflow object. Note that we do not use the name
+            // in the WfInstance but instead generate a generic unique name
+            // in the constructor below
+            this->workflow = Workflow::createWorkflow();
+            this->workflow->enableTopBottomLevelDynamicUpdates(false);
         }
-    }
 
-    /**
-    * Documentation in .h file
-    */
-    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSONString(const std::string& json_string,
-        const std::string& reference_flop_rate,
-        bool ignore_machine_specs,
-        bool redundant_dependencies,
-        bool ignore_cycle_creating_dependencies,
-        unsigned long min_cores_per_task,
-        unsigned long max_cores_per_task,
-        bool enforce_num_cores,
-        bool ignore_avg_cpu,
-        bool show_warnings) {
-        std::set<std::string> ignored_auxiliary_jobs;
-        std::set<std::string> ignored_transfer_jobs;
-
-        // Create a new workflow object. Note that we do not use the name
-        // in the WfInstance but instead generate a generic unique name
-        // in the constructor below
-        auto workflow = Workflow::createWorkflow();
-        workflow->enableTopBottomLevelDynamicUpdates(false);
-
-        double flop_rate;
-
-        try {
-            flop_rate = UnitParser::parse_compute_speed(reference_flop_rate);
-        }
-        catch (std::invalid_argument&) {
-            throw;
+        /** @brief SAX callback */
+        bool null() { return this->value(nullptr); }
+        /** @brief SAX callback */
+        bool boolean(bool val) { return this->value(val); }
+        /** @brief SAX callback */
+        bool number_integer(number_integer_t val) { return this->value(val); }
+        /** @brief SAX callback */
+        bool number_unsigned(number_unsigned_t val) { return this->value(val); }
+        /** @brief SAX callback */
+        bool number_float(number_float_t val, const string_t &) { return this->value(val); }
+        /** @brief SAX callback */
+        bool string(string_t &val) { return this->value(std::move(val)); }
+        /** @brief SAX callback (binary values do not occur in JSON documents) */
+        bool binary(binary_t &) { return true; }
+
+        /** @brief SAX callback */
+        bool key(string_t &val) {
+            this->current_key = std::move(val);
+            return true;
         }
 
-        nlohmann::json j = nlohmann::json::parse(json_string);
+        /** @brief SAX callback */
+        bool start_object(std::size_t) {
+            if (not this->element_stack.empty()) {
+                this->element_stack.push_back(this->insert(nlohmann::json::object()));
+                return true;
+            }
+            auto object_path = this->childPath();
+            if (object_path == "/workflow/specification/files/*") {
+                this->element_kind = FILE_SPEC;
+            } else if (object_path == "/workflow/specification/tasks/*") {
+                this->element_kind = TASK_SPEC;
+            } else if (object_path == "/workflow/execution/tasks/*") {
+                this->element_kind = TASK_EXECUTION;
+            } else if (object_path == "/workflow/execution/machines/*") {
+                this->element_kind = MACHINE_SPEC;
+            } else {
+                if (object_path == "/workflow") {
+                    this->has_workflow = true;
+                } else if (object_path == "/workflow/execution") {
+                    this->has_execution = true;
+                }
+                this->path.push_back(object_path);
+                this->path_is_array.push_back(false);
+                return true;
+            }
+            this->element = nlohmann::json::object();
+            this->element_stack.push_back(&this->element);
+            return true;
+        }
 
-        // Check schema version
-        nlohmann::json schema_version;
-        try {
-            schema_version = j.at("schemaVersion");
-        } catch (std::out_of_range&) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'schema_version' key");
+        /** @brief SAX callback */
+        bool end_object() {
+            if (not this->element_stack.empty()) {
+                this->element_stack.pop_back();
+                if (this->element_stack.empty()) {
+                    this->processElement();
+                }
+                return true;
+            }
+            this->path.pop_back();
+            this->path_is_array.pop_back();
+            return true;
         }
-        if (schema_version != "1.5") {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Only handles WfFormat schema version 1.5 "
-                "(use the script at https://github.com/wfcommons/WfFormat/tree/main/tools/ to update your workflow instances).");
+
+        /** @brief SAX callback */
+        bool start_array(std::size_t) {
+            if (not this->element_stack.empty()) {
+                this->element_stack.push_back(this->insert(nlohmann::json::array()));
+                return true;
+            }
+            this->path.push_back(this->childPath());
+            this->path_is_array.push_back(true);
+            return true;
         }
 
-        nlohmann::json workflow_spec;
-        try {
-            workflow_spec = j.at("workflow");
+        /** @brief SAX callback */
+        bool end_array() {
+            if (not this->element_stack.empty()) {
+                this->element_stack.pop_back();
+                return true;
+            }
+            if (this->path.back() == "/workflow/specification/files") {
+                this->files_are_known = true;
+            } else if (this->path.back() == "/workflow/specification/tasks") {
+                this->tasks_are_known = true;
+                this->processPendingTaskExecutions();
+            } else if (this->path.back() == "/workflow/execution/machines") {
+                this->machines_are_known = true;
+                this->processPendingTaskExecutions();
+            }
+            this->path.pop_back();
+            this->path_is_array.pop_back();
+            return true;
         }
-        catch (std::out_of_range&) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow' key");
+
+        /**
+         * @brief SAX callback
+         * @param ex: the parse error
+         * @return never returns (the error is thrown)
+         */
+        template<class Exception>
+        bool parse_error(std::size_t, const std::string &, const Exception &ex) {
+            throw ex;
         }
 
+        /**
+         * @brief Complete the workflow once the whole document has been parsed
+         * @return a workflow
+         */
+        std::shared_ptr<Workflow> finish() {
+            if (not this->has_schema_version) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'schema_version' key");
+            }
+            if (not this->has_workflow) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow' key");
+            }
+            // Require the workflow/execution key
+            if (not this->has_execution) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): The WfInstance doesn't contain a 'workflow/execution' key. "
+                        "Although this key isn't required in the WfInstances format, WRENCH requires it to determine task "
+                        "flop rates based on measured task execution times.");
+            }
+            if (not this->tasks_are_known) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow/specification/tasks' key");
+            }
 
-        // Require the workflow/execution key
-        if (not workflow_spec.contains("execution")) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): The WfInstance doesn't contain a 'workflow/execution' key. "
-                "Although this key isn't required in the WfInstances format, WRENCH requires it to determine task "
-                "flop rates based on measured task execution times.");
-        }
+            // Add the input/output files of the tasks that were read before the files
+            for (auto &task_spec: this->task_specs) {
+                this->addTaskFiles(task_spec);
+            }
 
-        // Gather machine information if any
-        std::map<std::string, std::pair<unsigned long, double>> machines;
-        if (workflow_spec.at("execution").contains("machines")) {
-            auto machine_specs = workflow_spec.at("execution").at("machines");
-            for (auto const& machine_spec : machine_specs) {
-                std::string name = machine_spec.at("nodeName");
-                nlohmann::json core_spec = machine_spec.at("cpu");
-                unsigned long num_cores;
-                try {
-                    num_cores = core_spec.at("coreCount");
+            // Fill in the task specifications based on the executions that were read before the
+            // tasks and the machines
+            this->tasks_are_known = this->machines_are_known = true;
+            this->processPendingTaskExecutions();
+
+            // Deal with task dependencies. If cycle-creating dependencies are not to be ignored
+            // (and redundant dependencies are kept), add them all in bulk and check for cycles only once
+            bool bulk_dependency_addition = this->redundant_dependencies and (not this->ignore_cycle_creating_dependencies);
+            this->workflow->enableBulkDependencyAddition(bulk_dependency_addition);
+            for (auto const &task_spec: this->task_specs) {
+                for (auto const &parent: task_spec.parents) {
+                    this->addDependency(parent, task_spec.task->getID());
                 }
-                catch (nlohmann::detail::out_of_range&) {
-                    num_cores = 1;
-                } catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(
-                            e.what()));
+                for (auto const &child: task_spec.children) {
+                    this->addDependency(task_spec.task->getID(), child);
                 }
-                double mhz;
+            }
+
+            if (bulk_dependency_addition) {
                 try {
-                    mhz = core_spec.at("speedInMHz");
+                    this->workflow->enableBulkDependencyAddition(false);
+                } catch (std::runtime_error &) {
+                    throw std::runtime_error(
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Task dependencies create a cycle in the workflow graph");
                 }
-                catch (nlohmann::detail::out_of_range&) {
-                    if (show_warnings) std::cerr << "[WARNING]: Machine " + name + " does not define a speed\n";
-                    mhz = -1.0; // unknown
-                } catch (nlohmann::detail::type_error& e) {
+            }
+
+            // Update all top/bottom levels computations again
+            this->workflow->enableTopBottomLevelDynamicUpdates(true);
+            this->workflow->updateAllTopBottomLevels();
+
+            return this->workflow;
+        }
+
+        /**
+         * @brief Remove the files that were added to the simulation while parsing (used when parsing fails,
+         *        since missing keys are only detected once the whole document has been read)
+         */
+        void removeAddedFiles() {
+            for (auto const &file: this->added_files) {
+                Simulation::removeFile(file);
+            }
+            this->added_files.clear();
+        }
+
+    private:
+        /* The kinds of document elements that are processed one at a time */
+        enum ElementKind {
+            FILE_SPEC,
+            TASK_SPEC,
+            TASK_EXECUTION,
+            MACHINE_SPEC
+        };
+
+        /* What is kept of a task specification until the whole document has been read */
+        struct TaskSpecRecord {
+            std::shared_ptr<WorkflowTask> task;
+            std::vector<std::string> input_files;
+            std::vector<std::string> output_files;
+            std::vector<std::string> parents;
+            std::vector<std::string> children;
+        };
+
+        /* What is kept of a task execution until the task and the machines are known */
+        struct TaskExecutionRecord {
+            std::string id;
+            double runtime_in_seconds = 0.0;
+            double avg_cpu = -1.0;
+            unsigned long num_cores = 0;
+            bool has_core_count = false;
+            bool has_machines = false;
+            std::vector<std::string> machines;
+            double ram_in_bytes = 0.0;
+            bool has_priority = false;
+            long priority = 0;
+            bool has_read_bytes = false;
+            unsigned long read_bytes = 0;
+            bool has_written_bytes = false;
+            unsigned long written_bytes = 0;
+        };
+
+        double flop_rate;
+        bool ignore_machine_specs;
+        bool redundant_dependencies;
+        bool ignore_cycle_creating_dependencies;
+        unsigned long min_cores_per_task;
+        unsigned long max_cores_per_task;
+        bool enforce_num_cores;
+        bool ignore_avg_cpu;
+        bool show_warnings;
+
+        std::shared_ptr<Workflow> workflow;
+        std::map<std::string, std::pair<unsigned long, double>> machines;
+        std::vector<TaskSpecRecord> task_specs;
+        std::vector<TaskExecutionRecord> pending_task_executions;
+        /* The files that were added to the simulation (as opposed to already known) */
+        std::vector<std::shared_ptr<DataFile>> added_files;
+
+        bool has_schema_version = false;
+        bool has_workflow = false;
+        bool has_execution = false;
+        bool files_are_known = false;
+        bool tasks_are_known = false;
+        bool machines_are_known = false;
+
+        /* Paths (e.g., "/workflow/specification/tasks") of the enclosing containers, outside elements */
+        std::vector<std::string> path;
+        std::vector<bool> path_is_array;
+        std::string current_key;
+
+        /* The element being read */
+        ElementKind element_kind = FILE_SPEC;
+        nlohmann::json element;
+        std::vector<nlohmann::json *> element_stack;
+
+        /**
+         * @brief Compute the path of a container that is being opened
+         * @return a path
+         */
+        std::string childPath() const {
+            if (this->path.empty()) {
+                return "";
+            }
+            return this->path.back() + "/" + (this->path_is_array.back() ? "*" : this->current_key);
+        }
+
+        /**
+         * @brief Insert a value in the container at the top of the element stack
+         * @param val: the value
+         * @return a pointer to the inserted value
+         */
+        nlohmann::json *insert(nlohmann::json &&val) {
+            auto container = this->element_stack.back();
+            if (container->is_array()) {
+                container->push_back(std::move(val));
+                return &container->back();
+            }
+            auto &slot = (*container)[this->current_key];
+            slot = std::move(val);
+            return &slot;
+        }
+
+        /**
+         * @brief Handle a scalar value
+         * @param val: the value
+         * @return true
+         */
+        bool value(nlohmann::json &&val) {
+            if (not this->element_stack.empty()) {
+                this->insert(std::move(val));
+                return true;
+            }
+            if ((this->path.size() == 1) and (this->current_key == "schemaVersion")) {
+                // Check schema version
+                if (val != "1.5") {
                     throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid speedInMhz value: " + std::string(
-                            e.what()));
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Only handles WfFormat schema version 1.5 "
+                            "(use the script at https://github.com/wfcommons/WfFormat/tree/main/tools/ to update your workflow instances).");
                 }
-                machines[name] = std::make_pair(num_cores, mhz);
+                this->has_schema_version = true;
+            } else if ((not this->path.empty()) and this->path_is_array.back() and
+                       ((this->path.back() == "/workflow/specification/files") or
+                        (this->path.back() == "/workflow/specification/tasks") or
+                        (this->path.back() == "/workflow/execution/tasks") or
+                        (this->path.back() == "/workflow/execution/machines"))) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid (non-object) item in " + this->path.back());
             }
+            return true;
         }
 
-        // Process the files, if any
-        if (workflow_spec.at("specification").contains("files")) {
-            auto file_specs = workflow_spec.at("specification").at("files");
-            for (auto const& file_spec : file_specs) {
-                std::string file_name = file_spec.at("id");
-                std::shared_ptr<DataFile> data_file;
-                try {
-                    Simulation::getFileByID(file_name);
-                }
-                catch (const std::invalid_argument&) {
-                    // making a new file
-                    sg_size_t file_size = file_spec.at("sizeInBytes");
-                    Simulation::addFile(file_name, file_size);
-                }
+        /**
+         * @brief Process the element that has just been read, and discard it
+         */
+        void processElement() {
+            switch (this->element_kind) {
+                case FILE_SPEC:
+                    this->processFileSpec(this->element);
+                    break;
+                case TASK_SPEC:
+                    this->processTaskSpec(this->element);
+                    break;
+                case TASK_EXECUTION:
+                    this->processTaskExecution(this->element);
+                    break;
+                case MACHINE_SPEC:
+                    this->processMachineSpec(this->element);
+                    break;
             }
+            this->element = nullptr;
         }
 
-        // Create the tasks with input/output files
-        auto task_specs = workflow_spec.at("specification").at("tasks");
-        for (const auto& task_spec : task_specs) {
-            auto task_name = task_spec.at("name");
-            auto task_id = task_spec.at("id");
-            // Create a task with all kinds of default fields for now
-            //            std::cerr << "CREATED TASK: " << task_id << "\n";
-            auto task = workflow->addTask(task_id, 0.0, 1, 1, 0.0);
+        /**
+         * @brief Process a machine specification
+         * @param machine_spec: the machine specification
+         */
+        void processMachineSpec(const nlohmann::json &machine_spec) {
+            std::string name = machine_spec.at("nodeName");
+            nlohmann::json core_spec = machine_spec.at("cpu");
+            unsigned long num_cores;
+            try {
+                num_cores = core_spec.at("coreCount");
+            } catch (nlohmann::detail::out_of_range &) {
+                num_cores = 1;
+            } catch (nlohmann::detail::type_error &e) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(e.what()));
+            }
+            double mhz;
+            try {
+                mhz = core_spec.at("speedInMHz");
+            } catch (nlohmann::detail::out_of_range &) {
+                if (this->show_warnings) std::cerr << "[WARNING]: Machine " + name + " does not define a speed\n";
+                mhz = -1.0;// unknown
+            } catch (nlohmann::detail::type_error &e) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid speedInMhz value: " + std::string(e.what()));
+            }
+            this->machines[name] = std::make_pair(num_cores, mhz);
+        }
 
+        /**
+         * @brief Process a file specification
+         * @param file_spec: the file specification
+         */
+        void processFileSpec(const nlohmann::json &file_spec) {
+            std::string file_name = file_spec.at("id");
+            if (not Simulation::getFileByIDOrNull(file_name)) {
+                // making a new file
+                sg_size_t file_size = file_spec.at("sizeInBytes");
+                this->added_files.push_back(Simulation::addFile(file_name, file_size));
+            }
+        }
+
+        /**
+         * @brief Process a task specification
+         * @param task_spec: the task specification
+         */
+        void processTaskSpec(const nlohmann::json &task_spec) {
+            // Create a task with all kinds of default fields for now
+            TaskSpecRecord record;
+            record.task = this->workflow->addTask(task_spec.at("id"), 0.0, 1, 1, 0.0);
             if (task_spec.contains("inputFiles")) {
-                for (auto const& f : task_spec.at("inputFiles")) {
-                    auto file = Simulation::getFileByID(f);
-                    task->addInputFile(file);
-                    //                    std::cerr << "  ADDED INPUT FILE: " << file->getID() << "\n";
-                }
+                record.input_files = task_spec.at("inputFiles").get<std::vector<std::string>>();
             }
             if (task_spec.contains("outputFiles")) {
-                for (auto const& f : task_spec.at("outputFiles")) {
-                    auto file = Simulation::getFileByID(f);
-                    task->addOutputFile(file);
-                    //                    std::cerr << "  ADDED OUTPUT FILE: " << file->getID() << "\n";
-                }
+                record.output_files = task_spec.at("outputFiles").get<std::vector<std::string>>();
             }
+            record.parents = task_spec.at("parents").get<std::vector<std::string>>();
+            record.children = task_spec.at("children").get<std::vector<std::string>>();
+            if (this->files_are_known) {
+                this->addTaskFiles(record);
+            }
+            this->task_specs.push_back(std::move(record));
         }
 
-        // Fill in the task specifications based on the execution
-        auto task_execs = workflow_spec.at("execution").at("tasks");
-        for (const auto& task_exec : task_execs) {
-            auto task = workflow->getTaskByID(task_exec.at("id"));
+        /**
+         * @brief Add its input/output files to a task, and forget about them
+         * @param record: the task's record
+         */
+        static void addTaskFiles(TaskSpecRecord &record) {
+            for (auto const &f: record.input_files) {
+                record.task->addInputFile(Simulation::getFileByID(f));
+            }
+            for (auto const &f: record.output_files) {
+                record.task->addOutputFile(Simulation::getFileByID(f));
+            }
+            std::vector<std::string>().swap(record.input_files);
+            std::vector<std::string>().swap(record.output_files);
+        }
+
+        /**
+         * @brief Process a task execution
+         * @param task_exec: the task execution
+         */
+        void processTaskExecution(const nlohmann::json &task_exec) {
+            TaskExecutionRecord record;
+            record.id = task_exec.at("id").get<std::string>();
 
             // Deal with the runtime
-            double avg_cpu = -1.0;
             try {
-                avg_cpu = task_exec.at("avgCPU");
-            } catch (nlohmann::json::out_of_range&) {
+                record.avg_cpu = task_exec.at("avgCPU");
+            } catch (nlohmann::json::out_of_range &) {
                 // do nothing
-            } catch (nlohmann::detail::type_error& e) {
+            } catch (nlohmann::detail::type_error &e) {
                 throw std::invalid_argument(
-                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid avgCPU value: " + std::string(
-                        e.what()));
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid avgCPU value: " + std::string(e.what()));
             }
 
-            unsigned long num_cores = 0;
             try {
-                num_cores = task_exec.at("coreCount");
-            } catch (nlohmann::json::out_of_range&) {
+                record.num_cores = task_exec.at("coreCount");
+                record.has_core_count = true;
+            } catch (nlohmann::json::out_of_range &) {
                 // do nothing
-            } catch (nlohmann::detail::type_error& e) {
+            } catch (nlohmann::detail::type_error &e) {
                 throw std::invalid_argument(
-                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(
-                        e.what()));
-            }
-            if (num_cores == 0) {
-                if (show_warnings) std::cerr << "[WARNING]: Task " << task->getID() <<
-                    " specifies an invalid number of cores (" + std::to_string(num_cores) +
-                    "): Assuming 1 core instead.\n";
-                num_cores = 1;
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(e.what()));
             }
 
-            double runtimeInSeconds;
             try {
-                runtimeInSeconds = task_exec.at("runtimeInSeconds");
-            } catch (nlohmann::detail::type_error& e) {
+                record.runtime_in_seconds = task_exec.at("runtimeInSeconds");
+            } catch (nlohmann::detail::type_error &e) {
                 throw std::invalid_argument(
-                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid runtimeInSeconds value: " + std::string(
-                        e.what()));
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid runtimeInSeconds value: " + std::string(e.what()));
+            }
+
+            if (task_exec.contains("machines")) {
+                record.has_machines = true;
+                record.machines = task_exec.at("machines").get<std::vector<std::string>>();
+            }
+
+            // Deal with RAM, if any
+            if (task_exec.contains("memoryInBytes")) {
+                try {
+                    record.ram_in_bytes = task_exec.at("memoryInBytes");
+                } catch (nlohmann::detail::type_error &e) {
+                    throw std::invalid_argument(
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid memoryInBytes value: " +
+                            std::string(e.what()));
+                }
+            }
+
+            // Deal with the priority, if any
+            if (task_exec.contains("priority")) {
+                try {
+                    record.priority = task_exec.at("priority");
+                    record.has_priority = true;
+                } catch (nlohmann::detail::type_error &e) {
+                    throw std::invalid_argument(
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid priority value: " + std::string(e.what()));
+                }
+            }
+
+            // Deal with written/read bytes, if any
+            if (task_exec.contains("readBytes")) {
+                try {
+                    record.read_bytes = task_exec.at("readBytes");
+                    record.has_read_bytes = true;
+                } catch (nlohmann::detail::type_error &e) {
+                    throw std::invalid_argument(
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid readBytes value: " + std::string(e.what()));
+                }
+            }
+            if (task_exec.contains("writtenBytes")) {
+                try {
+                    record.written_bytes = task_exec.at("writtenBytes");
+                    record.has_written_bytes = true;
+                } catch (nlohmann::detail::type_error &e) {
+                    throw std::invalid_argument(
+                            "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid writtenBytes value: " + std::string(e.what()));
+                }
+            }
+
+            if (this->tasks_are_known and this->machines_are_known) {
+                this->applyTaskExecution(record);
+            } else {
+                this->pending_task_executions.push_back(std::move(record));
+            }
+        }
+
+        /**
+         * @brief Apply the task executions that could not be applied when read, if the tasks
+         *        and the machines are now known
+         */
+        void processPendingTaskExecutions() {
+            if (not(this->tasks_are_known and this->machines_are_known)) {
+                return;
+            }
+            for (auto const &record: this->pending_task_executions) {
+                this->applyTaskExecution(record);
+            }
+            std::vector<TaskExecutionRecord>().swap(this->pending_task_executions);
+        }
+
+        /**
+         * @brief Fill in a task specification based on its execution
+         * @param record: the task execution
+         */
+        void applyTaskExecution(const TaskExecutionRecord &record) {
+            auto task = this->workflow->getTaskByID(record.id);
+
+            double avg_cpu = record.avg_cpu;
+            unsigned long num_cores = record.num_cores;
+            if (num_cores == 0) {
+                if (this->show_warnings) std::cerr << "[WARNING]: Task " << task->getID() << " specifies an invalid number of cores (" + std::to_string(num_cores) + "): Assuming 1 core instead.\n";
+                num_cores = 1;
             }
 
             // Scale runtime based on avgCPU unless disabled
-            if (not ignore_avg_cpu) {
+            if (not this->ignore_avg_cpu) {
                 if (avg_cpu < 0) {
-                    if (show_warnings)
-                        std::cerr << "[WARNING]: Task " << task->getID() <<
-                            " does not specify an avgCPU: "
-                            "Assuming avgCPU at 100%.\n";
+                    if (this->show_warnings)
+                        std::cerr << "[WARNING]: Task " << task->getID() << " does not specify an avgCPU: "
+                                                                            "Assuming avgCPU at 100%.\n";
                     avg_cpu = 100.0;
                 } else if (avg_cpu > 100.0 * num_cores) {
-                    if (show_warnings) {
-                        std::cerr << "[WARNING]: Task " << task->getID() << " specifies " << static_cast<unsigned long>(
-                                num_cores) << " cores and avgCPU " << avg_cpu << "%, "
-                            << "which is impossible: Assuming avgCPU " << 100.0 * num_cores << " instead.\n";
+                    if (this->show_warnings) {
+                        std::cerr << "[WARNING]: Task " << task->getID() << " specifies " << static_cast<unsigned long>(num_cores) << " cores and avgCPU " << avg_cpu << "%, "
+                                  << "which is impossible: Assuming avgCPU " << 100.0 * num_cores << " instead.\n";
                     }
                     avg_cpu = 100.0 * num_cores;
                 }
@@ -261,15 +613,15 @@ namespace wrench {
                 avg_cpu = 100.0 * num_cores;
             }
 
-            runtimeInSeconds = runtimeInSeconds * avg_cpu / (100.0 * num_cores);
+            double runtimeInSeconds = record.runtime_in_seconds * avg_cpu / (100.0 * num_cores);
 
             // Deal with the number of cores
             unsigned long min_num_cores, max_num_cores;
             // Set the default values
-            min_num_cores = min_cores_per_task;
-            max_num_cores = max_cores_per_task;
+            min_num_cores = this->min_cores_per_task;
+            max_num_cores = this->max_cores_per_task;
             // Overwrite the default is we don't enforce the default values AND the JSON specifies core numbers
-            if ((not enforce_num_cores) and task_exec.contains("coreCount")) {
+            if ((not this->enforce_num_cores) and record.has_core_count) {
                 min_num_cores = num_cores;
                 max_num_cores = num_cores;
             }
@@ -277,140 +629,187 @@ namespace wrench {
             // Deal with the flop amount
             double flop_amount;
             std::string execution_machine;
-            if (task_exec.contains("machines") and !machines.empty()) {
-                std::vector<std::string> task_machines = task_exec.at("machines");
-                if (task_machines.size() > 1) {
+            if (record.has_machines and !this->machines.empty()) {
+                if (record.machines.size() > 1) {
                     throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
-                        " was executed on multiple machines, which WRENCH currently does not support");
+                            "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
+                            " was executed on multiple machines, which WRENCH currently does not support");
                 }
-                execution_machine = task_machines.at(0);
+                execution_machine = record.machines.at(0);
             }
-            if (ignore_machine_specs or execution_machine.empty()) {
-                flop_amount = runtimeInSeconds * flop_rate;
-            }
-            else {
-                if (machines.find(execution_machine) == machines.end()) {
+            if (this->ignore_machine_specs or execution_machine.empty()) {
+                flop_amount = runtimeInSeconds * this->flop_rate;
+            } else {
+                if (this->machines.find(execution_machine) == this->machines.end()) {
                     throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
-                        " is said to have been executed on machine " + execution_machine +
-                        " but no description for that machine is found on the JSON file");
+                            "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
+                            " is said to have been executed on machine " + execution_machine +
+                            " but no description for that machine is found on the JSON file");
                 }
-                if (machines[execution_machine].second >= 0) {
-                    double core_ghz = (machines[execution_machine].second) / 1000.0;
+                if (this->machines[execution_machine].second >= 0) {
+                    double core_ghz = (this->machines[execution_machine].second) / 1000.0;
                     double total_compute_power_used = core_ghz * static_cast<double>(min_num_cores);
                     double actual_flop_rate = total_compute_power_used * 1000.0 * 1000.0 * 1000.0;
                     flop_amount = runtimeInSeconds * actual_flop_rate;
-                }
-                else {
-                    flop_amount = static_cast<double>(min_num_cores) * runtimeInSeconds * flop_rate;
+                } else {
+                    flop_amount = static_cast<double>(min_num_cores) * runtimeInSeconds * this->flop_rate;
                     // Assume a min-core execution
                 }
             }
 
-            // Deal with RAM, if any
-            double ram_in_bytes = 0.0;
-            if (task_exec.contains("memoryInBytes")) {
-                try {
-                    ram_in_bytes = task_exec.at("memoryInBytes");
-                }
-                catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid memoryInBytes value: " +
-                        std::string(e.what()));
-                }
-            }
-
             // Update the actual task data structure
             task->setFlops(flop_amount);
             task->setMinNumCores(min_num_cores);
             task->setMaxNumCores(max_num_cores);
-            task->setMemoryRequirement(static_cast<sg_size_t>(ram_in_bytes));
-
-            // Deal with the priority, if any
-            if (task_exec.contains("priority")) {
-                long priority;
-                try {
-                    priority = task_exec.at("priority");
-                }
-                catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid priority value: " + std::string(
-                            e.what()));
-                }
-                task->setPriority(priority);
+            task->setMemoryRequirement(static_cast<sg_size_t>(record.ram_in_bytes));
+            if (record.has_priority) {
+                task->setPriority(record.priority);
             }
-
-            // Deal with written/read bytes, if any
-            if (task_exec.contains("readBytes")) {
-                unsigned long readBytes;
-                try {
-                    readBytes = task_exec.at("readBytes");
-                }
-                catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid readBytes value: " + std::string(
-                            e.what()));
-                }
-                task->setBytesRead(readBytes);
+            if (record.has_read_bytes) {
+                task->setBytesRead(record.read_bytes);
             }
-            if (task_exec.contains("writtenBytes")) {
-                unsigned long readBytes;
-                try {
-                    readBytes = task_exec.at("writtenBytes");
-                }
-                catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid writtenBytes value: " + std::string(
-                            e.what()));
-                }
-                task->setBytesWritten(readBytes);
+            if (record.has_written_bytes) {
+                task->setBytesWritten(record.written_bytes);
             }
         }
 
-        // Deal with task dependencies
-        for (auto const& task_spec : task_specs) {
-            auto task = workflow->getTaskByID(task_spec.at("id"));
-
-            for (auto const& parent : task_spec.at("parents")) {
-                try {
-                    auto parent_task = workflow->getTaskByID(parent);
-                    workflow->addControlDependency(parent_task, task, redundant_dependencies);
-                }
-                catch (std::invalid_argument&) {
-                    // do nothing
-                } catch (std::runtime_error&) {
-                    if (ignore_cycle_creating_dependencies) {
-                        // nothing
-                    }
-                    else {
-                        throw;
-                    }
+        /**
+         * @brief Add a task dependency
+         * @param parent_id: the ID of the parent task
+         * @param child_id: the ID of the child task
+         */
+        void addDependency(const std::string &parent_id, const std::string &child_id) {
+            try {
+                auto parent_task = this->workflow->getTaskByID(parent_id);
+                auto child_task = this->workflow->getTaskByID(child_id);
+                this->workflow->addControlDependency(parent_task, child_task, this->redundant_dependencies);
+            } catch (std::invalid_argument &) {
+                // do nothing
+            } catch (std::runtime_error &) {
+                if (not this->ignore_cycle_creating_dependencies) {
+                    throw;
                 }
             }
+        }
+    };
 
-            for (auto const& child : task_spec.at("children")) {
-                try {
-                    auto child_task = workflow->getTaskByID(child);
-                    workflow->addControlDependency(task, child_task, redundant_dependencies);
-                }
-                catch (std::invalid_argument&) {
-                    // do nothing
-                } catch (std::runtime_error&) {
-                    if (ignore_cycle_creating_dependencies) {
-                        // nothing
-                    }
-                    else {
-                        throw;
-                    }
-                }
+    /**
+     * Documentation in .h file
+     */
+    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSON(const std::string& filename,
+                                                                              const std::string& reference_flop_rate,
+                                                                              bool ignore_machine_specs,
+                                                                              bool redundant_dependencies,
+                                                                              bool ignore_cycle_creating_dependencies,
+                                                                              unsigned long min_cores_per_task,
+                                                                              unsigned long max_cores_per_task,
+                                                                              bool enforce_num_cores,
+                                                                              bool ignore_avg_cpu,
+                                                                              bool show_warnings) {
+        double flop_rate = UnitParser::parse_compute_speed(reference_flop_rate);
+
+        // The file is parsed as it is read, rather than being loaded in memory first
+        std::ifstream file(filename, std::ios::in | std::ios::binary);
+        if (not file.is_open()) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file (cannot open file " + filename + ")");
+        }
+        WfCommonsJSONStreamParser parser(flop_rate, ignore_machine_specs,
+                                         redundant_dependencies,
+                                         ignore_cycle_creating_dependencies,
+                                         min_cores_per_task,
+                                         max_cores_per_task,
+                                         enforce_num_cores,
+                                         ignore_avg_cpu,
+                                         show_warnings);
+        try {
+            nlohmann::json::sax_parse(file, &parser);
+            if (file.bad()) {
+                throw std::invalid_argument(
+                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file (error while reading file " + filename + ")");
             }
+            return parser.finish();
+        } catch (...) {
+            parser.removeAddedFiles();
+            throw;
         }
+    }
 
-        // Update all top/bottom levels computations again
-        workflow->enableTopBottomLevelDynamicUpdates(true);
-        workflow->updateAllTopBottomLevels();
+    /**
+    * Documentation in .h file
+    */
+    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSONString(const std::string& json_string,
+        const std::string& reference_flop_rate,
+        bool ignore_machine_specs,
+        bool redundant_dependencies,
+        bool ignore_cycle_creating_dependencies,
+        unsigned long min_cores_per_task,
+        unsigned long max_cores_per_task,
+        bool enforce_num_cores,
+        bool ignore_avg_cpu,
+        bool show_warnings) {
+        double flop_rate = UnitParser::parse_compute_speed(reference_flop_rate);
+
+        WfCommonsJSONStreamParser parser(flop_rate, ignore_machine_specs,
+                                         redundant_dependencies,
+                                         ignore_cycle_creating_dependencies,
+                                         min_cores_per_task,
+                                         max_cores_per_task,
+                                         enforce_num_cores,
+                                         ignore_avg_cpu,
+                                         show_warnings);
+        try {
+            nlohmann::json::sax_parse(json_string, &parser);
+            return parser.finish();
+        } catch (...) {
+            parser.removeAddedFiles();
+            throw;
+        }
+    }
+
+    /**
+     * Documentation in .h file
+     */
+    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSONWithSnapshot(const std::string& filename,
+                                                                                          const std::string& snapshot_filename,
+                                                                                          const std::string& reference_flop_rate,
+                                                                                          bool ignore_machine_specs,
+                                                                                          bool redundant_dependencies,
+                                                                                          bool ignore_cycle_creating_dependencies,
+                                                                                          unsigned long min_cores_per_task,
+                                                                                          unsigned long max_cores_per_task,
+                                                                                          bool enforce_num_cores,
+                                                                                          bool ignore_avg_cpu,
+                                                                                          bool show_warnings) {
+        // The snapshot must have been created from the same file content, and with the same arguments
+        std::string key;
+        try {
+            key = WorkflowSnapshot::computeSourceKey(
+                filename,
+                reference_flop_rate + "|" + std::to_string(ignore_machine_specs) +
+                std::to_string(redundant_dependencies) + std::to_string(ignore_cycle_creating_dependencies) + "|" +
+                std::to_string(min_cores_per_task) + "|" + std::to_string(max_cores_per_task) + "|" +
+                std::to_string(enforce_num_cores) + std::to_string(ignore_avg_cpu));
+        }
+        catch (std::invalid_argument& e) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJSONWithSnapshot(): Invalid JSON file (" + std::string(e.what()) + ")");
+        }
+
+        auto workflow = WorkflowSnapshot::load(snapshot_filename, key);
+        if (workflow) {
+            return workflow;
+        }
 
+        workflow = WfCommonsWorkflowParser::createWorkflowFromJSON(filename, reference_flop_rate, ignore_machine_specs,
+                                                                   redundant_dependencies,
+                                                                   ignore_cycle_creating_dependencies,
+                                                                   min_cores_per_task,
+                                                                   max_cores_per_task,
+                                                                   enforce_num_cores,
+                                                                   ignore_avg_cpu,
+                                                                   show_warnings);
+        WorkflowSnapshot::save(workflow, snapshot_filename, key);
         return workflow;
     }
 